@@ -57,6 +57,100 @@ class GuessesStructure
     }
 };
 
+/// The outputs that the Riemann solvers of density-based compressible flow solvers need, in SI units on a mass basis
+class CompressibleFlowState
+{
+   public:
+    double p,        ///< pressure in Pa
+      T,             ///< temperature in K; if positive when passed in, it is the initial guess for the temperature
+      speed_sound,   ///< speed of sound in m/s (of the homogeneous equilibrium mixture if two-phase)
+      dpdrho_e,      ///< derivative of the pressure with respect to the density at constant specific internal energy, in Pa/(kg/m^3)
+      dpde_rho;      ///< derivative of the pressure with respect to the specific internal energy at constant density, in kg/m^3
+    CompressibleFlowState() : p(_HUGE), T(-1), speed_sound(_HUGE), dpdrho_e(_HUGE), dpde_rho(_HUGE){};
+};
+
+/// The inputs of one call to update() and the essential values of the updated state,
+/// enough to restore the state without repeating the flash calculation
+class UpdateCacheEntry
+{
+   public:
+    input_pairs input_pair;          ///< The input pair, as passed to update()
+    double value1,                   ///< The first input, as passed to update()
+      value2;                        ///< The second input, as passed to update()
+    phases imposed_phase;            ///< The imposed phase at the time of the update
+    tolerance_tiers tolerance_tier;  ///< The solver tolerance tier at the time of the update
+    std::vector<CoolPropDbl> z;      ///< The bulk composition at the time of the update
+    CoolPropDbl T,                   ///< temperature in K
+      rhomolar,                      ///< molar density in mol/m^3
+      p,                             ///< pressure in Pa
+      Q;                             ///< vapor quality
+    phases phase;                    ///< The phase of the updated state
+    CoolPropDbl TL,                  ///< temperature of the saturated liquid in K (two-phase only)
+      rhomolarL,                     ///< molar density of the saturated liquid in mol/m^3 (two-phase only)
+      pL,                            ///< pressure of the saturated liquid in Pa (two-phase only)
+      TV,                            ///< temperature of the saturated vapor in K (two-phase only)
+      rhomolarV,                     ///< molar density of the saturated vapor in mol/m^3 (two-phase only)
+      pV;                            ///< pressure of the saturated vapor in Pa (two-phase only)
+    std::vector<CoolPropDbl> x,      ///< molar composition of the liquid phase (two-phase mixtures only)
+      y;                             ///< molar composition of the vapor phase (two-phase mixtures only)
+    unsigned long long last_used;    ///< Counter value of the last access, for the least-recently-used replacement
+
+    /// Return true if the inputs match the ones of this entry exactly (bit for bit)
+    bool matches(input_pairs input_pair, double value1, double value2, phases imposed_phase, tolerance_tiers tolerance_tier,
+                 const std::vector<CoolPropDbl>& z) const;
+};
+
+/// A small least-recently-used cache of the results of update(), keyed on the exact bit patterns of the inputs,
+/// the composition and the imposed phase.  It is disabled (capacity of zero) by default.
+class UpdateCache
+{
+   private:
+    std::vector<UpdateCacheEntry> entries;
+    std::size_t _capacity;
+    unsigned long long counter, _hits, _misses;
+
+   public:
+    UpdateCache() : _capacity(0), counter(0), _hits(0), _misses(0){};
+    /// Set the maximum number of entries; a capacity of zero disables the cache
+    void set_capacity(std::size_t capacity) {
+        _capacity = capacity;
+        clear();
+    };
+    std::size_t capacity() const {
+        return _capacity;
+    };
+    bool enabled() const {
+        return _capacity > 0;
+    };
+    /// Remove all the entries, but keep the statistics
+    void clear() {
+        entries.clear();
+        entries.reserve(_capacity);
+    };
+    /// Reset the hit and miss counters
+    void reset_statistics() {
+        _hits = 0;
+        _misses = 0;
+    };
+    unsigned long long hits() const {
+        return _hits;
+    };
+    unsigned long long misses() const {
+        return _misses;
+    };
+    /// The fraction of the lookups that were hits, or zero if there was no lookup
+    double hit_rate() const {
+        return (_hits + _misses > 0) ? static_cast<double>(_hits) / static_cast<double>(_hits + _misses) : 0.0;
+    };
+    /// Find the entry for the given inputs; returns NULL (and counts a miss) if there is none
+    const UpdateCacheEntry* find(input_pairs input_pair, double value1, double value2, phases imposed_phase, tolerance_tiers tolerance_tier,
+                                 const std::vector<CoolPropDbl>& z);
+    /// Insert an entry, replacing the least-recently-used one if the cache is full
+    void insert(const UpdateCacheEntry& entry);
+    /// The memory used by the entries, in bytes
+    std::size_t memory_footprint() const;
+};
+
 //! The mother of all state classes
 /*!
 This class provides the basic properties based on interrelations of the
@@ -77,11 +171,27 @@ Interpolator inherit AS implemented by TTSE BICUBIC
 */
 class AbstractState
 {
+   private:
+    /// Whether this instance is in the registry of the live instances (see set_live_state_tracking); it belongs to the instance,
+    /// so it is neither copied nor assigned
+    struct LiveStateTracking
+    {
+        bool tracked;
+        LiveStateTracking() : tracked(false){};
+        LiveStateTracking(const LiveStateTracking&) : tracked(false){};
+        LiveStateTracking& operator=(const LiveStateTracking&) {
+            return *this;
+        };
+    };
+    LiveStateTracking _live_state_tracking;
+
    protected:
     /// Some administrative variables
     long _fluid_type;
     phases _phase;               ///< The key for the phase from CoolProp::phases enum
     phases imposed_phase_index;  ///< If the phase is imposed, the imposed phase index
+    tolerance_tiers _tolerance_tier;  ///< The accuracy tier used by the iterative solvers
+    UpdateCache update_cache;         ///< The (opt-in) cache of the results of update()
 
     bool isSupercriticalPhase(void) {
         return (this->_phase == iphase_supercritical || this->_phase == iphase_supercritical_liquid || this->_phase == iphase_supercritical_gas);
@@ -686,11 +796,74 @@ class AbstractState
         throw NotImplementedError("calc_change_EOS is not implemented for this backend");
     };
 
+    /// Using this backend, update the state from the mass density and the specific internal energy and fill in the outputs for
+    /// compressible flow solvers; the default is a DmassUmass_INPUTS update followed by fill_compressible_flow_state()
+    virtual void calc_compressible_flow_state(double rhomass, double umass, CompressibleFlowState& state);
+    /// Fill in the outputs for compressible flow solvers from the current state
+    void fill_compressible_flow_state(CompressibleFlowState& state);
+    /// Using this backend, update the state from the temperature and the molar density and get the viscosity and the thermal
+    /// conductivity; the default is a DmolarT_INPUTS update followed by viscosity() and conductivity()
+    virtual void calc_transport_properties(double T, double rhomolar, double& viscosity, double& conductivity);
+
+    /// Using this backend, get the memory used by this instance, in bytes, without the states that it owns (see calc_child_states)
+    /// and without the tables that it shares with other instances; the default is the size of the base class and of the update cache
+    virtual std::size_t calc_memory_footprint(void);
+    /// Using this backend, append the states that this instance owns to children; the default is that there are none
+    virtual void calc_child_states(std::vector<AbstractState*>& children){};
+
+    /// Using this backend, set the accuracy tier of the iterative solvers
+    virtual void calc_set_tolerance_tier(tolerance_tiers tier) {
+        _tolerance_tier = tier;
+    };
+
+    /// Using this backend, enable the cache of the results of update() with the given capacity
+    virtual void calc_enable_update_cache(std::size_t capacity) {
+        throw NotImplementedError("The update cache is not implemented for this backend");
+    };
+    /// Using this backend, copy the essential values of the current state into a cache entry
+    virtual void calc_save_update_cache_entry(UpdateCacheEntry& entry) {
+        throw NotImplementedError("calc_save_update_cache_entry is not implemented for this backend");
+    };
+    /// Using this backend, restore the state from a cache entry
+    virtual void calc_restore_update_cache_entry(const UpdateCacheEntry& entry) {
+        throw NotImplementedError("calc_restore_update_cache_entry is not implemented for this backend");
+    };
+    /// Look up the inputs (as passed to update()) in the update cache and restore the state if found; returns true on a hit
+    bool restore_from_update_cache(CoolProp::input_pairs input_pair, double value1, double value2);
+    /// Store the current state in the update cache under the inputs as passed to update()
+    void store_in_update_cache(CoolProp::input_pairs input_pair, double value1, double value2);
+
+    /// Using this backend, append the values that define the current state to a snapshot buffer, after its header (see snapshot())
+    virtual void calc_snapshot(std::vector<double>& buffer) {
+        throw NotImplementedError("snapshot is not implemented for this backend");
+    };
+    /// Using this backend, set the state from the values of a snapshot buffer, starting at index i, without any flash calculation;
+    /// i is advanced past the values that are read.  All the values are read and checked (see restore_end()) before the state is changed
+    virtual void calc_restore(const std::vector<double>& buffer, std::size_t& i) {
+        throw NotImplementedError("restore is not implemented for this backend");
+    };
+    /// Using this backend, a string that identifies the fluids and their equations of state; its checksum is in the header of the
+    /// snapshots.  By default, the names of the fluids
+    virtual std::string calc_snapshot_fluids(void);
+    /// Read the value at index i of a snapshot buffer and advance i; throws a ValueError at the end of the buffer
+    static double restore_value(const std::vector<double>& buffer, std::size_t& i);
+    /// Append a cached value to a snapshot buffer, NaN if it is not cached
+    static void snapshot_cached(std::vector<double>& buffer, CachedElement& element);
+    /// Read a value that was written by snapshot_cached; a NaN clears the element
+    static void restore_cached(const std::vector<double>& buffer, std::size_t& i, CachedElement& element);
+    /// Append a vector to a snapshot buffer, preceded by its length
+    static void snapshot_vector(std::vector<double>& buffer, const std::vector<CoolPropDbl>& values);
+    /// Read a vector that was written by snapshot_vector
+    static void restore_vector(const std::vector<double>& buffer, std::size_t& i, std::vector<CoolPropDbl>& values);
+    /// Check that all the values of a snapshot buffer were read; throws a ValueError if not
+    static void restore_end(const std::vector<double>& buffer, std::size_t i);
+
    public:
-    AbstractState() : _fluid_type(FLUID_TYPE_UNDEFINED), _phase(iphase_unknown) {
-        clear();
-    }
-    virtual ~AbstractState(){};
+    AbstractState();
+    /// The copy is registered as a live instance of its own if the tracking of the live instances is enabled
+    AbstractState(const AbstractState& other);
+    AbstractState& operator=(const AbstractState& other) = default;
+    virtual ~AbstractState();
 
     /// A factory function to return a pointer to a new-allocated instance of one of the backends.
     /**
@@ -838,6 +1011,98 @@ class AbstractState
         throw NotImplementedError("update_with_guesses is not implemented for this backend");
     };
 
+    /**
+     * @brief Update the state from the conservative variables of a density-based compressible flow solver, and get what its Riemann solver needs
+     * @param rhomass The density in kg/m^3
+     * @param umass The specific internal energy in J/kg
+     * @param state The outputs; if state.T is positive when passed in (the temperature of the cell at the last time step, for instance),
+     * backends that iterate on the temperature start from it
+     */
+    void compressible_flow_state(double rhomass, double umass, CompressibleFlowState& state) {
+        calc_compressible_flow_state(rhomass, umass, state);
+    };
+    /**
+     * @brief The same as compressible_flow_state() for arrays of cells
+     *
+     * states is resized to the number of cells if it does not have that size already; otherwise the temperatures in it are the
+     * initial guesses.  The outputs of the cells that fail are set to _HUGE, and the other cells are still evaluated.
+     */
+    void compressible_flow_states(const std::vector<double>& rhomass, const std::vector<double>& umass, std::vector<CompressibleFlowState>& states);
+
+    /**
+     * @brief Update the state from the temperature and the molar density, and get the viscosity and the thermal conductivity
+     * @param T The temperature in K
+     * @param rhomolar The molar density in mol/m^3
+     * @param viscosity The viscosity in Pa-s
+     * @param conductivity The thermal conductivity in W/m/K
+     */
+    void transport_properties(double T, double rhomolar, double& viscosity, double& conductivity) {
+        calc_transport_properties(T, rhomolar, viscosity, conductivity);
+    };
+    /**
+     * @brief The same as transport_properties() for arrays of (T, rhomolar) points, for building tables and post-processing fields
+     *
+     * The outputs are resized to the number of points.  The outputs of the points that fail are set to _HUGE, and the other points
+     * are still evaluated.
+     */
+    void transport_properties_batch(const std::vector<double>& T, const std::vector<double>& rhomolar, std::vector<double>& viscosity,
+                                    std::vector<double>& conductivity);
+
+    /**
+     * @brief The memory used by this instance and by all the states that it owns (saturated phases, reference states of the
+     * transport models, etc.), in bytes
+     *
+     * The tables that are shared by the instances (tabular backends, transport tables) and the fluid library are not included;
+     * they are reported by CoolProp::get_memory_report().  The footprints are estimates: the containers are counted at their
+     * capacity, but the small objects that they point to (the parameters of the departure functions, for instance) are not.
+     *
+     * If the tracking of the live instances is enabled, the backend and the footprint of each of the states are recorded for live_states().
+     */
+    std::size_t memory_footprint(void);
+    /**
+     * @brief Enable or disable the tracking of the live instances for live_states(); it is disabled by default
+     *
+     * Only the instances that are constructed while the tracking is enabled are tracked.  Each tracked instance takes a global lock
+     * when it is constructed and destroyed.
+     */
+    static void set_live_state_tracking(bool enabled);
+    /// True if the tracking of the live instances is enabled
+    static bool live_state_tracking(void);
+    /**
+     * @brief Get the number of live instances and the memory that they use, by backend name
+     *
+     * Every tracked instance counts, also the ones that other instances own, and each one is counted once, with its own footprint
+     * (see calc_memory_footprint).  The backends and footprints are the ones that the instances recorded themselves the last time
+     * that memory_footprint() was called on them or on a state that owns them, which factory() does for the states that it makes;
+     * the instances that have not recorded themselves yet are counted under the backend "?".  The instances themselves are not
+     * accessed, so this can be called while other threads use, create or destroy instances.
+     * @param counts The number of live instances of each backend
+     * @param bytes The memory used by the live instances of each backend, in bytes
+     */
+    static void live_states(std::map<std::string, std::size_t>& counts, std::map<std::string, std::size_t>& bytes);
+
+    /**
+     * @brief Take a snapshot of the current state, to be restored later with restore(), by this instance or by another instance of the same backend
+     *
+     * The snapshot is a flat buffer of doubles: a header (the version of the layout, a checksum of the name of the backend, a checksum of
+     * the fluids and their equations of state, and the length of the buffer), followed by the values that the backend needs to set the
+     * state again without any flash calculation: the temperature, the density, the phase, the quality and the composition, the saturated
+     * phases of a two-phase state, and the values that the solvers start from at the next update.  The configuration of the instance
+     * (imposed phase, tolerance tier, reference state, etc.) is not part of the snapshot.  The buffer is only meant to be restored by the
+     * same build of CoolProp.
+     */
+    std::vector<double> snapshot(void);
+    /// The same as snapshot(), into a buffer whose memory is reused from one snapshot to the next
+    void snapshot(std::vector<double>& buffer);
+    /**
+     * @brief Restore a state from a snapshot that was taken with snapshot(), without any flash calculation
+     *
+     * Throws a ValueError, without changing the state, if the buffer is not a snapshot of this backend with the same fluids, or if it
+     * does not hold a valid state
+     * @param buffer The snapshot
+     */
+    void restore(const std::vector<double>& buffer);
+
     /// A function that says whether the backend instance can be instantiated in the high-level interface
     /// In general this should be true, except for some other backends (especially the tabular backends)
     /// To disable use in high-level interface, implement this function and return false
@@ -845,6 +1110,12 @@ class AbstractState
         return true;
     }
 
+    /// Whether Ttriple(), Tmin(), Tmax() and pmax() give the limits of validity of the equation of state
+    /// The backends without such limits (the cubics) return false, and their limits are then derived from the critical point
+    virtual bool has_limits_of_validity(void) {
+        return true;
+    }
+
     /// Return a string from the backend for the mixture/fluid - backend dependent - could be CAS #, name, etc.
     virtual std::string fluid_param_string(const std::string&) {
         throw NotImplementedError("fluid_param_string has not been implemented for this backend");
@@ -947,6 +1218,73 @@ class AbstractState
         calc_unspecify_phase();
     };
 
+    /// Set the accuracy tier (exact, standard or fast) used by the iterative solvers for all further calculations with this state class
+    void set_tolerance_tier(tolerance_tiers tier) {
+        calc_set_tolerance_tier(tier);
+    };
+    /// Get the accuracy tier used by the iterative solvers
+    tolerance_tiers tolerance_tier(void) {
+        return _tolerance_tier;
+    };
+    /**
+     * @brief Convert a relative solver tolerance to the accuracy tier of this state class
+     * @param tol_standard The relative (dimensionless) tolerance that is used for the standard tier
+     *
+     * The exact tier tightens the tolerance by two orders of magnitude (but not below 100 machine epsilon), the fast tier
+     * relaxes it to 1e-6 if it was tighter than that.  Only for tolerances on relative changes or normalized residuals; the
+     * tolerances in the units of a variable must use the overload with the scale of the variable.
+     */
+    double solver_tolerance(double tol_standard) const;
+    /**
+     * @brief Convert an absolute solver tolerance to the accuracy tier of this state class
+     * @param tol_standard The tolerance, in the units of the variable, that is used for the standard tier
+     * @param scale The magnitude of the variable, for instance the upper bound of the bracket of a Brent solver
+     *
+     * The tiers are applied relative to the scale: the exact tier tightens the tolerance by two orders of magnitude (but not
+     * below 100 machine epsilon times the scale), the fast tier relaxes it to 1e-6 times the scale if it was tighter than that
+     */
+    double solver_tolerance(double tol_standard, double scale) const;
+
+    /**
+     * @brief Enable a small least-recently-used cache of the results of update()
+     * @param capacity The maximum number of cached states
+     *
+     * A call to update() whose inputs, composition, imposed phase and tolerance tier match a cached call bit for bit
+     * restores the cached state instead of repeating the flash calculation.  This pays off when the same states are
+     * evaluated over and over again, as in the iterations of a cycle solver.
+     */
+    void enable_update_cache(std::size_t capacity = 16) {
+        if (capacity == 0) {
+            throw ValueError("The capacity of the update cache must be greater than zero");
+        }
+        calc_enable_update_cache(capacity);
+    };
+    /// Disable the update cache and remove all its entries
+    void disable_update_cache(void) {
+        update_cache.set_capacity(0);
+    };
+    /// Remove all the entries of the update cache and reset its statistics
+    void clear_update_cache(void) {
+        update_cache.clear();
+        update_cache.reset_statistics();
+    };
+    /// Return true if the update cache is enabled
+    bool update_cache_enabled(void) const {
+        return update_cache.enabled();
+    };
+    /// Get the number of calls to update() that were served from the update cache
+    unsigned long long update_cache_hits(void) const {
+        return update_cache.hits();
+    };
+    /// Get the number of calls to update() that were not found in the update cache
+    unsigned long long update_cache_misses(void) const {
+        return update_cache.misses();
+    };
+    /// Get the fraction of the calls to update() that were served from the update cache
+    double update_cache_hit_rate(void) const {
+        return update_cache.hit_rate();
+    };
+
     /// Return the critical temperature in K
     double T_critical(void);
     /// Return the critical pressure in Pa
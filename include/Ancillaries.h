@@ -6,6 +6,7 @@
 #include "rapidjson_include.h"
 #include "Eigen/Core"
 #include "PolyMath.h"
+#include "crossplatform_shared_ptr.h"
 
 namespace CoolProp {
 
@@ -57,6 +58,15 @@ class SurfaceTensionCorrelation
         return std::accumulate(s.begin(), s.end(), 0.0);
     }
 };
+/// The fitted inverse T(output) of a saturation ancillary, a monotonic piecewise cubic; it is built when the fluid is loaded, and
+/// shared by all the copies of the ancillary
+struct SaturationAncillaryInverse
+{
+    std::vector<double> u,  ///< The nodes, in increasing order of the (possibly log-transformed) output
+      T,                    ///< The temperatures in K at the nodes
+      dTdu;                 ///< The slopes of the monotonic piecewise cubic at the nodes
+};
+
 /**
  *
  * This is generalized class that can be used to manage an ancillary curve,
@@ -107,12 +117,19 @@ class SaturationAncillaryFunction
         TYPE_EXPONENTIAL,         ///< It is an exponential type equation, with or without the T_c/T term
         TYPE_RATIONAL_POLYNOMIAL  ///< It is a rational polynomial equation
     };
-    ancillaryfunctiontypes type;  ///< The type of ancillary curve being used
+    ancillaryfunctiontypes type;                           ///< The type of ancillary curve being used
+    shared_ptr<const SaturationAncillaryInverse> inverse;  ///< The fitted inverse; NULL if the function is not monotonic
+    bool inv_log;                                          ///< True if the inverse is a function of the logarithm of the output
+
+    /// Fit the inverse T(output) by sampling the function between Tmin and Tmax; it is only built if the function is monotonic
+    void build_inverse(void);
+
    public:
     SaturationAncillaryFunction() {
         type = TYPE_NOT_SET;
         Tmin = _HUGE;
         Tmax = _HUGE;
+        inv_log = false;
     };
     SaturationAncillaryFunction(rapidjson::Value& json_code);
 
@@ -139,6 +156,20 @@ class SaturationAncillaryFunction
     /// @returns T The temperature in K
     double invert(double value, double min_bound = -1, double max_bound = -1);
 
+    /// Return true if the fitted inverse of this ancillary function is available
+    bool has_inverse(void) {
+        return inverse.get() != NULL;
+    };
+    /// The fitted inverse of this ancillary function, which the copies of the function share; NULL if it is not available
+    const SaturationAncillaryInverse* get_inverse(void) {
+        return inverse.get();
+    };
+
+    /// Evaluate the fitted inverse of this ancillary function, to be used as an initial guess for the temperature
+    /// @param value The value of the output
+    /// @returns T The temperature in K; falls back to invert() if the inverse is not available or the value is out of its range
+    double invert_approximate(double value);
+
     /// Get the minimum temperature in K
     double get_Tmin(void) {
         return Tmin;
@@ -148,6 +179,11 @@ class SaturationAncillaryFunction
     double get_Tmax(void) {
         return Tmax;
     };
+
+    /// The memory used by the coefficients, in bytes; the fitted inverse is shared by the copies of the ancillary, so it is not included
+    std::size_t memory_footprint(void) const {
+        return sizeof(double) * (num_coeffs.size() + den_coeffs.size() + n.capacity() + t.capacity() + s.capacity());
+    };
 };
 
 // ****************************************************************************
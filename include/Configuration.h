@@ -45,10 +45,28 @@
       "If true, rather than using the highly-accurate pure fluid equations of state, use the Peng-Robinson EOS")                                     \
     X(MAXIMUM_TABLE_DIRECTORY_SIZE_IN_GB, "MAXIMUM_TABLE_DIRECTORY_SIZE_IN_GB", 1.0,                                                                 \
       "The maximum allowed size of the directory that is used to store tabular data")                                                                \
+    X(TABULAR_COMPACT_STORAGE, "TABULAR_COMPACT_STORAGE", false,                                                                                     \
+      "If true, the tabular backends release the table matrices that they do not interpolate once the tables are loaded")                            \
+    X(TABULAR_FLOAT32_COEFFICIENTS, "TABULAR_FLOAT32_COEFFICIENTS", false,                                                                           \
+      "If true, the coefficients of the bicubic backend are stored in single precision, which halves their memory")                                  \
+    X(TABULAR_TILE_ISOBARS, "TABULAR_TILE_ISOBARS", static_cast<int>(20),                                                                            \
+      "The number of isobars in each tile of the single-phase tables; each tile is saved as it is built so that interrupted builds resume")          \
+    X(TABULAR_LAZY_TILES, "TABULAR_LAZY_TILES", false,                                                                                               \
+      "If true, the tiles of the single-phase tables are only built when the first state falls in them")                                             \
+    X(TABULAR_ISOBAR_CONTINUATION, "TABULAR_ISOBAR_CONTINUATION", true,                                                                              \
+      "If true, each node of the single-phase (h,p) and (T,p) tables of pure fluids starts from the density of the previous node of its isobar")     \
+    X(TRANSPORT_SURROGATE_FLUIDS, "TRANSPORT_SURROGATE_FLUIDS", "",                                                                                  \
+      "The pure fluids (separated by LIST_STRING_DELIMITER) whose viscosity and conductivity HEOS interpolates in (T, log(rho)) tables")             \
+    X(TRANSPORT_SURROGATE_TOLERANCE, "TRANSPORT_SURROGATE_TOLERANCE", 1e-4,                                                                          \
+      "The largest relative error of the transport tables at the check point of a cell for the tables to be used in that cell")                      \
+    X(HEOS_WATER_IF97_GUESSES, "HEOS_WATER_IF97_GUESSES", false,                                                                                     \
+      "If true, the p-h, p-s, h-s and p-T flashes of the HEOS backend for water start from the IF97 backward equations")                             \
     X(DONT_CHECK_PROPERTY_LIMITS, "DONT_CHECK_PROPERTY_LIMITS", false,                                                                               \
       "If true, when possible, CoolProp will skip checking whether values are inside the property limits")                                           \
     X(HENRYS_LAW_TO_GENERATE_VLE_GUESSES, "HENRYS_LAW_TO_GENERATE_VLE_GUESSES", false,                                                               \
       "If true, when doing water-based mixture dewpoint calculations, use Henry's Law to generate guesses for liquid-phase composition")             \
+    X(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, "CUBIC_GUESSES_FOR_MIXTURE_FLASHES", false,                                                                 \
+      "If true, the (Q,T) and (P,Q) flashes of multiparameter mixtures start from the solution of a Peng-Robinson model of the mixture")             \
     X(PHASE_ENVELOPE_STARTING_PRESSURE_PA, "PHASE_ENVELOPE_STARTING_PRESSURE_PA", 100.0, "Starting pressure [Pa] for phase envelope construction")   \
     X(R_U_CODATA, "R_U_CODATA", 8.3144598,                                                                                                           \
       "The value for the ideal gas constant in J/mol/K according to CODATA 2014.  This value is used to harmonize all the ideal gas constants. "     \
@@ -18,6 +18,7 @@ You might want to start by looking at CoolProp.h
 
 #include <string>
 #include <vector>
+#include <map>
 #include "DataStructures.h"
 
 namespace CoolProp {
@@ -85,9 +86,44 @@ double saturation_ancillary(const std::string& fluid_name, const std::string& ou
 
 /// Get a globally-defined string
 /// @param ParamName A string, one of "version", "errstring", "warnstring", "gitrevision", "FluidsList", "fluids_list", "parameter_list","predefined_mixtures"
+/// or "memory_report" (see get_memory_report)
 /// @returns str The string, or an error message if not valid input
 std::string get_global_param_string(const std::string& ParamName);
 
+/// The memory held by CoolProp, in bytes; all the footprints are estimates (see AbstractState::memory_footprint)
+class MemoryReport
+{
+   public:
+    std::size_t fluid_library_fluids,               ///< The number of fluids in the fluid library
+      fluid_library_bytes,                          ///< The memory used by the fluids of the fluid library
+      fluid_library_JSON_bytes;                     ///< The memory used by the JSON strings of the fluids of the fluid library
+    std::map<std::string, std::size_t> table_sets,  ///< The memory used by the tables of the tabular backends, by path to the tables
+      transport_tables,                             ///< The memory used by the transport tables, by fluid name
+      live_states,                                  ///< The number of live AbstractState instances, by backend name
+      live_state_bytes;                             ///< The memory used by the live AbstractState instances, by backend name
+    std::size_t handles,                            ///< The number of handles of the C API (see AbstractState_factory)
+      handle_table_bytes,                           ///< The memory used by the table of the handles of the C API
+      handle_state_bytes;                           ///< The memory used by the states of the handles and the states they own
+    MemoryReport()
+      : fluid_library_fluids(0), fluid_library_bytes(0), fluid_library_JSON_bytes(0), handles(0), handle_table_bytes(0), handle_state_bytes(0){};
+    /// The total of all the footprints; the states of the handles are also live states, so they are only added if the live
+    /// instances are not tracked (see AbstractState::set_live_state_tracking)
+    std::size_t total_bytes() const;
+    /// The report as a JSON object
+    std::string to_JSON() const;
+};
+/// Get the memory that CoolProp holds: the fluid library, the tables shared by the instances, and the live instances by backend.
+/// This is the report that get_global_param_string("memory_report") returns as JSON.
+/// The live instances are only reported if they are tracked (see AbstractState::set_live_state_tracking).  The states of the handles of
+/// the C API are accessed, so no other thread may use the C API during the call.
+MemoryReport get_memory_report();
+
+/// The function that reports the handles of the C API for get_memory_report: their number, the memory of their table, and the memory of
+/// their states
+typedef void (*HandleMemoryFootprintCallback)(std::size_t& handles, std::size_t& table_bytes, std::size_t& state_bytes);
+/// Set the function that reports the handles of the C API for get_memory_report; the C API sets it when it is loaded
+void set_handle_memory_footprint_callback(HandleMemoryFootprintCallback callback);
+
 /*/// Get a long that represents the fluid type
     /// @param FluidName The fluid name as a string
     /// @returns long element from global type enumeration
@@ -32,7 +32,6 @@ struct BibTeXKeysStruct
 struct EnvironmentalFactorsStruct
 {
     double GWP20, GWP100, GWP500, ODP, HH, PH, FH;
-    std::string ASHRAE34;
 };
 struct CriticalRegionSplines
 {
@@ -375,8 +374,6 @@ class TransportPropertyData
     ConductivityCriticalVariables conductivity_critical;
     ConductivityECSVariables conductivity_ecs;
 
-    std::string BibTeX_viscosity,                      ///< The BibTeX key for the viscosity model
-      BibTeX_conductivity;                             ///< The BibTeX key for the conductivity model
     bool viscosity_using_ECS;                          ///< A flag for whether to use extended corresponding states for viscosity.  False for no
     bool conductivity_using_ECS;                       ///< A flag for whether to use extended corresponding states for conductivity.  False for no
     bool viscosity_using_Chung;                        ///< A flag for whether to use Chung model. False for no
@@ -435,8 +432,6 @@ class EquationOfState
     bool pseudo_pure;    ///< Is a pseudo-pure fluid (true) or pure fluid (false)
     ResidualHelmholtzContainer alphar;  ///< The residual Helmholtz energy
     IdealHelmholtzContainer alpha0;     ///< The ideal Helmholtz energy
-    std::string BibTeX_EOS,             ///< The bibtex key for the equation of state
-      BibTeX_CP0;                       ///< The bibtex key for the ideal gas specific heat correlation
     CriticalRegionSplines
       critical_region_splines;  ///< A cubic spline in the form T = f(rho) for saturated liquid and saturated vapor curves in the near-critical region
 
@@ -514,6 +509,26 @@ class EquationOfState
     };
 };
 
+/// The descriptive data of a fluid, which the property calculations never use
+/**
+The copies of a fluid (one in each instance of the backends) share one instance of this class, so that the strings are not
+copied along with the data that the calculations use.  The BibTeX keys of the equation of state and of the ideal-gas specific
+heat are those of the first equation of state of the fluid.
+*/
+struct FluidMetadata
+{
+    std::string REFPROPname;      ///< The REFPROP-compliant name; if not included, "name" is assumed to be a valid name for REFPROP
+    std::string formula;          ///< The chemical formula, in LaTeX form
+    std::string InChI;            ///< The InChI string for the fluid
+    std::string InChIKey;         ///< The InChI key for the fluid
+    std::string smiles;           ///< The SMILES identifier for the fluid
+    int ChemSpider_id;            ///< The ChemSpider identifier for the fluid
+    std::string TwoDPNG_URL;      ///< The URL to a 2D representation of the molecule (from ChemSpider)
+    std::string ASHRAE34;         ///< The ASHRAE standard 34 safety rating
+    BibTeXKeysStruct BibTeXKeys;  ///< The BibTeX keys associated
+    FluidMetadata() : ChemSpider_id(-1){};
+};
+
 /// A thermophysical property provider for critical and reducing values as well as derivatives of Helmholtz energy
 /**
 This fluid instance is populated using an entry from a JSON file
@@ -525,9 +540,7 @@ class CoolPropFluid
     std::string ECSReferenceFluid;  ///< A string that gives the name of the fluids that should be used for the ECS method for transport properties
     double ECS_qd;                  ///< The critical qd parameter for the Olchowy-Sengers cross-over term
    public:
-    CoolPropFluid() : ECS_qd(-_HUGE) {
-        this->ChemSpider_id = -1;
-    };
+    CoolPropFluid() : ECS_qd(-_HUGE){};
     ~CoolPropFluid(){};
     const EquationOfState& EOS() const {
         return EOSVector[0];
@@ -537,19 +550,11 @@ class CoolPropFluid
     }                                        ///< Get a reference to the equation of state
     std::vector<EquationOfState> EOSVector;  ///< The equations of state that could be used for this fluid
 
-    std::string name;  ///< The name of the fluid
-    std::string
-      REFPROPname;  ///< The REFPROP-compliant name if REFPROP-"name" is not a compatible fluid name.  If not included, "name" is assumed to be a valid name for REFPROP
-    std::string CAS;                   ///< The CAS number of the fluid
-    std::string formula;               ///< The chemical formula, in LaTeX form
-    std::vector<std::string> aliases;  ///< A vector of aliases of names for the fluid
-    std::string InChI;                 ///< The InChI string for the fluid
-    std::string InChIKey;              ///< The InChI key for the fluid
-    std::string smiles;                ///< The SMILES identifier for the fluid
-    int ChemSpider_id;                 ///< The ChemSpider identifier for the fluid
-    std::string TwoDPNG_URL;           ///< The URL to a 2D representation of the molecule (from ChemSpider)
-
-    BibTeXKeysStruct BibTeXKeys;             ///< The BibTeX keys associated
+    std::string name;                    ///< The name of the fluid
+    std::string CAS;                     ///< The CAS number of the fluid
+    std::vector<std::string> aliases;    ///< A vector of aliases of names for the fluid
+    shared_ptr<FluidMetadata> metadata;  ///< The descriptive data, shared by the copies of the fluid; NULL if the fluid has none
+
     EnvironmentalFactorsStruct environment;  ///< The environmental variables for global warming potential, ODP, etc.
     Ancillaries ancillaries;                 ///< The set of ancillary equations for dewpoint, bubblepoint, surface tension, etc.
     TransportPropertyData transport;
@@ -563,6 +568,11 @@ class CoolPropFluid
     double molar_mass() {
         return EOS().molar_mass;
     };
+    /// Get the descriptive data of the fluid; empty if the fluid has none
+    const FluidMetadata& get_metadata() const {
+        static const FluidMetadata empty;
+        return metadata ? *metadata : empty;
+    };
 };
 
 #if !defined(NO_FMTLIB) && FMT_VERSION >= 90000
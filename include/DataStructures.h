@@ -186,6 +186,14 @@ enum phases
     iphase_not_imposed
 };  ///< Phase is not imposed
 
+/// Accuracy tiers for the iterative solvers (density solver, saturation solvers and flash routines)
+enum tolerance_tiers
+{
+    iTOLERANCE_EXACT,     ///< Tightest tolerances, about two orders of magnitude below the standard ones
+    iTOLERANCE_STANDARD,  ///< The default tolerances
+    iTOLERANCE_FAST       ///< Relaxed tolerances, about 1e-6 relative accuracy (optimizer inner loops, early CFD iterations, etc.)
+};
+
 /// Constants for the different PC-SAFT association schemes (see Huang and Radosz 1990)
 enum schemes
 {
@@ -448,7 +456,8 @@ enum backend_families
     SRK_BACKEND_FAMILY,
     PR_BACKEND_FAMILY,
     VTPR_BACKEND_FAMILY,
-    PCSAFT_BACKEND_FAMILY
+    PCSAFT_BACKEND_FAMILY,
+    GERG2008_BACKEND_FAMILY
 };
 enum backends
 {
@@ -465,7 +474,8 @@ enum backends
     SRK_BACKEND,
     PR_BACKEND,
     VTPR_BACKEND,
-    PCSAFT_BACKEND
+    PCSAFT_BACKEND,
+    GERG2008_BACKEND
 };
 
 /// Convert a string into the enum values
@@ -483,6 +493,10 @@ inline int format_as(phases phase) {
     return fmt::underlying(phase);
 }
 
+inline int format_as(tolerance_tiers tier) {
+    return fmt::underlying(tier);
+}
+
 inline int format_as(schemes scheme) {
     return fmt::underlying(scheme);
 }
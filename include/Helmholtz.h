@@ -168,7 +168,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl base(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl base(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.alphar;
@@ -177,7 +177,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.dalphar_dtau;
@@ -186,7 +186,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dTau2(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dTau2(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d2alphar_dtau2;
@@ -195,7 +195,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dDelta_dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta_dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d2alphar_ddelta_dtau;
@@ -204,7 +204,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dDelta(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.dalphar_ddelta;
@@ -213,7 +213,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dDelta2(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta2(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d2alphar_ddelta2;
@@ -222,7 +222,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dDelta2_dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta2_dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d3alphar_ddelta2_dtau;
@@ -231,7 +231,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dDelta_dTau2(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta_dTau2(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d3alphar_ddelta_dtau2;
@@ -240,7 +240,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dTau3(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dTau3(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d3alphar_dtau3;
@@ -249,7 +249,7 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dDelta3(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta3(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d3alphar_ddelta3;
@@ -258,33 +258,33 @@ class BaseHelmholtzTerm
     /** @param tau Reciprocal reduced temperature where \f$\tau=T_c / T\f$
      *  @param delta Reduced density where \f$\delta = \rho / \rho_c \f$
      */
-    virtual CoolPropDbl dTau4(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dTau4(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d4alphar_dtau4;
     };
-    virtual CoolPropDbl dDelta_dTau3(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta_dTau3(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d4alphar_ddelta_dtau3;
     };
-    virtual CoolPropDbl dDelta2_dTau2(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta2_dTau2(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d4alphar_ddelta2_dtau2;
     };
-    virtual CoolPropDbl dDelta3_dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta3_dTau(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d4alphar_ddelta3_dtau;
     };
-    virtual CoolPropDbl dDelta4(const CoolPropDbl& tau, const CoolPropDbl& delta) throw() {
+    virtual CoolPropDbl dDelta4(const CoolPropDbl& tau, const CoolPropDbl& delta) {
         HelmholtzDerivatives deriv;
         all(tau, delta, deriv);
         return deriv.d4alphar_ddelta4;
     };
 
-    virtual void all(const CoolPropDbl& tau, const CoolPropDbl& delta, HelmholtzDerivatives& derivs) throw() = 0;
+    virtual void all(const CoolPropDbl& tau, const CoolPropDbl& delta, HelmholtzDerivatives& derivs) = 0;
 };
 
 struct ResidualHelmholtzGeneralizedExponentialElement
@@ -321,6 +321,15 @@ struct ResidualHelmholtzGeneralizedExponentialElement
         m_is_int = true;
     };
 };
+/// The factors of one term of ResidualHelmholtzGeneralizedExponential that depend only on tau (or only on delta)
+struct ResidualHelmholtzGeneralizedExponentialFactors
+{
+    /// The part of \f$ \delta^{d_i} \tau^{t_i}\exp(u_i) \f$ that depends on this variable
+    CoolPropDbl exp_part;
+    /// The B functions, for tau \f$ B_k = \tau^k (\partial^k \alpha^r_i/\partial \tau^k)/\alpha^r_i \f$ (and likewise for delta)
+    CoolPropDbl B1, B2, B3, B4;
+};
+
 /** \brief A generalized residual helmholtz energy container that can deal with a wide range of terms which can be converted to this general form
  *
  * \f$ \alpha^r=\sum_i n_i \delta^{d_i} \tau^{t_i}\exp(u_i) \f$
@@ -346,9 +355,26 @@ class ResidualHelmholtzGeneralizedExponential : public BaseHelmholtzTerm
     //Eigen::ArrayXd uE, du_ddeltaE, du_dtauE, d2u_ddelta2E, d2u_dtau2E, d3u_ddelta3E, d3u_dtau3E;
 
     std::vector<ResidualHelmholtzGeneralizedExponentialElement> elements;
+
+    // The factors that depend only on tau (or only on delta) are kept while tau (or delta) does not change.  In the density
+    // solvers and the saturation solvers T is fixed and only delta changes, and vice versa for the solvers at fixed density
+    std::vector<ResidualHelmholtzGeneralizedExponentialFactors> tau_factors, delta_factors;
+    CoolPropDbl cached_tau, cached_delta;
+    /// The exponents t_i and d_i, and scratch space for the exponential parts, contiguous for the vector math kernels
+    std::vector<double> t_exponents, d_exponents, u_part, exp_part;
+
     // Default Constructor
     ResidualHelmholtzGeneralizedExponential()
-      : delta_li_in_u(false), tau_mi_in_u(false), eta1_in_u(false), eta2_in_u(false), beta1_in_u(false), beta2_in_u(false), finished(false), N(0){};
+      : delta_li_in_u(false),
+        tau_mi_in_u(false),
+        eta1_in_u(false),
+        eta2_in_u(false),
+        beta1_in_u(false),
+        beta2_in_u(false),
+        finished(false),
+        N(0),
+        cached_tau(_HUGE),
+        cached_delta(_HUGE){};
     /** \brief Add and convert an old-style power (polynomial) term to generalized form
 	 *
 	 * Term of the format
@@ -499,12 +525,33 @@ class ResidualHelmholtzGeneralizedExponential : public BaseHelmholtzTerm
         //        d3u_ddelta3E.resize(elements.size());
         //        d3u_dtau3E.resize(elements.size());
 
+        clear_cached_factors();
         finished = true;
     };
 
+    /// Forget the factors that depend only on tau or only on delta; must be called if the elements are changed after they have been evaluated
+    void clear_cached_factors() {
+        tau_factors.resize(elements.size());
+        delta_factors.resize(elements.size());
+        t_exponents.resize(elements.size());
+        d_exponents.resize(elements.size());
+        for (std::size_t i = 0; i < elements.size(); ++i) {
+            t_exponents[i] = elements[i].t;
+            d_exponents[i] = elements[i].d;
+        }
+        u_part.resize(elements.size());
+        exp_part.resize(elements.size());
+        cached_tau = _HUGE;
+        cached_delta = _HUGE;
+    };
+    /// Calculate the factors of each element that depend only on tau
+    void calc_tau_factors(const CoolPropDbl& tau);
+    /// Calculate the factors of each element that depend only on delta
+    void calc_delta_factors(const CoolPropDbl& delta);
+
     void to_json(rapidjson::Value& el, rapidjson::Document& doc);
 
-    void all(const CoolPropDbl& tau, const CoolPropDbl& delta, HelmholtzDerivatives& derivs) throw();
+    void all(const CoolPropDbl& tau, const CoolPropDbl& delta, HelmholtzDerivatives& derivs);
     //void allEigen(const CoolPropDbl &tau, const CoolPropDbl &delta, HelmholtzDerivatives &derivs) throw();
 };
 
@@ -1340,6 +1387,8 @@ class IdealHelmholtzContainer : public BaseHelmholtzContainer
 {
    private:
     double _prefactor;
+    CoolPropDbl _cached_tau;           ///< The value of tau for which _tau_terms were evaluated
+    HelmholtzDerivatives _tau_terms;  ///< The sum of the terms that only depend on tau
 
    public:
     IdealHelmholtzLead Lead;
@@ -1353,7 +1402,7 @@ class IdealHelmholtzContainer : public BaseHelmholtzContainer
     IdealHelmholtzGERG2004Cosh GERG2004Cosh;
     IdealHelmholtzGERG2004Sinh GERG2004Sinh;
 
-    IdealHelmholtzContainer() : _prefactor(1.0){};
+    IdealHelmholtzContainer() : _prefactor(1.0), _cached_tau(_HUGE){};
 
     void set_prefactor(double prefactor) {
         _prefactor = prefactor;
@@ -1362,6 +1411,12 @@ class IdealHelmholtzContainer : public BaseHelmholtzContainer
     void set_Tred(double T_red) {
         GERG2004Cosh.set_Tred(T_red);
         GERG2004Sinh.set_Tred(T_red);
+        clear_cached_tau_terms();
+    }
+
+    /// Forget the sum of the terms that only depend on tau; must be called if these terms are changed after they have been evaluated
+    void clear_cached_tau_terms() {
+        _cached_tau = _HUGE;
     }
 
     void empty_the_EOS() {
@@ -1375,20 +1430,27 @@ class IdealHelmholtzContainer : public BaseHelmholtzContainer
         CP0PolyT = IdealHelmholtzCP0PolyT();
         GERG2004Cosh = IdealHelmholtzGERG2004Cosh();
         GERG2004Sinh = IdealHelmholtzGERG2004Sinh();
+        clear_cached_tau_terms();
     };
 
     HelmholtzDerivatives all(const CoolPropDbl tau, const CoolPropDbl delta, bool cache_values = false) {
+        // The terms that only depend on tau are only re-evaluated if tau has changed since the last call
+        if (tau != _cached_tau) {
+            _tau_terms = HelmholtzDerivatives();
+            LogTau.all(tau, delta, _tau_terms);
+            Power.all(tau, delta, _tau_terms);
+            PlanckEinstein.all(tau, delta, _tau_terms);
+            CP0Constant.all(tau, delta, _tau_terms);
+            CP0PolyT.all(tau, delta, _tau_terms);
+            GERG2004Cosh.all(tau, delta, _tau_terms);
+            GERG2004Sinh.all(tau, delta, _tau_terms);
+            _cached_tau = tau;
+        }
         HelmholtzDerivatives derivs;  // zeros out the elements
         Lead.all(tau, delta, derivs);
         EnthalpyEntropyOffsetCore.all(tau, delta, derivs);
         EnthalpyEntropyOffset.all(tau, delta, derivs);
-        LogTau.all(tau, delta, derivs);
-        Power.all(tau, delta, derivs);
-        PlanckEinstein.all(tau, delta, derivs);
-        CP0Constant.all(tau, delta, derivs);
-        CP0PolyT.all(tau, delta, derivs);
-        GERG2004Cosh.all(tau, delta, derivs);
-        GERG2004Sinh.all(tau, delta, derivs);
+        derivs = derivs + _tau_terms;
 
         if (cache_values) {
             _base = derivs.alphar * _prefactor;
@@ -31,6 +31,12 @@ double IceProps(const char* Name, double T, double p);
 void UseVirialCorrelations(int flag);
 void UseIsothermCompressCorrelation(int flag);
 void UseIdealGasEnthalpyCorrelations(int flag);
+/* \brief Answer HAPropsSI from tables in (p, T, W) for the common inputs, if the state is within the tables
+ *
+ * The tables are built the first time they are needed and cached in the tables directory, like those of the tabular
+ * backends.  Inputs or outputs that are not tabulated, and states outside of the tables, use the full calculation.
+ */
+void UseTabularHumidAir(int flag);
 
 // --------------
 // Help functions
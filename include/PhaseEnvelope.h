@@ -71,6 +71,22 @@ class PhaseEnvelopeData
         PHASE_ENVELOPE_MATRICES
 #undef X
     }
+    /// The memory used by the vectors and the matrices of the phase envelope, in bytes
+    std::size_t memory_footprint() const {
+        std::size_t bytes = 0;
+/* Use X macros to auto-generate the code; each will look something like: bytes += T.capacity()*sizeof(double); */
+#define X(name) bytes += name.capacity() * sizeof(double);
+        PHASE_ENVELOPE_VECTORS
+#undef X
+#define X(name)                                             \
+    bytes += name.capacity() * sizeof(std::vector<double>); \
+    for (std::size_t i = 0; i < name.size(); ++i) {         \
+        bytes += name[i].capacity() * sizeof(double);       \
+    }
+        PHASE_ENVELOPE_MATRICES
+#undef X
+        return bytes;
+    }
     void insert_variables(const CoolPropDbl T, const CoolPropDbl p, const CoolPropDbl rhomolar_liq, const CoolPropDbl rhomolar_vap,
                           const CoolPropDbl hmolar_liq, const CoolPropDbl hmolar_vap, const CoolPropDbl smolar_liq, const CoolPropDbl smolar_vap,
                           const std::vector<CoolPropDbl>& x, const std::vector<CoolPropDbl>& y, std::size_t i) {
@@ -2,11 +2,28 @@
 #define SPEEDTEST_H
 
 #include <string>
+#include <vector>
 
 namespace CoolProp {
 
 void compare_REFPROP_and_CoolProp(const std::string& fluid, int inputs, double val1, double val2, std::size_t N, double d1 = 0, double d2 = 0);
 
+/// Time the update of a HEOS state for each of the solver tolerance tiers, and report the largest relative deviation of T and rho from the exact tier
+/// @returns The largest relative deviations of the exact, standard and fast tiers (in this order) from the exact tier
+std::vector<double> compare_tolerance_tiers(const std::string& fluid, int inputs, double val1, double val2, std::size_t N, double d1 = 0,
+                                            double d2 = 0);
+
+/// Time the update of a HEOS mixture with and without the Peng-Robinson guesses (see CUBIC_GUESSES_FOR_MIXTURE_FLASHES), and report the
+/// evaluations of the multiparameter model per call and the largest relative deviation of T and rho between the two
+void compare_cubic_guesses(const std::string& fluids, const std::vector<double>& z, int inputs, double val1, double val2, std::size_t N,
+                           double d1 = 0, double d2 = 0);
+
+#if !defined(NO_TABULAR_BACKENDS)
+/// Time the build of the single-phase (h,p) and (T,p) tables of a pure fluid with and without the continuation along the isobars
+/// (see TABULAR_ISOBAR_CONTINUATION)
+void compare_table_build(const std::string& fluid, std::size_t Nx = 200, std::size_t Ny = 200);
+#endif
+
 } /* namespace CoolProp */
 
 #endif
\ No newline at end of file
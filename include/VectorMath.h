@@ -0,0 +1,65 @@
+#ifndef COOLPROP_VECTORMATH_H
+#define COOLPROP_VECTORMATH_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace CoolProp {
+
+/**
+ * @brief Elementwise exp, log and pow over arrays of doubles, for the inner loops of the EOS
+ *
+ * The functions are evaluated with SIMD kernels; the set of kernels (AVX-512, AVX2, NEON, or the portable scalar
+ * implementation of the same algorithms) is selected at run time based on the features of the CPU.  The results agree with
+ * those of the C math library to within one or two units in the last place over the ranges that are used in the
+ * evaluation of the equations of state; see the tests in VectorMath.cpp.
+ *
+ * The input and output arrays may be the same array.  The base of pow and exp_log must not be negative.
+ */
+namespace VectorMath {
+
+/// y[i] = exp(x[i]) for i = 0, ..., n-1
+void exp(const double* x, double* y, std::size_t n);
+/// y[i] = log(x[i]) for i = 0, ..., n-1
+void log(const double* x, double* y, std::size_t n);
+/// y[i] = pow(x[i], a[i]) for i = 0, ..., n-1, for x[i] >= 0
+void pow(const double* x, const double* a, double* y, std::size_t n);
+/**
+ * @brief y[i] = exp(a[i]*log(x) + b[i]) = pow(x, a[i])*exp(b[i]) for i = 0, ..., n-1, for x >= 0
+ *
+ * This is the form of the terms of the Helmholtz energy, for instance \f$ \tau^{t_i}\exp(u_i) \f$.  The logarithm of x is
+ * carried in extended precision so that the result is as accurate as that of pow(x, a[i])*exp(b[i]), but with one
+ * call to exp only.
+ */
+void exp_log(double x, const double* a, const double* b, double* y, std::size_t n);
+
+/// The name of the set of kernels in use, one of "AVX-512", "AVX2", "NEON" or "scalar"
+std::string kernels_in_use();
+/// The names of the sets of kernels that can be used on this CPU, fastest first
+std::vector<std::string> available_kernels();
+/// Use the given set of kernels (mostly for testing); returns false, and changes nothing, if it cannot be used on this CPU
+bool select_kernels(const std::string& name);
+
+namespace detail {
+
+/// The array functions for one instruction set
+struct Kernels
+{
+    const char* name;
+    void (*exp)(const double* x, double* y, std::size_t n);
+    void (*log)(const double* x, double* y, std::size_t n);
+    void (*pow)(const double* x, const double* a, double* y, std::size_t n);
+    void (*exp_log)(double x, const double* a, const double* b, double* y, std::size_t n);
+};
+
+/// The kernels for AVX2 and FMA (VectorMath_AVX2.cpp), or NULL if the compiler cannot generate them
+const Kernels* AVX2_kernels();
+/// The kernels for AVX-512F (VectorMath_AVX512.cpp), or NULL if the compiler cannot generate them
+const Kernels* AVX512_kernels();
+
+} /* namespace detail */
+
+} /* namespace VectorMath */
+} /* namespace CoolProp */
+#endif
@@ -10,6 +10,13 @@
 #endif
 
 #include <stdlib.h>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+#include <mutex>
+#include <atomic>
+#include <set>
 #include "math.h"
 #include "AbstractState.h"
 #include "DataStructures.h"
@@ -18,6 +25,7 @@
 #include "Backends/Cubics/VTPRBackend.h"
 #include "Backends/Incompressible/IncompressibleBackend.h"
 #include "Backends/PCSAFT/PCSAFTBackend.h"
+#include "Backends/Helmholtz/GERG2008Backend.h"
 
 #if !defined(NO_TABULAR_BACKENDS)
 #include "Backends/Tabular/TTSEBackend.h"
@@ -123,6 +131,95 @@ class PCSAFTGenerator : public CoolProp::AbstractStateGenerator
 // This static initialization will cause the generator to register
 static CoolProp::GeneratorInitializer<PCSAFTGenerator> pcsaft_gen(CoolProp::PCSAFT_BACKEND_FAMILY);
 
+class GERG2008Generator : public CoolProp::AbstractStateGenerator
+{
+   public:
+    CoolProp::AbstractState* get_AbstractState(const std::vector<std::string>& fluid_names) {
+        return new CoolProp::GERG2008Backend(fluid_names);
+    };
+};
+// This static initialization will cause the generator to register
+static CoolProp::GeneratorInitializer<GERG2008Generator> gerg2008_gen(CoolProp::GERG2008_BACKEND_FAMILY);
+
+/// The tracked instances of AbstractState that are alive, for the memory report, with the backend and the footprint that each instance
+/// recorded itself; the registry never calls the instances, so that it can be read while other threads use or destroy them
+class LiveStateRegistry
+{
+   private:
+    struct Record
+    {
+        std::string backend;
+        std::size_t bytes;
+        Record() : backend("?"), bytes(sizeof(AbstractState)){};
+    };
+    std::map<const AbstractState*, Record> states;
+    std::mutex mutex;
+
+   public:
+    void add(const AbstractState* AS) {
+        std::lock_guard<std::mutex> lock(mutex);
+        states[AS] = Record();
+    };
+    void remove(const AbstractState* AS) {
+        std::lock_guard<std::mutex> lock(mutex);
+        states.erase(AS);
+    };
+    /// Update the records of the instances that are tracked; the others are left out
+    void record(const std::vector<const AbstractState*>& AS, const std::vector<std::string>& backends, const std::vector<std::size_t>& bytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::size_t i = 0; i < AS.size(); ++i) {
+            std::map<const AbstractState*, Record>::iterator it = states.find(AS[i]);
+            if (it != states.end()) {
+                it->second.backend = backends[i];
+                it->second.bytes = bytes[i];
+            }
+        }
+    };
+    void totals(std::map<std::string, std::size_t>& counts, std::map<std::string, std::size_t>& bytes) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::map<const AbstractState*, Record>::const_iterator it = states.begin(); it != states.end(); ++it) {
+            counts[it->second.backend] += 1;
+            bytes[it->second.backend] += it->second.bytes;
+        }
+    };
+};
+inline LiveStateRegistry& get_live_state_registry() {
+    // Never deleted, so that the instances that are destroyed at exit, after the static objects of this file, can still unregister
+    static LiveStateRegistry* the_registry = new LiveStateRegistry();
+    return *the_registry;
+}
+static std::atomic<bool> live_state_tracking_enabled(false);
+
+AbstractState::AbstractState() : _fluid_type(FLUID_TYPE_UNDEFINED), _phase(iphase_unknown), _tolerance_tier(iTOLERANCE_STANDARD) {
+    clear();
+    if (live_state_tracking_enabled.load(std::memory_order_relaxed)) {
+        get_live_state_registry().add(this);
+        _live_state_tracking.tracked = true;
+    }
+}
+AbstractState::AbstractState(const AbstractState& other) : AbstractState() {
+    // The tracking is not assigned, so the copy keeps its own registration
+    *this = other;
+}
+AbstractState::~AbstractState() {
+    if (_live_state_tracking.tracked) {
+        get_live_state_registry().remove(this);
+    }
+}
+void AbstractState::set_live_state_tracking(bool enabled) {
+    live_state_tracking_enabled = enabled;
+}
+bool AbstractState::live_state_tracking(void) {
+    return live_state_tracking_enabled;
+}
+/// Record the backend and the footprint of a new instance from factory() and of the states it owns, if the live instances are tracked
+static AbstractState* record_live_states(AbstractState* AS) {
+    if (AbstractState::live_state_tracking()) {
+        AS->memory_footprint();
+    }
+    return AS;
+}
+
 AbstractState* AbstractState::factory(const std::string& backend, const std::vector<std::string>& fluid_names) {
     if (get_debug_level() > 0) {
         std::cout << "AbstractState::factory(" << backend << "," << stringvec_to_string(fluid_names) << ")" << std::endl;
@@ -141,17 +238,17 @@ AbstractState* AbstractState::factory(const std::string& backend, const std::vec
 
     if (gen != end) {
         // One of the registered backends was able to match the given backend family
-        return gen->second->get_AbstractState(fluid_names);
+        return record_live_states(gen->second->get_AbstractState(fluid_names));
     }
 #if !defined(NO_TABULAR_BACKENDS)
     else if (f1 == TTSE_BACKEND_FAMILY) {
         // Will throw if there is a problem with this backend
         shared_ptr<AbstractState> AS(factory(f2, fluid_names));
-        return new TTSEBackend(AS);
+        return record_live_states(new TTSEBackend(AS));
     } else if (f1 == BICUBIC_BACKEND_FAMILY) {
         // Will throw if there is a problem with this backend
         shared_ptr<AbstractState> AS(factory(f2, fluid_names));
-        return new BicubicBackend(AS);
+        return record_live_states(new BicubicBackend(AS));
     }
 #endif
     else if (!backend.compare("?") || backend.empty()) {
@@ -565,6 +662,287 @@ double AbstractState::pmax(void) {
 double AbstractState::T_critical(void) {
     return calc_T_critical();
 }
+double AbstractState::solver_tolerance(double tol_standard) const {
+    switch (_tolerance_tier) {
+        case iTOLERANCE_EXACT:
+            return std::min(tol_standard, std::max(1e-2 * tol_standard, 100 * DBL_EPSILON));
+        case iTOLERANCE_FAST:
+            return std::max(tol_standard, 1e-6);
+        default:
+            return tol_standard;
+    }
+}
+double AbstractState::solver_tolerance(double tol_standard, double scale) const {
+    scale = std::abs(scale);
+    switch (_tolerance_tier) {
+        case iTOLERANCE_EXACT:
+            return std::min(tol_standard, std::max(1e-2 * tol_standard, 100 * DBL_EPSILON * scale));
+        case iTOLERANCE_FAST:
+            return std::max(tol_standard, 1e-6 * scale);
+        default:
+            return tol_standard;
+    }
+}
+
+bool UpdateCacheEntry::matches(input_pairs input_pair, double value1, double value2, phases imposed_phase, tolerance_tiers tolerance_tier,
+                               const std::vector<CoolPropDbl>& z) const {
+    // Compare the bit patterns rather than the values so that -0.0 != 0.0 and NaN inputs are never matched by accident
+    return this->input_pair == input_pair && std::memcmp(&this->value1, &value1, sizeof(double)) == 0
+           && std::memcmp(&this->value2, &value2, sizeof(double)) == 0 && this->imposed_phase == imposed_phase
+           && this->tolerance_tier == tolerance_tier && this->z.size() == z.size()
+           && (z.empty() || std::memcmp(&(this->z[0]), &(z[0]), z.size() * sizeof(CoolPropDbl)) == 0);
+}
+
+const UpdateCacheEntry* UpdateCache::find(input_pairs input_pair, double value1, double value2, phases imposed_phase,
+                                          tolerance_tiers tolerance_tier, const std::vector<CoolPropDbl>& z) {
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].matches(input_pair, value1, value2, imposed_phase, tolerance_tier, z)) {
+            entries[i].last_used = ++counter;
+            _hits++;
+            return &(entries[i]);
+        }
+    }
+    _misses++;
+    return NULL;
+}
+
+void UpdateCache::insert(const UpdateCacheEntry& entry) {
+    if (_capacity == 0) {
+        return;
+    }
+    if (entries.size() < _capacity) {
+        entries.push_back(entry);
+        entries.back().last_used = ++counter;
+        return;
+    }
+    // Replace the least-recently-used entry
+    std::size_t i_oldest = 0;
+    for (std::size_t i = 1; i < entries.size(); ++i) {
+        if (entries[i].last_used < entries[i_oldest].last_used) {
+            i_oldest = i;
+        }
+    }
+    entries[i_oldest] = entry;
+    entries[i_oldest].last_used = ++counter;
+}
+
+std::size_t UpdateCache::memory_footprint() const {
+    std::size_t bytes = entries.capacity() * sizeof(UpdateCacheEntry);
+    for (std::vector<UpdateCacheEntry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+        bytes += (it->z.capacity() + it->x.capacity() + it->y.capacity()) * sizeof(CoolPropDbl);
+    }
+    return bytes;
+}
+
+bool AbstractState::restore_from_update_cache(CoolProp::input_pairs input_pair, double value1, double value2) {
+    if (!update_cache.enabled()) {
+        return false;
+    }
+    const UpdateCacheEntry* entry = update_cache.find(input_pair, value1, value2, imposed_phase_index, _tolerance_tier, get_mole_fractions());
+    if (entry == NULL) {
+        return false;
+    }
+    calc_restore_update_cache_entry(*entry);
+    return true;
+}
+
+void AbstractState::store_in_update_cache(CoolProp::input_pairs input_pair, double value1, double value2) {
+    if (!update_cache.enabled()) {
+        return;
+    }
+    UpdateCacheEntry entry;
+    entry.input_pair = input_pair;
+    entry.value1 = value1;
+    entry.value2 = value2;
+    entry.imposed_phase = imposed_phase_index;
+    entry.tolerance_tier = _tolerance_tier;
+    entry.z = get_mole_fractions();
+    calc_save_update_cache_entry(entry);
+    update_cache.insert(entry);
+}
+void AbstractState::calc_compressible_flow_state(double rhomass, double umass, CompressibleFlowState& state) {
+    update(DmassUmass_INPUTS, rhomass, umass);
+    fill_compressible_flow_state(state);
+}
+void AbstractState::fill_compressible_flow_state(CompressibleFlowState& state) {
+    state.p = p();
+    state.T = T();
+    if (phase() == iphase_twophase) {
+        // In terms of rho(p, h), with e = h - p/rho
+        double rho = rhomass();
+        double drhodp_h = first_two_phase_deriv(iDmass, iP, iHmass), drhodh_p = first_two_phase_deriv(iDmass, iHmass, iP);
+        state.dpde_rho = 1 / (-drhodp_h / drhodh_p - 1 / rho);
+        state.dpdrho_e = (1 + drhodh_p * state.p / POW2(rho)) / (drhodp_h + drhodh_p / rho);
+        // c^2 = dp/drho|s = dp/drho|e + p/rho^2*dp/de|rho, since de = T*ds + p/rho^2*drho
+        state.speed_sound = sqrt(state.dpdrho_e + state.p / POW2(rho) * state.dpde_rho);
+    } else {
+        state.speed_sound = speed_sound();
+        state.dpdrho_e = first_partial_deriv(iP, iDmass, iUmass);
+        state.dpde_rho = first_partial_deriv(iP, iUmass, iDmass);
+    }
+}
+void AbstractState::compressible_flow_states(const std::vector<double>& rhomass, const std::vector<double>& umass,
+                                             std::vector<CompressibleFlowState>& states) {
+    if (rhomass.size() != umass.size()) {
+        throw ValueError(format("Sizes of rhomass [%d] and umass [%d] must be the same", rhomass.size(), umass.size()));
+    }
+    if (states.size() != rhomass.size()) {
+        states.assign(rhomass.size(), CompressibleFlowState());
+    }
+    for (std::size_t i = 0; i < rhomass.size(); ++i) {
+        try {
+            calc_compressible_flow_state(rhomass[i], umass[i], states[i]);
+        } catch (std::exception&) {
+            states[i] = CompressibleFlowState();
+            states[i].T = _HUGE;
+        }
+    }
+}
+void AbstractState::calc_transport_properties(double T, double rhomolar, double& viscosity, double& conductivity) {
+    update(DmolarT_INPUTS, rhomolar, T);
+    viscosity = this->viscosity();
+    conductivity = this->conductivity();
+}
+void AbstractState::transport_properties_batch(const std::vector<double>& T, const std::vector<double>& rhomolar, std::vector<double>& viscosity,
+                                               std::vector<double>& conductivity) {
+    if (T.size() != rhomolar.size()) {
+        throw ValueError(format("Sizes of T [%d] and rhomolar [%d] must be the same", T.size(), rhomolar.size()));
+    }
+    viscosity.resize(T.size());
+    conductivity.resize(T.size());
+    for (std::size_t i = 0; i < T.size(); ++i) {
+        try {
+            calc_transport_properties(T[i], rhomolar[i], viscosity[i], conductivity[i]);
+        } catch (std::exception&) {
+            viscosity[i] = _HUGE;
+            conductivity[i] = _HUGE;
+        }
+    }
+}
+std::size_t AbstractState::calc_memory_footprint(void) {
+    return sizeof(AbstractState) + update_cache.memory_footprint();
+}
+std::size_t AbstractState::memory_footprint(void) {
+    // Walk the tree of owned states; a state can be owned twice (the saturated phases are also linked states, for instance)
+    std::set<AbstractState*> visited;
+    std::vector<AbstractState*> pending(1, this);
+    std::size_t bytes = 0;
+    const bool tracking = live_state_tracking();
+    std::vector<const AbstractState*> states;
+    std::vector<std::string> backends;
+    std::vector<std::size_t> footprints;
+    while (!pending.empty()) {
+        AbstractState* AS = pending.back();
+        pending.pop_back();
+        if (AS == NULL || !visited.insert(AS).second) {
+            continue;
+        }
+        std::size_t footprint = AS->calc_memory_footprint();
+        bytes += footprint;
+        if (tracking) {
+            states.push_back(AS);
+            backends.push_back(AS->backend_name());
+            footprints.push_back(footprint);
+        }
+        AS->calc_child_states(pending);
+    }
+    if (tracking) {
+        get_live_state_registry().record(states, backends, footprints);
+    }
+    return bytes;
+}
+void AbstractState::live_states(std::map<std::string, std::size_t>& counts, std::map<std::string, std::size_t>& bytes) {
+    counts.clear();
+    bytes.clear();
+    get_live_state_registry().totals(counts, bytes);
+}
+
+/// The version of the layout of the snapshot buffers, the first value of their header
+static const double SNAPSHOT_VERSION = 2;
+/// The number of values in the header of the snapshot buffers: the version, the checksums of the backend name and of the fluids, and
+/// the length of the buffer
+static const std::size_t SNAPSHOT_HEADER_SIZE = 4;
+/// The 32-bit FNV-1a hash of a string, which a double holds exactly
+static double snapshot_checksum(const std::string& s) {
+    uint32_t hash = 2166136261u;
+    for (std::string::const_iterator it = s.begin(); it != s.end(); ++it) {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= 16777619u;
+    }
+    return static_cast<double>(hash);
+}
+void AbstractState::snapshot(std::vector<double>& buffer) {
+    buffer.clear();
+    buffer.push_back(SNAPSHOT_VERSION);
+    buffer.push_back(snapshot_checksum(backend_name()));
+    buffer.push_back(snapshot_checksum(calc_snapshot_fluids()));
+    buffer.push_back(0);
+    calc_snapshot(buffer);
+    buffer[3] = static_cast<double>(buffer.size());
+}
+std::vector<double> AbstractState::snapshot(void) {
+    std::vector<double> buffer;
+    snapshot(buffer);
+    return buffer;
+}
+void AbstractState::restore(const std::vector<double>& buffer) {
+    if (buffer.size() < SNAPSHOT_HEADER_SIZE || buffer[0] != SNAPSHOT_VERSION || buffer[3] != static_cast<double>(buffer.size())) {
+        throw ValueError("The buffer is not a snapshot of a state, or it was taken with another version of CoolProp");
+    }
+    if (buffer[1] != snapshot_checksum(backend_name())) {
+        throw ValueError(format("The snapshot was not taken with the %s backend", backend_name().c_str()));
+    }
+    if (buffer[2] != snapshot_checksum(calc_snapshot_fluids())) {
+        throw ValueError("The snapshot was not taken with the same fluids or equations of state");
+    }
+    std::size_t i = SNAPSHOT_HEADER_SIZE;
+    calc_restore(buffer, i);
+}
+std::string AbstractState::calc_snapshot_fluids(void) {
+    try {
+        return strjoin(fluid_names(), "&");
+    } catch (NotImplementedError&) {
+    }
+    try {
+        return name();
+    } catch (NotImplementedError&) {
+        return "";
+    }
+}
+double AbstractState::restore_value(const std::vector<double>& buffer, std::size_t& i) {
+    if (i >= buffer.size()) {
+        throw ValueError("The snapshot is too short for this state");
+    }
+    return buffer[i++];
+}
+void AbstractState::snapshot_cached(std::vector<double>& buffer, CachedElement& element) {
+    buffer.push_back(element ? static_cast<double>(element) : std::numeric_limits<double>::quiet_NaN());
+}
+void AbstractState::restore_cached(const std::vector<double>& buffer, std::size_t& i, CachedElement& element) {
+    double value = restore_value(buffer, i);
+    if (std::isnan(value)) {
+        element.clear();
+    } else {
+        element = value;
+    }
+}
+void AbstractState::snapshot_vector(std::vector<double>& buffer, const std::vector<CoolPropDbl>& values) {
+    buffer.push_back(static_cast<double>(values.size()));
+    buffer.insert(buffer.end(), values.begin(), values.end());
+}
+void AbstractState::restore_vector(const std::vector<double>& buffer, std::size_t& i, std::vector<CoolPropDbl>& values) {
+    double n = restore_value(buffer, i);
+    if (!(n >= 0 && n <= static_cast<double>(buffer.size() - i))) {
+        throw ValueError("The snapshot is too short for this state");
+    }
+    values.assign(buffer.begin() + i, buffer.begin() + i + static_cast<std::size_t>(n));
+    i += static_cast<std::size_t>(n);
+}
+void AbstractState::restore_end(const std::vector<double>& buffer, std::size_t i) {
+    if (i != buffer.size()) {
+        throw ValueError(format("The snapshot has %d values, but only %d are used to restore the state", buffer.size(), i));
+    }
+}
 double AbstractState::T_reducing(void) {
     if (!ValidNumber(_reducing.T)) {
         calc_reducing_state();
@@ -1211,4 +1589,85 @@ TEST_CASE("Check derivatives in first_partial_deriv", "[derivs_in_first_partial_
     CHECK(std::abs(dspeed_sound_drho_analyt / dspeed_sound_drho_num - 1) < eps);
 }
 
+TEST_CASE("Check the update cache", "[update_cache]") {
+    shared_ptr<CoolProp::AbstractState> Water(CoolProp::AbstractState::factory("HEOS", "Water"));
+    shared_ptr<CoolProp::AbstractState> Ref(CoolProp::AbstractState::factory("HEOS", "Water"));
+    Water->enable_update_cache(4);
+    SECTION("Repeated single-phase updates") {
+        for (int i = 0; i < 3; ++i) {
+            Water->update(CoolProp::PT_INPUTS, 101325, 300);
+            Ref->update(CoolProp::PT_INPUTS, 101325, 300);
+            CHECK(Water->rhomolar() == Ref->rhomolar());
+            CHECK(Water->hmolar() == Ref->hmolar());
+            CHECK(Water->phase() == Ref->phase());
+        }
+        CHECK(Water->update_cache_misses() == 1);
+        CHECK(Water->update_cache_hits() == 2);
+    }
+    SECTION("Repeated two-phase updates") {
+        for (int i = 0; i < 3; ++i) {
+            Water->update(CoolProp::PQ_INPUTS, 101325, 0.3);
+            Ref->update(CoolProp::PQ_INPUTS, 101325, 0.3);
+            CHECK(Water->T() == Ref->T());
+            CHECK(Water->hmolar() == Ref->hmolar());
+            CHECK(Water->saturated_liquid_keyed_output(CoolProp::iDmolar) == Ref->saturated_liquid_keyed_output(CoolProp::iDmolar));
+            CHECK(Water->saturated_vapor_keyed_output(CoolProp::iDmolar) == Ref->saturated_vapor_keyed_output(CoolProp::iDmolar));
+        }
+        CHECK(Water->update_cache_hits() == 2);
+    }
+    SECTION("Least-recently-used replacement and imposed phase") {
+        for (int i = 0; i < 5; ++i) {
+            Water->update(CoolProp::PT_INPUTS, 101325, 300 + i);
+        }
+        // The first state has been replaced
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        CHECK(Water->update_cache_hits() == 0);
+        // A different imposed phase is a different key
+        Water->specify_phase(CoolProp::iphase_liquid);
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        CHECK(Water->update_cache_hits() == 0);
+        Water->unspecify_phase();
+        Water->update(CoolProp::PT_INPUTS, 101325, 304);
+        CHECK(Water->update_cache_hits() == 1);
+        CHECK(std::abs(Water->update_cache_hit_rate() - 1.0 / 8.0) < 1e-14);
+    }
+    SECTION("Disabled cache") {
+        Water->disable_update_cache();
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        CHECK(Water->update_cache_hits() == 0);
+    }
+}
+TEST_CASE("The update cache is cleared when the model changes", "[update_cache]") {
+    SECTION("Binary interaction parameter of a cubic") {
+        shared_ptr<CoolProp::AbstractState> PR(CoolProp::AbstractState::factory("PR", "Methane&Ethane"));
+        std::vector<double> z(2, 0.5);
+        PR->set_mole_fractions(z);
+        PR->update(CoolProp::PT_INPUTS, 5e6, 300);
+        double hmolar = PR->hmolar();
+        PR->enable_update_cache(4);
+        // HmolarP goes through the cached update of the HEOS backend
+        PR->update(CoolProp::HmolarP_INPUTS, hmolar, 5e6);
+        double T = PR->T(), rhomolar = PR->rhomolar();
+        PR->set_binary_interaction_double(0, 1, "kij", 0.1);
+        PR->update(CoolProp::HmolarP_INPUTS, hmolar, 5e6);
+        CHECK(PR->update_cache_hits() == 0);
+        CHECK(std::abs(PR->T() / T - 1) > 1e-6);
+        CHECK(std::abs(PR->rhomolar() / rhomolar - 1) > 1e-6);
+    }
+    SECTION("Reference state") {
+        shared_ptr<CoolProp::AbstractState> Water(CoolProp::AbstractState::factory("HEOS", "Water"));
+        Water->enable_update_cache(4);
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        double hmolar = Water->hmolar();
+        Water->set_reference_stateS("NBP");
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        CHECK(Water->update_cache_hits() == 0);
+        CHECK(std::abs(Water->hmolar() - hmolar) > 1);
+        Water->set_reference_stateD(300, 55000, 0, 0);
+        Water->update(CoolProp::PT_INPUTS, 101325, 300);
+        CHECK(Water->update_cache_hits() == 0);
+    }
+}
+
 #endif
@@ -459,8 +459,7 @@ void CoolProp::AbstractCubicBackend::saturation(CoolProp::input_pairs inputs) {
             _T = Ts;
             rhoL = resid.deltaL * cubic->get_Tr();
             rhoV = resid.deltaV * cubic->get_Tr();
-            this->SatL->update(DmolarT_INPUTS, rhoL, _T);
-            this->SatV->update(DmolarT_INPUTS, rhoV, _T);
+            set_saturated_states(_T, rhoL, rhoV, _p, _p, mole_fractions, mole_fractions);
         } else {
             HelmholtzEOSMixtureBackend::update(PQ_INPUTS, _p, _Q);
             return;
@@ -497,8 +496,7 @@ void CoolProp::AbstractCubicBackend::saturation(CoolProp::input_pairs inputs) {
             _p = ps;
             rhoL = resid.deltaL * cubic->get_Tr();
             rhoV = resid.deltaV * cubic->get_Tr();
-            this->SatL->update(DmolarT_INPUTS, rhoL, _T);
-            this->SatV->update(DmolarT_INPUTS, rhoV, _T);
+            set_saturated_states(_T, rhoL, rhoV, _p, _p, mole_fractions, mole_fractions);
         } else {
             HelmholtzEOSMixtureBackend::update(QT_INPUTS, _Q, _T);
             return;
@@ -604,6 +602,7 @@ void CoolProp::AbstractCubicBackend::set_binary_interaction_double(const std::si
     for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
         (*it)->set_binary_interaction_double(i, j, parameter, value);
     }
+    clear_model_caches();
 };
 double CoolProp::AbstractCubicBackend::get_binary_interaction_double(const std::size_t i, const std::size_t j, const std::string& parameter) {
     // bound-check indices
@@ -670,6 +669,7 @@ void CoolProp::AbstractCubicBackend::set_cubic_alpha_C(const size_t i, const std
         AbstractCubicBackend* ACB = static_cast<AbstractCubicBackend*>(it->get());
         ACB->set_cubic_alpha_C(i, parameter, c1, c2, c3);
     }
+    clear_model_caches();
 }
 
 void CoolProp::AbstractCubicBackend::set_fluid_parameter_double(const size_t i, const std::string& parameter, const double value) {
@@ -693,6 +693,7 @@ void CoolProp::AbstractCubicBackend::set_fluid_parameter_double(const size_t i,
     } else {
         throw ValueError(format("I don't know what to do with parameter [%s]", parameter.c_str()));
     }
+    clear_model_caches();
 }
 double CoolProp::AbstractCubicBackend::get_fluid_parameter_double(const size_t i, const std::string& parameter) {
     // bound-check indices
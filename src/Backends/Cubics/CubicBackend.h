@@ -51,6 +51,11 @@ class AbstractCubicBackend : public HelmholtzEOSMixtureBackend
 
     std::vector<std::string> calc_fluid_names(void);
 
+    /// A cubic equation of state has no limits of validity of its own
+    bool has_limits_of_validity(void) {
+        return false;
+    };
+
     bool using_mole_fractions(void) {
         return true;
     };
@@ -117,10 +117,12 @@ void CoolProp::VTPRBackend::set_binary_interaction_double(const std::size_t i, c
     for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
         (*it)->set_binary_interaction_double(i, j, parameter, value);
     }
+    clear_model_caches();
 };
 
 void CoolProp::VTPRBackend::set_Q_k(const size_t sgi, const double value) {
     cubic->set_Q_k(sgi, value);
+    clear_model_caches();
 };
 
 double CoolProp::VTPRBackend::get_binary_interaction_double(const std::size_t i, const std::size_t j, const std::string& parameter) {
@@ -0,0 +1,412 @@
+#include "BinaryInteractionFitter.h"
+#include "MixtureDerivatives.h"
+#include <limits>
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+namespace CoolProp {
+
+/// The derivatives of the reducing state with respect to one of the parameters
+struct ReducingParameterDerivatives
+{
+    double dTr,                                   ///< derivative of the reducing temperature
+      drhor;                                      ///< derivative of the reducing density
+    std::vector<double> dndTrdni, dndrhorbardni;  ///< derivatives of n*dTr/dn_i and n*drhor/dn_i
+    bool departure;                               ///< True if the parameter is the departure function multiplier Fij
+};
+
+/// Calculate the derivatives of the reducing state with respect to a parameter; the mole fractions are taken to be independent
+static ReducingParameterDerivatives get_reducing_parameter_derivatives(HelmholtzEOSMixtureBackend& HEOS, const std::string& parameter) {
+    const std::vector<CoolPropDbl>& x = HEOS.get_mole_fractions();
+    const x_N_dependency_flag xN_flag = XN_INDEPENDENT;
+    std::size_t N = x.size();
+    ReducingParameterDerivatives d;
+    d.dTr = 0;
+    d.drhor = 0;
+    d.dndTrdni.resize(N, 0.0);
+    d.dndrhorbardni.resize(N, 0.0);
+    d.departure = (parameter == "Fij");
+    if (d.departure) {
+        return d;
+    }
+    // The derivatives of dTr/dx_i or drhor/dx_i with respect to the parameter
+    std::vector<double> d2Ydxidparam(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        if (parameter == "betaT") {
+            d2Ydxidparam[i] = HEOS.Reducing->d2Tr_dxidbetaT(x, i, xN_flag);
+        } else if (parameter == "gammaT") {
+            d2Ydxidparam[i] = HEOS.Reducing->d2Tr_dxidgammaT(x, i, xN_flag);
+        } else if (parameter == "betaV") {
+            d2Ydxidparam[i] = HEOS.Reducing->d2rhormolar_dxidbetaV(x, i, xN_flag);
+        } else if (parameter == "gammaV") {
+            d2Ydxidparam[i] = HEOS.Reducing->d2rhormolar_dxidgammaV(x, i, xN_flag);
+        } else {
+            throw ValueError(format("Unable to fit the parameter [%s]", parameter.c_str()));
+        }
+    }
+    // n*dY/dn_i = dY/dx_i - sum_k x_k*dY/dx_k for independent mole fractions
+    double summer = 0;
+    for (std::size_t k = 0; k < N; ++k) {
+        summer += x[k] * d2Ydxidparam[k];
+    }
+    std::vector<double>& dnd = (parameter == "betaT" || parameter == "gammaT") ? d.dndTrdni : d.dndrhorbardni;
+    for (std::size_t i = 0; i < N; ++i) {
+        dnd[i] = d2Ydxidparam[i] - summer;
+    }
+    if (parameter == "betaT") {
+        d.dTr = HEOS.Reducing->dTr_dbetaT(x);
+    } else if (parameter == "gammaT") {
+        d.dTr = HEOS.Reducing->dTr_dgammaT(x);
+    } else if (parameter == "betaV") {
+        d.drhor = HEOS.Reducing->drhormolar_dbetaV(x);
+    } else {
+        d.drhor = HEOS.Reducing->drhormolar_dgammaV(x);
+    }
+    return d;
+}
+
+double BIPFitResult::sum_squares() const {
+    double summer = 0;
+    for (std::size_t i = 0; i < residuals.size(); ++i) {
+        if (ValidNumber(residuals[i])) {
+            summer += residuals[i] * residuals[i];
+        }
+    }
+    return summer;
+}
+
+BinaryInteractionFitter::BinaryInteractionFitter(const std::vector<std::string>& fluid_names, const std::vector<std::string>& parameter_names,
+                                                 const std::vector<BIPFitDataPoint>& points)
+  : parameter_names(parameter_names), points(points), Nrows(0) {
+    if (fluid_names.size() != 2) {
+        throw ValueError(format("The fitting of the binary interaction parameters requires two components; %d were given", fluid_names.size()));
+    }
+    HEOS.reset(new HelmholtzEOSMixtureBackend(fluid_names, false));
+    for (std::size_t k = 0; k < parameter_names.size(); ++k) {
+        const std::string& name = parameter_names[k];
+        if (name != "betaT" && name != "gammaT" && name != "betaV" && name != "gammaV" && name != "Fij") {
+            throw ValueError(format("Unable to fit the parameter [%s]; valid parameters are betaT, gammaT, betaV, gammaV and Fij", name.c_str()));
+        }
+        if (name == "Fij" && !HEOS->residual_helmholtz->Excess.DepartureFunctionMatrix[0][1]) {
+            throw ValueError("Unable to fit Fij because there is no departure function for this pair");
+        }
+    }
+    first_row.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const BIPFitDataPoint& pt = points[i];
+        if (pt.x.size() != 2 || (pt.type == BIP_FIT_VLE && pt.y.size() != 2)) {
+            throw ValueError(format("The compositions of data point %d must have two entries", i));
+        }
+        first_row[i] = Nrows;
+        Nrows += (pt.type == BIP_FIT_VLE) ? 2 : 1;
+    }
+}
+
+std::vector<double> BinaryInteractionFitter::get_parameters() const {
+    std::vector<double> parameters(parameter_names.size());
+    for (std::size_t k = 0; k < parameter_names.size(); ++k) {
+        parameters[k] = HEOS->get_binary_interaction_double(0, 1, parameter_names[k]);
+    }
+    return parameters;
+}
+
+void BinaryInteractionFitter::set_parameters(const std::vector<double>& parameters) {
+    if (parameters.size() != parameter_names.size()) {
+        throw ValueError(format("Length of parameter vector [%d] does not match the number of parameters [%d]", parameters.size(),
+                                parameter_names.size()));
+    }
+    for (std::size_t k = 0; k < parameter_names.size(); ++k) {
+        HEOS->set_binary_interaction_double(0, 1, parameter_names[k], parameters[k]);
+    }
+}
+
+BIPFitResult BinaryInteractionFitter::evaluate(const std::vector<double>& parameters) {
+    set_parameters(parameters);
+
+    BIPFitResult result;
+    result.residuals.resize(Nrows, std::numeric_limits<double>::quiet_NaN());
+    result.jacobian.resize(Nrows, std::vector<double>(parameter_names.size(), 0.0));
+    result.errors.resize(points.size());
+
+    // Split the points into contiguous blocks, one for each thread, and give each block its own copy of the state
+    long Nblocks = 1;
+#ifdef _OPENMP
+    Nblocks = static_cast<long>(omp_get_max_threads());
+#endif
+    Nblocks = std::max(1L, std::min(Nblocks, static_cast<long>(points.size())));
+    const std::size_t block_size = (points.size() + Nblocks - 1) / Nblocks;
+
+#ifdef _OPENMP
+#    pragma omp parallel for schedule(static)
+#endif
+    for (long iblock = 0; iblock < Nblocks; ++iblock) {
+        std::size_t ibegin = iblock * block_size, iend = std::min(points.size(), ibegin + block_size);
+        shared_ptr<HelmholtzEOSMixtureBackend> state;
+        try {
+            state.reset(HEOS->get_copy(false));
+        } catch (std::exception& e) {
+            for (std::size_t i = ibegin; i < iend; ++i) {
+                result.errors[i] = e.what();
+            }
+            continue;
+        }
+        for (std::size_t i = ibegin; i < iend; ++i) {
+            // Each point writes only to its own rows of the result
+            try {
+                evaluate_point(*state, i, result);
+            } catch (std::exception& e) {
+                result.errors[i] = e.what();
+                std::size_t Nrows_point = (points[i].type == BIP_FIT_VLE) ? 2 : 1;
+                for (std::size_t r = first_row[i]; r < first_row[i] + Nrows_point; ++r) {
+                    result.residuals[r] = std::numeric_limits<double>::quiet_NaN();
+                    std::fill(result.jacobian[r].begin(), result.jacobian[r].end(), 0.0);
+                }
+            }
+            state->unspecify_phase();
+        }
+    }
+    return result;
+}
+
+void BinaryInteractionFitter::dp_dparameters__constT_rho(HelmholtzEOSMixtureBackend& state, std::vector<double>& dp_dparam) const {
+    // p = rho*R*T*(1 + delta*dalphar_ddelta)
+    double rhomolar = state.rhomolar(), T = state.T(), R = state.gas_constant();
+    double delta = state.delta(), rhor = state.rhomolar_reducing();
+    const std::vector<CoolPropDbl>& x = state.get_mole_fractions();
+    dp_dparam.resize(parameter_names.size());
+    for (std::size_t k = 0; k < parameter_names.size(); ++k) {
+        ReducingParameterDerivatives d = get_reducing_parameter_derivatives(state, parameter_names[k]);
+        double dtau = d.dTr / T, ddelta = -delta / rhor * d.drhor;
+        double d_deltadalphardDelta = delta * state.d2alphar_dDelta_dTau() * dtau + (state.dalphar_dDelta() + delta * state.d2alphar_dDelta2()) * ddelta;
+        if (d.departure) {
+            d_deltadalphardDelta += delta * x[0] * x[1] * state.residual_helmholtz->Excess.DepartureFunctionMatrix[0][1]->dalphar_dDelta();
+        }
+        dp_dparam[k] = rhomolar * R * T * d_deltadalphardDelta;
+    }
+}
+
+void BinaryInteractionFitter::dlnf_dparameters__constT_rho(HelmholtzEOSMixtureBackend& state, std::size_t i, std::vector<double>& dlnf_dparam) const {
+    // ln(f_i) = ln(x_i*rho*R*T) + alphar + n*(dalphar/dn_i), with
+    // n*(dalphar/dn_i) = delta*alphar_delta*(1-n*(drhor/dn_i)/rhor) + tau*alphar_tau*n*(dTr/dn_i)/Tr + alphar_xi - sum_k x_k*alphar_xk
+    const x_N_dependency_flag xN_flag = XN_INDEPENDENT;
+    double T = state.T(), tau = state.tau(), delta = state.delta();
+    double Tr = state.T_reducing(), rhor = state.rhomolar_reducing();
+    const std::vector<CoolPropDbl>& x = state.get_mole_fractions();
+    std::size_t N = x.size();
+
+    double ar_t = state.dalphar_dTau(), ar_d = state.dalphar_dDelta();
+    double ar_tt = state.d2alphar_dTau2(), ar_dt = state.d2alphar_dDelta_dTau(), ar_dd = state.d2alphar_dDelta2();
+    double ndrhordni = state.Reducing->ndrhorbardni__constnj(x, i, xN_flag);
+    double ndTrdni = state.Reducing->ndTrdni__constnj(x, i, xN_flag);
+
+    // Derivatives of alphar_xi - sum_k x_k*alphar_xk with respect to tau and delta
+    double dD_dtau = state.residual_helmholtz->d2alphar_dxi_dTau(state, i, xN_flag);
+    double dD_ddelta = state.residual_helmholtz->d2alphar_dxi_dDelta(state, i, xN_flag);
+    for (std::size_t k = 0; k < N; ++k) {
+        dD_dtau -= x[k] * state.residual_helmholtz->d2alphar_dxi_dTau(state, k, xN_flag);
+        dD_ddelta -= x[k] * state.residual_helmholtz->d2alphar_dxi_dDelta(state, k, xN_flag);
+    }
+
+    dlnf_dparam.resize(parameter_names.size());
+    for (std::size_t k = 0; k < parameter_names.size(); ++k) {
+        ReducingParameterDerivatives d = get_reducing_parameter_derivatives(state, parameter_names[k]);
+        double dtau = d.dTr / T, ddelta = -delta / rhor * d.drhor;
+
+        // The terms due to the change in tau and delta
+        double val = ar_t * dtau + ar_d * ddelta;
+        val += (delta * ar_dt * dtau + (ar_d + delta * ar_dd) * ddelta) * (1 - ndrhordni / rhor);
+        val += ((ar_t + tau * ar_tt) * dtau + tau * ar_dt * ddelta) * ndTrdni / Tr;
+        val += dD_dtau * dtau + dD_ddelta * ddelta;
+
+        // The terms due to the change in the composition derivatives of the reducing functions
+        val += delta * ar_d * (-d.dndrhorbardni[i] / rhor + ndrhordni * d.drhor / (rhor * rhor));
+        val += tau * ar_t * (d.dndTrdni[i] / Tr - ndTrdni * d.dTr / (Tr * Tr));
+
+        // The terms due to the departure function multiplier; alphar^E = x_0*x_1*F_01*alphar_01
+        if (d.departure) {
+            DepartureFunction& dep = *(state.residual_helmholtz->Excess.DepartureFunctionMatrix[0][1]);
+            double x0x1 = x[0] * x[1];
+            val += x0x1 * dep.alphar();
+            val += delta * x0x1 * dep.dalphar_dDelta() * (1 - ndrhordni / rhor);
+            val += tau * x0x1 * dep.dalphar_dTau() * ndTrdni / Tr;
+            val += (x[1 - i] - 2 * x0x1) * dep.alphar();
+        }
+        dlnf_dparam[k] = val;
+    }
+}
+
+void BinaryInteractionFitter::evaluate_point(HelmholtzEOSMixtureBackend& state, std::size_t i, BIPFitResult& result) const {
+    const BIPFitDataPoint& pt = points[i];
+    std::size_t row = first_row[i], Nparam = parameter_names.size();
+    std::vector<double> dp_dparam;
+
+    switch (pt.type) {
+        case BIP_FIT_DENSITY: {
+            state.set_mole_fractions(pt.x);
+            state.update(PT_INPUTS, pt.p, pt.T);
+            double dpdrho = state.first_partial_deriv(iP, iDmolar, iT);
+            dp_dparameters__constT_rho(state, dp_dparam);
+            result.residuals[row] = pt.weight * (state.rhomolar() / pt.rhomolar - 1);
+            for (std::size_t k = 0; k < Nparam; ++k) {
+                // Implicit function theorem at constant T and p
+                result.jacobian[row][k] = pt.weight * (-dp_dparam[k] / dpdrho) / pt.rhomolar;
+            }
+            break;
+        }
+        case BIP_FIT_PRESSURE: {
+            state.set_mole_fractions(pt.x);
+            state.update_DmolarT_direct(pt.rhomolar, pt.T);
+            dp_dparameters__constT_rho(state, dp_dparam);
+            result.residuals[row] = pt.weight * (state.p() / pt.p - 1);
+            for (std::size_t k = 0; k < Nparam; ++k) {
+                result.jacobian[row][k] = pt.weight * dp_dparam[k] / pt.p;
+            }
+            break;
+        }
+        case BIP_FIT_VLE: {
+            // ln(f_i) and its derivatives in the liquid (sign = +1) and the vapor (sign = -1)
+            std::vector<double> dlnf_dparam;
+            for (int iphase = 0; iphase < 2; ++iphase) {
+                double sign = (iphase == 0) ? 1 : -1;
+                state.set_mole_fractions((iphase == 0) ? pt.x : pt.y);
+                state.specify_phase((iphase == 0) ? iphase_liquid : iphase_gas);
+                state.update(PT_INPUTS, pt.p, pt.T);
+                state.unspecify_phase();
+                double dpdrho = state.first_partial_deriv(iP, iDmolar, iT);
+                dp_dparameters__constT_rho(state, dp_dparam);
+                for (std::size_t j = 0; j < 2; ++j) {
+                    double lnf = log(MixtureDerivatives::fugacity_i(state, j, XN_INDEPENDENT));
+                    double dlnf_drho = MixtureDerivatives::dln_fugacity_i_drho__constT_n(state, j, XN_INDEPENDENT);
+                    dlnf_dparameters__constT_rho(state, j, dlnf_dparam);
+                    if (iphase == 0) {
+                        result.residuals[row + j] = 0;
+                    }
+                    result.residuals[row + j] += sign * pt.weight * lnf;
+                    for (std::size_t k = 0; k < Nparam; ++k) {
+                        // d(ln f)/dparam at constant T and p, the density changing with the parameter
+                        double drho_dparam = -dp_dparam[k] / dpdrho;
+                        result.jacobian[row + j][k] += sign * pt.weight * (dlnf_dparam[k] + dlnf_drho * drho_dparam);
+                    }
+                }
+            }
+            break;
+        }
+        default:
+            throw ValueError(format("Invalid data point type [%d]", pt.type));
+    }
+}
+
+} /* namespace CoolProp */
+
+#ifdef ENABLE_CATCH
+#    include <catch2/catch_all.hpp>
+
+TEST_CASE("Check the analytic derivatives of the binary interaction parameter fitter", "[fitter]") {
+    std::vector<std::string> fluids;
+    fluids.push_back("Methane");
+    fluids.push_back("Ethane");
+    std::vector<std::string> names;
+    names.push_back("betaT");
+    names.push_back("gammaT");
+    names.push_back("betaV");
+    names.push_back("gammaV");
+    names.push_back("Fij");
+
+    std::vector<CoolProp::BIPFitDataPoint> points;
+    CoolProp::BIPFitDataPoint pt;
+    pt.x.push_back(0.4);
+    pt.x.push_back(0.6);
+    pt.type = CoolProp::BIP_FIT_DENSITY;
+    pt.T = 300;
+    pt.p = 5e6;
+    pt.rhomolar = 3000;
+    points.push_back(pt);
+    pt.type = CoolProp::BIP_FIT_PRESSURE;
+    pt.T = 250;
+    pt.rhomolar = 12000;
+    pt.p = 1e7;
+    points.push_back(pt);
+    pt.type = CoolProp::BIP_FIT_VLE;
+    pt.T = 200;
+    pt.p = 1e6;
+    pt.x[0] = 0.05;
+    pt.x[1] = 0.95;
+    pt.y.push_back(0.6);
+    pt.y.push_back(0.4);
+    points.push_back(pt);
+
+    CoolProp::BinaryInteractionFitter fitter(fluids, names, points);
+    std::vector<double> params = fitter.get_parameters();
+    CoolProp::BIPFitResult result = fitter.evaluate(params);
+    REQUIRE(result.residuals.size() == 4);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        CAPTURE(result.errors[i]);
+        CHECK(result.errors[i].empty());
+    }
+    for (std::size_t k = 0; k < names.size(); ++k) {
+        // Centered finite difference with respect to parameter k
+        double h = 1e-6;
+        std::vector<double> pplus = params, pminus = params;
+        pplus[k] += h;
+        pminus[k] -= h;
+        CoolProp::BIPFitResult rplus = fitter.evaluate(pplus), rminus = fitter.evaluate(pminus);
+        for (std::size_t r = 0; r < result.residuals.size(); ++r) {
+            double numerical = (rplus.residuals[r] - rminus.residuals[r]) / (2 * h);
+            double analytic = result.jacobian[r][k];
+            CAPTURE(names[k]);
+            CAPTURE(r);
+            CAPTURE(numerical);
+            CAPTURE(analytic);
+            CHECK(std::abs(analytic - numerical) < 1e-6 * std::max(1.0, std::abs(numerical)));
+        }
+    }
+}
+
+#    ifdef _OPENMP
+TEST_CASE("The parallel evaluation of the binary interaction parameter fitter agrees with the serial one", "[fitter]") {
+    std::vector<std::string> fluids;
+    fluids.push_back("Methane");
+    fluids.push_back("Ethane");
+    std::vector<std::string> names;
+    names.push_back("betaT");
+    names.push_back("gammaT");
+
+    // Enough points for each of the threads to get a block of its own
+    std::vector<CoolProp::BIPFitDataPoint> points;
+    for (int i = 0; i < 12; ++i) {
+        CoolProp::BIPFitDataPoint pt;
+        pt.x.push_back(0.3 + 0.03 * i);
+        pt.x.push_back(0.7 - 0.03 * i);
+        pt.type = (i % 2 == 0) ? CoolProp::BIP_FIT_DENSITY : CoolProp::BIP_FIT_PRESSURE;
+        pt.T = 250 + 10 * i;
+        pt.p = 5e6;
+        pt.rhomolar = 3000;
+        points.push_back(pt);
+    }
+    CoolProp::BinaryInteractionFitter fitter(fluids, names, points);
+    std::vector<double> params = fitter.get_parameters();
+    params[0] *= 1.01;
+
+    const int max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    CoolProp::BIPFitResult serial = fitter.evaluate(params);
+    omp_set_num_threads(4);
+    CoolProp::BIPFitResult parallel = fitter.evaluate(params);
+    omp_set_num_threads(max_threads);
+
+    REQUIRE(serial.residuals.size() == parallel.residuals.size());
+    for (std::size_t r = 0; r < serial.residuals.size(); ++r) {
+        CAPTURE(r);
+        CHECK(ValidNumber(serial.residuals[r]));
+        CHECK(std::abs(parallel.residuals[r] - serial.residuals[r]) < 1e-10 * std::max(1.0, std::abs(serial.residuals[r])));
+        for (std::size_t k = 0; k < names.size(); ++k) {
+            CHECK(std::abs(parallel.jacobian[r][k] - serial.jacobian[r][k]) < 1e-10 * std::max(1.0, std::abs(serial.jacobian[r][k])));
+        }
+    }
+    CHECK(std::abs(parallel.sum_squares() - serial.sum_squares()) < 1e-10 * std::max(1.0, serial.sum_squares()));
+}
+#    endif
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef BINARYINTERACTIONFITTER_H
+#define BINARYINTERACTIONFITTER_H
+
+#include "HelmholtzEOSMixtureBackend.h"
+
+namespace CoolProp {
+
+/// The types of experimental data points that can be used to fit the binary interaction parameters
+enum bip_fit_point_types
+{
+    BIP_FIT_DENSITY,   ///< Density at given (T, p, x); the residual is rho_calc/rho_exp - 1
+    BIP_FIT_PRESSURE,  ///< Pressure at given (T, rho, x); the residual is p_calc/p_exp - 1
+    BIP_FIT_VLE        ///< Coexisting liquid (x) and vapor (y) at (T, p); one residual ln(f_i^L/f_i^V) per component
+};
+
+/// One experimental data point for the fitting of the binary interaction parameters
+struct BIPFitDataPoint
+{
+    bip_fit_point_types type;  ///< The type of the data point
+    double T,                  ///< temperature in K
+      p,                       ///< pressure in Pa (not used for BIP_FIT_PRESSURE as an input)
+      rhomolar,                ///< molar density in mol/m^3 (only used for BIP_FIT_DENSITY and BIP_FIT_PRESSURE)
+      weight;                  ///< The weight that multiplies the residual(s) of this point
+    std::vector<double> x,     ///< The bulk composition, or the liquid composition for BIP_FIT_VLE
+      y;                       ///< The vapor composition (only used for BIP_FIT_VLE)
+    BIPFitDataPoint() : type(BIP_FIT_DENSITY), T(_HUGE), p(_HUGE), rhomolar(_HUGE), weight(1.0){};
+};
+
+/// The residuals and their derivatives for one evaluation of the data set
+struct BIPFitResult
+{
+    std::vector<double> residuals;             ///< The weighted residuals, one or more per data point (NaN if the point could not be evaluated)
+    std::vector<std::vector<double>> jacobian;  ///< The derivatives of the residuals with respect to the parameters; one row per residual
+    std::vector<std::string> errors;           ///< One entry per data point, empty if the point was evaluated successfully
+    /// The weighted sum of squares of the residuals that could be evaluated
+    double sum_squares() const;
+};
+
+/**
+ * @brief A kernel for the fitting of the binary interaction parameters of a binary mixture
+ *
+ * For a given vector of the parameters (any of "betaT", "gammaT", "betaV", "gammaV" and "Fij"),
+ * the residuals of all the data points are evaluated together with their analytic derivatives with respect
+ * to the parameters.  The derivatives are obtained from the derivatives of the reducing functions and the
+ * departure function; the densities of the phases are differentiated at constant temperature and pressure
+ * with the implicit function theorem.
+ *
+ * The data set is split into blocks, each of which is evaluated with its own copy of the state class.
+ * When compiled with OpenMP (see the COOLPROP_OPENMP CMake option), the blocks are evaluated in parallel.
+ */
+class BinaryInteractionFitter
+{
+   protected:
+    shared_ptr<HelmholtzEOSMixtureBackend> HEOS;  ///< The state class that holds the current values of the parameters
+    std::vector<std::string> parameter_names;
+    std::vector<BIPFitDataPoint> points;
+    std::vector<std::size_t> first_row;  ///< The index of the first residual of each point
+    std::size_t Nrows;
+
+    /// Evaluate the residual(s) of one point and their derivatives, and store them in the result
+    void evaluate_point(HelmholtzEOSMixtureBackend& state, std::size_t i, BIPFitResult& result) const;
+    /// The derivative of the pressure with respect to each of the parameters at constant temperature, density and composition
+    void dp_dparameters__constT_rho(HelmholtzEOSMixtureBackend& state, std::vector<double>& dp_dparam) const;
+    /// The derivative of the logarithm of the fugacity of component i with respect to each of the parameters at constant temperature,
+    /// density and composition
+    void dlnf_dparameters__constT_rho(HelmholtzEOSMixtureBackend& state, std::size_t i, std::vector<double>& dlnf_dparam) const;
+
+   public:
+    /**
+     * @brief Set up the fitter
+     * @param fluid_names The names of the two components
+     * @param parameter_names The names of the parameters to be fitted, any of "betaT", "gammaT", "betaV", "gammaV" and "Fij"
+     * @param points The experimental data points
+     */
+    BinaryInteractionFitter(const std::vector<std::string>& fluid_names, const std::vector<std::string>& parameter_names,
+                            const std::vector<BIPFitDataPoint>& points);
+
+    /// The total number of residuals
+    std::size_t number_of_residuals() const {
+        return Nrows;
+    };
+    /// The index of the first residual that belongs to the data point i
+    std::size_t first_residual(std::size_t i) const {
+        return first_row[i];
+    };
+    /// Get the current values of the parameters
+    std::vector<double> get_parameters() const;
+    /// Set the values of the parameters, in the same order as the names passed to the constructor
+    void set_parameters(const std::vector<double>& parameters);
+    /// Evaluate the residuals of all the data points and their derivatives for the given values of the parameters
+    BIPFitResult evaluate(const std::vector<double>& parameters);
+};
+
+} /* namespace CoolProp */
+#endif /* BINARYINTERACTIONFITTER_H */
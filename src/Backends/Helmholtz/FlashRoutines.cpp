@@ -4,10 +4,11 @@
 #include "HelmholtzEOSBackend.h"
 #include "PhaseEnvelopeRoutines.h"
 #include "Configuration.h"
+#include "Backends/Cubics/CubicBackend.h"
+#include "externals/IF97/IF97.h"
 
 #if defined(ENABLE_CATCH)
 #    include <catch2/catch_all.hpp>
-#    include "Backends/Cubics/CubicBackend.h"
 #endif
 
 namespace CoolProp {
@@ -30,7 +31,7 @@ void FlashRoutines::PT_flash_mixtures(HelmholtzEOSMixtureBackend& HEOS) {
             HEOS.specify_phase(iphase_gas);
             try {
                 // Try using Newton's method
-                CoolPropDbl rhomolar = Newton(resid, rhomolar_guess, 1e-10, 100);
+                CoolPropDbl rhomolar = Newton(resid, rhomolar_guess, HEOS.solver_tolerance(1e-10), 100);
                 // Make sure the solution is within the bounds
                 if (!is_in_closed_range(static_cast<CoolPropDbl>(closest_state.rhomolar), static_cast<CoolPropDbl>(0.0), rhomolar)) {
                     throw ValueError("out of range");
@@ -38,7 +39,8 @@ void FlashRoutines::PT_flash_mixtures(HelmholtzEOSMixtureBackend& HEOS) {
                 HEOS.update_DmolarT_direct(rhomolar, HEOS._T);
             } catch (...) {
                 // If that fails, try a bounded solver
-                CoolPropDbl rhomolar = Brent(resid, closest_state.rhomolar, 1e-10, DBL_EPSILON, 1e-10, 100);
+                CoolPropDbl rhomolar =
+                  Brent(resid, closest_state.rhomolar, 1e-10, DBL_EPSILON, HEOS.solver_tolerance(1e-10, closest_state.rhomolar), 100);
                 // Make sure the solution is within the bounds
                 if (!is_in_closed_range(static_cast<CoolPropDbl>(closest_state.rhomolar), static_cast<CoolPropDbl>(0.0), rhomolar)) {
                     throw ValueError("out of range");
@@ -87,6 +89,9 @@ void FlashRoutines::PT_flash_mixtures(HelmholtzEOSMixtureBackend& HEOS) {
 }
 void FlashRoutines::PT_flash(HelmholtzEOSMixtureBackend& HEOS) {
     if (HEOS.is_pure_or_pseudopure) {
+        if (IF97_guesses_enabled(HEOS) && PT_flash_IF97_seeded(HEOS)) {
+            return;
+        }
         if (HEOS.imposed_phase_index == iphase_not_imposed)  // If no phase index is imposed (see set_components function)
         {
             // At very low temperature (near the triple point temp), the isotherms are VERY steep
@@ -214,7 +219,7 @@ void FlashRoutines::DP_flash(HelmholtzEOSMixtureBackend& HEOS) {
             // Then, do the solver using the full EOS
             solver_DP_resid resid(&HEOS, HEOS.rhomolar(), HEOS.p());
             std::string errstr;
-            Halley(resid, T0, 1e-10, 100);
+            Halley(resid, T0, HEOS.solver_tolerance(1e-10), 100, HEOS.solver_tolerance(1e-12));
             HEOS._Q = -1;
             // Update the state for conditions where the state was guessed
             HEOS.recalculate_singlephase_phase();
@@ -265,7 +270,7 @@ void FlashRoutines::DQ_flash(HelmholtzEOSMixtureBackend& HEOS) {
             throw CoolProp::OutOfRangeError(format("DQ inputs are not defined for density (%g) above critical density (%g) and Q>0", rhomolar, HEOS.rhomolar_critical()).c_str());
         }
         DQ_flash_residual resid(HEOS, rhomolar, Q);
-        Brent(resid, Tmin, Tmax, DBL_EPSILON, 1e-10, 100);
+        Brent(resid, Tmin, Tmax, DBL_EPSILON, HEOS.solver_tolerance(1e-10, Tmax), 100);
         HEOS._p = HEOS.SatV->p();
         HEOS._T = HEOS.SatV->T();
         HEOS._rhomolar = rhomolar;
@@ -408,6 +413,8 @@ void FlashRoutines::QT_flash(HelmholtzEOSMixtureBackend& HEOS) {
     } else {
         if (HEOS.PhaseEnvelope.built) {
             PT_Q_flash_mixtures(HEOS, iT, HEOS._T);
+        } else if (cubic_guesses_enabled(HEOS) && saturation_mixture_cubic_seeded(HEOS, iT)) {
+            // Converged from the guesses of the cubic model
         } else {
             // Set some input options
             SaturationSolvers::mixture_VLE_IO options;
@@ -653,6 +660,8 @@ void FlashRoutines::PQ_flash(HelmholtzEOSMixtureBackend& HEOS) {
     } else {
         if (HEOS.PhaseEnvelope.built) {
             PT_Q_flash_mixtures(HEOS, iP, HEOS._p);
+        } else if (cubic_guesses_enabled(HEOS) && saturation_mixture_cubic_seeded(HEOS, iP)) {
+            // Converged from the guesses of the cubic model
         } else {
 
             // Set some input options
@@ -1045,7 +1054,7 @@ void FlashRoutines::HSU_D_flash_twophase(HelmholtzEOSMixtureBackend& HEOS, CoolP
     HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
     Tmin_sat = std::max(Tmin_satL, Tmin_satV) - 1e-13;
 
-    Brent(resid, Tmin_sat, Tmax_sat - 0.01, DBL_EPSILON, 1e-12, 20);
+    Brent(resid, Tmin_sat, Tmax_sat - 0.01, DBL_EPSILON, HEOS.solver_tolerance(1e-12, Tmax_sat), 20);
     // Solve once more with the final vapor quality
     HEOS.update(QT_INPUTS, resid.Qd, HEOS.T());
 }
@@ -1173,9 +1182,10 @@ void FlashRoutines::HSU_D_flash(HelmholtzEOSMixtureBackend& HEOS, parameters oth
             if (value > Sat->keyed_output(other)) {
                 solver_resid resid(&HEOS, HEOS._rhomolar, value, other, Sat->keyed_output(iT), HEOS.Tmax() * 1.5);
                 try {
-                    HEOS._T = Halley(resid, 0.5 * (Sat->keyed_output(iT) + HEOS.Tmax() * 1.5), 1e-10, 100);
+                    HEOS._T = Halley(resid, 0.5 * (Sat->keyed_output(iT) + HEOS.Tmax() * 1.5), HEOS.solver_tolerance(1e-10), 100,
+                                     HEOS.solver_tolerance(1e-12));
                 } catch (...) {
-                    HEOS._T = Brent(resid, Sat->keyed_output(iT), HEOS.Tmax() * 1.5, DBL_EPSILON, 1e-12, 100);
+                    HEOS._T = Brent(resid, Sat->keyed_output(iT), HEOS.Tmax() * 1.5, DBL_EPSILON, HEOS.solver_tolerance(1e-12, HEOS.Tmax()), 100);
                 }
                 HEOS._Q = 10000;
                 HEOS._p = HEOS.calc_pressure_nocache(HEOS.T(), HEOS.rhomolar());
@@ -1239,9 +1249,10 @@ void FlashRoutines::HSU_D_flash(HelmholtzEOSMixtureBackend& HEOS, parameters oth
                 solver_resid resid(&HEOS, HEOS._rhomolar, value, other, TVtriple, HEOS.Tmax() * 1.5);
                 HEOS._phase = iphase_gas;
                 try {
-                    HEOS._T = Halley(resid, 0.5 * (TVtriple + HEOS.Tmax() * 1.5), DBL_EPSILON, 100);
+                    HEOS._T = Halley(resid, 0.5 * (TVtriple + HEOS.Tmax() * 1.5), HEOS.solver_tolerance(DBL_EPSILON), 100,
+                                     HEOS.solver_tolerance(1e-12));
                 } catch (...) {
-                    HEOS._T = Brent(resid, TVtriple, HEOS.Tmax() * 1.5, DBL_EPSILON, 1e-12, 100);
+                    HEOS._T = Brent(resid, TVtriple, HEOS.Tmax() * 1.5, DBL_EPSILON, HEOS.solver_tolerance(1e-12, HEOS.Tmax()), 100);
                 }
                 HEOS._Q = 10000;
                 HEOS.calc_pressure();
@@ -1280,9 +1291,10 @@ void FlashRoutines::HSU_D_flash(HelmholtzEOSMixtureBackend& HEOS, parameters oth
                 solver_resid resid(&HEOS, HEOS._rhomolar, value, other, TLtriple, HEOS.Tmax() * 1.5);
                 HEOS._phase = iphase_liquid;
                 try {
-                    HEOS._T = Halley(resid, 0.5 * (TLtriple + HEOS.Tmax() * 1.5), DBL_EPSILON, 100);
+                    HEOS._T = Halley(resid, 0.5 * (TLtriple + HEOS.Tmax() * 1.5), HEOS.solver_tolerance(DBL_EPSILON), 100,
+                                     HEOS.solver_tolerance(1e-12));
                 } catch (...) {
-                    HEOS._T = Brent(resid, TLtriple, HEOS.Tmax() * 1.5, DBL_EPSILON, 1e-12, 100);
+                    HEOS._T = Brent(resid, TLtriple, HEOS.Tmax() * 1.5, DBL_EPSILON, HEOS.solver_tolerance(1e-12, HEOS.Tmax()), 100);
                 }
                 HEOS._Q = 10000;
                 HEOS.calc_pressure();
@@ -1298,6 +1310,361 @@ void FlashRoutines::HSU_D_flash(HelmholtzEOSMixtureBackend& HEOS, parameters oth
         throw NotImplementedError("PHSU_D_flash not ready for mixtures");
 }
 
+bool FlashRoutines::DU_flash_singlephase_Newton(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl rhomolar, CoolPropDbl umolar, CoolPropDbl T0) {
+    CoolPropDbl T = T0;
+    bool converged = false;
+    try {
+        for (int iter = 0; iter < 30; ++iter) {
+            HEOS.update_DmolarT_direct(rhomolar, T);
+            // du/dT at constant density is cv
+            CoolPropDbl dT = -(HEOS.umolar() - umolar) / HEOS.cvmolar();
+            if (!ValidNumber(dT)) {
+                return false;
+            }
+            if (std::abs(dT) < HEOS.solver_tolerance(1e-12) * T) {
+                converged = true;
+                break;
+            }
+            // Never more than halve or double the temperature in one step
+            T = std::min(2 * T, std::max(0.5 * T, T + dT));
+        }
+    } catch (std::exception&) {
+        return false;
+    }
+    if (!converged) {
+        return false;
+    }
+    CoolProp::CoolPropFluid& component = HEOS.components[0];
+    if (T < HEOS.Ttriple()) {
+        // Possibly solid; the full flash decides
+        return false;
+    }
+    CoolPropDbl Tmax_sat = HEOS.calc_Tmax_sat();
+    if (T <= Tmax_sat) {
+        // Too close to the critical point for the ancillaries to be trusted
+        if (T > 0.98 * Tmax_sat) {
+            return false;
+        }
+        // The stable liquid is denser than the saturated liquid and at a higher pressure than the bubble point; the stable vapor is
+        // less dense than the saturated vapor and at a lower pressure than the dew point.  The margins cover the errors of the ancillaries.
+        bool stable;
+        if (rhomolar > HEOS.rhomolar_critical()) {
+            stable = rhomolar > 0.95 * component.ancillaries.rhoL.evaluate(T) && HEOS.p() > 1.02 * component.ancillaries.pL.evaluate(T);
+        } else {
+            stable = rhomolar < 1.05 * component.ancillaries.rhoV.evaluate(T) && HEOS.p() < 0.98 * component.ancillaries.pV.evaluate(T);
+        }
+        if (!stable) {
+            return false;
+        }
+    }
+    HEOS._Q = 10000;
+    HEOS.recalculate_singlephase_phase();
+    return true;
+}
+
+/// Closer than this to the IF97 saturation temperature (in K), the flashes seeded from IF97 use the saturation state
+static const double IF97_SATURATION_MARGIN = 0.5;
+
+bool FlashRoutines::IF97_guesses_enabled(HelmholtzEOSMixtureBackend& HEOS) {
+    return get_config_bool(HEOS_WATER_IF97_GUESSES) && HEOS.is_pure_or_pseudopure && HEOS.components[0].CAS == "7732-18-5"
+           && HEOS.imposed_phase_index == iphase_not_imposed && HEOS.SatL && HEOS.SatV;
+}
+
+bool FlashRoutines::singlephase_Newton_DT(HelmholtzEOSMixtureBackend& HEOS, parameters in1, CoolPropDbl value1, parameters in2, CoolPropDbl value2,
+                                          CoolPropDbl T0, CoolPropDbl rhomolar0) {
+    CoolPropDbl T = T0, rhomolar = rhomolar0;
+    try {
+        for (int iter = 0; iter < 20; ++iter) {
+            HEOS.update_DmolarT_direct(rhomolar, T);
+            CoolPropDbl r1 = HEOS.keyed_output(in1) - value1, r2 = HEOS.keyed_output(in2) - value2;
+            CoolPropDbl J11 = HEOS.first_partial_deriv(in1, iT, iDmolar), J12 = HEOS.first_partial_deriv(in1, iDmolar, iT);
+            CoolPropDbl J21 = HEOS.first_partial_deriv(in2, iT, iDmolar), J22 = HEOS.first_partial_deriv(in2, iDmolar, iT);
+            CoolPropDbl det = J11 * J22 - J12 * J21;
+            CoolPropDbl dT = -(J22 * r1 - J12 * r2) / det, drhomolar = -(J11 * r2 - J21 * r1) / det;
+            if (!ValidNumber(dT) || !ValidNumber(drhomolar)) {
+                return false;
+            }
+            if (std::abs(dT) < HEOS.solver_tolerance(1e-11) * T && std::abs(drhomolar) < HEOS.solver_tolerance(1e-11) * rhomolar) {
+                return true;
+            }
+            // Never more than halve or double the temperature or the density in one step
+            T = std::min(2 * T, std::max(0.5 * T, T + dT));
+            rhomolar = std::min(2 * rhomolar, std::max(0.5 * rhomolar, rhomolar + drhomolar));
+        }
+    } catch (std::exception&) {
+    }
+    return false;
+}
+
+bool FlashRoutines::IF97_seeded_singlephase_is_stable(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl T0, CoolPropDbl p0) {
+    CoolPropDbl T = HEOS.T(), p = HEOS.p();
+    if (HEOS.first_partial_deriv(iP, iDmolar, iT) <= 0) {
+        // Mechanically unstable
+        return false;
+    }
+    if (p > HEOS.p_critical() || T > HEOS.T_critical()) {
+        return true;
+    }
+    if (p < HEOS.p_triple()) {
+        return HEOS.rhomolar() < HEOS.rhomolar_critical();
+    }
+    // The seed and the solution must be on the same side of the saturation curve, the solution not too close to it
+    bool liquid_seed = (p0 >= HEOS.p_triple() && p0 < HEOS.p_critical() && T0 < IF97::Tsat97(p0));
+    CoolPropDbl Tsat = IF97::Tsat97(p);
+    if (liquid_seed) {
+        return T < Tsat - 0.1 * IF97_SATURATION_MARGIN && HEOS.rhomolar() > HEOS.rhomolar_critical();
+    } else {
+        return T > Tsat + 0.1 * IF97_SATURATION_MARGIN && HEOS.rhomolar() < HEOS.rhomolar_critical();
+    }
+}
+
+bool FlashRoutines::HSU_P_flash_IF97_seeded(HelmholtzEOSMixtureBackend& HEOS, parameters other, CoolPropDbl value) {
+    CoolPropDbl M = HEOS.molar_mass(), p = HEOS._p;
+    bool done = false;
+    try {
+        double T0 = (other == iHmolar) ? IF97::T_phmass(p, value / M) : IF97::T_psmass(p, value / M);
+        bool near_saturation = false;
+        if (p >= HEOS.p_triple() && p < HEOS.p_critical()) {
+            near_saturation = std::abs(T0 - IF97::Tsat97(p)) < IF97_SATURATION_MARGIN;
+        }
+        if (near_saturation) {
+            // The saturation state at this pressure, starting from the IF97 one
+            SaturationSolvers::saturation_PHSU_pure_options options;
+            options.specified_variable = SaturationSolvers::saturation_PHSU_pure_options::IMPOSED_PL;
+            options.use_logdelta = false;
+            options.T = IF97::Tsat97(p);
+            options.rhoL = IF97::rholiq_p(p) / M;
+            options.rhoV = IF97::rhovap_p(p) / M;
+            SaturationSolvers::saturation_PHSU_pure(HEOS, p, options);
+            CoolPropDbl yL = HEOS.SatL->keyed_output(other), yV = HEOS.SatV->keyed_output(other);
+            CoolPropDbl Q = (value - yL) / (yV - yL);
+            if (Q >= -1e-9 && Q <= 1 + 1e-9) {
+                HEOS._phase = iphase_twophase;
+                HEOS._Q = Q;
+                HEOS._T = HEOS.SatL->T();
+                HEOS._rhoLmolar = HEOS.SatL->rhomolar();
+                HEOS._rhoVmolar = HEOS.SatV->rhomolar();
+                HEOS._rhomolar = 1 / (Q / HEOS.SatV->rhomolar() + (1 - Q) / HEOS.SatL->rhomolar());
+                return true;
+            }
+            // Single-phase; start at the saturated state on its side, the stable solution is colder and denser than the saturated
+            // liquid, or hotter and lighter than the saturated vapor
+            shared_ptr<HelmholtzEOSMixtureBackend> Sat = (Q < 0) ? HEOS.SatL : HEOS.SatV;
+            CoolPropDbl Tsat = Sat->T(), rhosat = Sat->rhomolar();
+            if (singlephase_Newton_DT(HEOS, iP, p, other, value, Tsat, rhosat)) {
+                done = (Q < 0) ? (HEOS.T() < Tsat && HEOS.rhomolar() > rhosat) : (HEOS.T() > Tsat && HEOS.rhomolar() < rhosat);
+            }
+        } else {
+            CoolPropDbl rhomolar0 = IF97::rhomass_Tp(T0, p) / M;
+            done = singlephase_Newton_DT(HEOS, iP, p, other, value, T0, rhomolar0) && IF97_seeded_singlephase_is_stable(HEOS, T0, p);
+        }
+    } catch (std::exception&) {
+        done = false;
+    }
+    if (done) {
+        HEOS._p = p;
+        HEOS._Q = -1;
+        HEOS.recalculate_singlephase_phase();
+    } else {
+        // Back to the inputs for the full flash
+        HEOS.clear();
+        HEOS._p = p;
+        if (other == iHmolar) {
+            HEOS._hmolar = value;
+        } else {
+            HEOS._smolar = value;
+        }
+    }
+    return done;
+}
+
+bool FlashRoutines::HS_flash_IF97_seeded(HelmholtzEOSMixtureBackend& HEOS) {
+    CoolPropDbl M = HEOS.molar_mass(), hmolar = HEOS._hmolar, smolar = HEOS._smolar;
+    bool done = false;
+    try {
+        double p0 = IF97::p_hsmass(hmolar / M, smolar / M);
+        double T0 = IF97::T_phmass(p0, hmolar / M);
+        bool near_saturation = (IF97::BackwardRegion(p0, hmolar / M, IF97_HMASS) == 4);
+        if (p0 >= HEOS.p_triple() && p0 < HEOS.p_critical()) {
+            near_saturation = near_saturation || std::abs(T0 - IF97::Tsat97(p0)) < IF97_SATURATION_MARGIN;
+        }
+        if (!near_saturation) {
+            CoolPropDbl rhomolar0 = IF97::rhomass_Tp(T0, p0) / M;
+            done = singlephase_Newton_DT(HEOS, iHmolar, hmolar, iSmolar, smolar, T0, rhomolar0) && IF97_seeded_singlephase_is_stable(HEOS, T0, p0);
+        }
+    } catch (std::exception&) {
+        done = false;
+    }
+    if (done) {
+        HEOS._Q = -1;
+        HEOS.recalculate_singlephase_phase();
+    } else {
+        // Back to the inputs for the full flash
+        HEOS.clear();
+        HEOS._hmolar = hmolar;
+        HEOS._smolar = smolar;
+    }
+    return done;
+}
+
+bool FlashRoutines::PT_flash_IF97_seeded(HelmholtzEOSMixtureBackend& HEOS) {
+    CoolPropDbl M = HEOS.molar_mass(), p = HEOS._p, T = HEOS._T;
+    bool done = false;
+    try {
+        bool near_saturation = false;
+        if (p >= HEOS.p_triple() && p < HEOS.p_critical()) {
+            near_saturation = std::abs(T - IF97::Tsat97(p)) < IF97_SATURATION_MARGIN;
+        }
+        if (!near_saturation) {
+            CoolPropDbl rhomolar0 = IF97::rhomass_Tp(T, p) / M;
+            done = singlephase_Newton_DT(HEOS, iP, p, iT, T, T, rhomolar0) && IF97_seeded_singlephase_is_stable(HEOS, T, p);
+        }
+    } catch (std::exception&) {
+        done = false;
+    }
+    if (done) {
+        HEOS._p = p;
+        HEOS._T = T;
+        HEOS._Q = -1;
+        HEOS.recalculate_singlephase_phase();
+    } else {
+        // Back to the inputs for the full flash
+        HEOS.clear();
+        HEOS._p = p;
+        HEOS._T = T;
+    }
+    return done;
+}
+
+bool FlashRoutines::cubic_guesses_enabled(HelmholtzEOSMixtureBackend& HEOS) {
+    return get_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES) && !HEOS.is_pure_or_pseudopure && HEOS.SatL && HEOS.SatV
+           && dynamic_cast<AbstractCubicBackend*>(&HEOS) == NULL;
+}
+
+HelmholtzEOSMixtureBackend& FlashRoutines::get_cubic_guess_state(HelmholtzEOSMixtureBackend& HEOS) {
+    if (!HEOS.cubic_guess_state) {
+        std::size_t N = HEOS.components.size();
+        std::vector<double> Tc(N), pc(N), acentric(N);
+        for (std::size_t i = 0; i < N; ++i) {
+            Tc[i] = HEOS.get_fluid_constant(i, iT_critical);
+            pc[i] = HEOS.get_fluid_constant(i, iP_critical);
+            acentric[i] = HEOS.get_fluid_constant(i, iacentric_factor);
+        }
+        shared_ptr<HelmholtzEOSMixtureBackend> PR(new PengRobinsonBackend(Tc, pc, acentric, HEOS.gas_constant()));
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = i + 1; j < N; ++j) {
+                double kij = 0;
+                try {
+                    double betaT = HEOS.get_binary_interaction_double(i, j, "betaT"), gammaT = HEOS.get_binary_interaction_double(i, j, "gammaT");
+                    kij = 1 - 2 * betaT * gammaT / (1 + betaT * betaT);
+                } catch (...) {
+                    // Not a GERG-type reducing function; start from the default
+                }
+                PR->set_binary_interaction_double(i, j, "kij", fit_cubic_kij(HEOS, i, j, kij));
+            }
+        }
+        HEOS.cubic_guess_state = PR;
+    }
+    HEOS.cubic_guess_state->set_mole_fractions(HEOS.mole_fractions);
+    return *HEOS.cubic_guess_state;
+}
+
+double FlashRoutines::fit_cubic_kij(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, double kij0) {
+    try {
+        // The equimolar binary mixture of components i and j of HEOS, with the same interaction parameters
+        std::vector<CoolPropFluid> pair(2);
+        pair[0] = HEOS.components[i];
+        pair[1] = HEOS.components[j];
+        HelmholtzEOSMixtureBackend binary(pair, false);
+        const char* parameters[] = {"betaT", "gammaT", "betaV", "gammaV", "Fij"};
+        for (std::size_t k = 0; k < sizeof(parameters) / sizeof(parameters[0]); ++k) {
+            try {
+                binary.set_binary_interaction_double(0, 1, parameters[k], HEOS.get_binary_interaction_double(i, j, parameters[k]));
+            } catch (...) {
+                // Not a GERG-type reducing function; the binary mixture keeps its default
+            }
+        }
+        std::vector<CoolPropDbl> z(2, 0.5);
+        binary.set_mole_fractions(z);
+        double Tc = binary.T_critical();
+
+        std::vector<double> Tc_pure(2), pc(2), acentric(2);
+        for (std::size_t k = 0; k < 2; ++k) {
+            std::size_t l = (k == 0) ? i : j;
+            Tc_pure[k] = HEOS.get_fluid_constant(l, iT_critical);
+            pc[k] = HEOS.get_fluid_constant(l, iP_critical);
+            acentric[k] = HEOS.get_fluid_constant(l, iacentric_factor);
+        }
+        PengRobinsonBackend PR(Tc_pure, pc, acentric, HEOS.gas_constant(), false);
+        PR.set_mole_fractions(z);
+
+        // Secant iterations on kij for the critical temperature of the cubic model
+        double k0 = kij0, k1 = kij0 + 0.01;
+        PR.set_binary_interaction_double(0, 1, "kij", k0);
+        double f0 = PR.T_critical() - Tc;
+        for (int iter = 0; iter < 20; ++iter) {
+            PR.set_binary_interaction_double(0, 1, "kij", k1);
+            double f1 = PR.T_critical() - Tc;
+            if (std::abs(f1) < 1e-6 * Tc) {
+                return k1;
+            }
+            if (!ValidNumber(f1) || f1 == f0) {
+                break;
+            }
+            double k2 = k1 - f1 * (k1 - k0) / (f1 - f0);
+            k0 = k1;
+            f0 = f1;
+            k1 = k2;
+        }
+    } catch (std::exception&) {
+        // No single critical point of one of the binary mixtures; keep the starting value
+    }
+    return kij0;
+}
+
+bool FlashRoutines::saturation_mixture_cubic_seeded(HelmholtzEOSMixtureBackend& HEOS, parameters input) {
+    try {
+        HelmholtzEOSMixtureBackend& PR = get_cubic_guess_state(HEOS);
+        if (input == iT) {
+            PR.update(QT_INPUTS, HEOS._Q, HEOS._T);
+        } else {
+            PR.update(PQ_INPUTS, HEOS._p, HEOS._Q);
+        }
+
+        SaturationSolvers::newton_raphson_saturation NR;
+        SaturationSolvers::newton_raphson_saturation_options IO;
+
+        IO.bubble_point = (HEOS._Q < 0.5);
+        IO.x = PR.SatL->get_mole_fractions();
+        IO.y = PR.SatV->get_mole_fractions();
+        IO.rhomolar_liq = PR.SatL->rhomolar();
+        IO.rhomolar_vap = PR.SatV->rhomolar();
+        IO.T = PR.T();
+        IO.p = PR.p();
+        IO.Nstep_max = 30;
+        IO.imposed_variable = (input == iT) ? SaturationSolvers::newton_raphson_saturation_options::T_IMPOSED
+                                            : SaturationSolvers::newton_raphson_saturation_options::P_IMPOSED;
+
+        if (IO.bubble_point) {
+            // Compositions are z, z_incipient
+            NR.call(HEOS, IO.x, IO.y, IO);
+        } else {
+            // Compositions are z, z_incipient
+            NR.call(HEOS, IO.y, IO.x, IO);
+        }
+
+        // Reject the trivial solution, in which both phases have the bulk composition
+        const std::vector<CoolPropDbl>& x = HEOS.SatL->get_mole_fractions(), &y = HEOS.SatV->get_mole_fractions();
+        double max_diff = 0;
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            max_diff = std::max(max_diff, static_cast<double>(std::abs(x[i] - y[i])));
+        }
+        return max_diff > 1e-6 && std::abs(HEOS.SatL->rhomolar() / HEOS.SatV->rhomolar() - 1) > 1e-6;
+    } catch (...) {
+        return false;
+    }
+}
+
 void FlashRoutines::HSU_P_flash_singlephase_Newton(HelmholtzEOSMixtureBackend& HEOS, parameters other, CoolPropDbl T0, CoolPropDbl rhomolar0) {
     double A[2][2], B[2][2];
     CoolPropDbl y = _HUGE;
@@ -1323,7 +1690,7 @@ void FlashRoutines::HSU_P_flash_singlephase_Newton(HelmholtzEOSMixtureBackend& H
     bool failed = false;
     CoolPropDbl omega = 1.0, f2, df2_dtau, df2_ddelta;
     CoolPropDbl tau = _HEOS.tau(), delta = _HEOS.delta();
-    while (worst_error > 1e-6 && failed == false) {
+    while (worst_error > HEOS.solver_tolerance(1e-6) && failed == false) {
 
         // All the required partial derivatives
         CoolPropDbl a0 = _HEOS.calc_alpha0_deriv_nocache(0, 0, HEOS.mole_fractions, tau, delta, Tc, rhoc);
@@ -1479,7 +1846,7 @@ void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend& HE
 
     try {
         // First try to use Halley's method (including two derivatives)
-        Halley(resid, Tmin, 1e-12, 100);
+        Halley(resid, Tmin, HEOS.solver_tolerance(1e-12, value), 100, HEOS.solver_tolerance(1e-12));
         if (!is_in_closed_range(Tmin, Tmax, static_cast<CoolPropDbl>(resid.HEOS->T())) || resid.HEOS->phase() != phase) {
             throw ValueError("Halley's method was unable to find a solution in HSU_P_flash_singlephase_Brent");
         }
@@ -1489,7 +1856,7 @@ void FlashRoutines::HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend& HE
         try {
             resid.iter = 0;
             // Halley's method failed, so now we try Brent's method
-            Brent(resid, Tmin, Tmax, DBL_EPSILON, 1e-12, 100);
+            Brent(resid, Tmin, Tmax, DBL_EPSILON, HEOS.solver_tolerance(1e-12, Tmax), 100);
             // Un-specify the phase of the fluid
             HEOS.unspecify_phase();
         } catch (...) {
@@ -1536,6 +1903,9 @@ void FlashRoutines::HSU_P_flash(HelmholtzEOSMixtureBackend& HEOS, parameters oth
             throw ValueError(format("Input for other [%s] is invalid", get_parameter_information(other, "long").c_str()));
     }
     if (HEOS.is_pure_or_pseudopure) {
+        if (other != iUmolar && IF97_guesses_enabled(HEOS) && HSU_P_flash_IF97_seeded(HEOS, other, value)) {
+            return;
+        }
 
         // Find the phase, while updating all internal variables possible
         HEOS.p_phase_determination_pure_or_pseudopure(other, value, saturation_called);
@@ -1608,17 +1978,45 @@ void FlashRoutines::HSU_P_flash(HelmholtzEOSMixtureBackend& HEOS, parameters oth
             if (!twophase) {
                 PY_singlephase_flash_resid resid(HEOS, HEOS._p, other, value);
                 // If that fails, try a bounded solver
-                Brent(resid, closest_state.T + 10, 1000, DBL_EPSILON, 1e-10, 100);
+                Brent(resid, closest_state.T + 10, 1000, DBL_EPSILON, HEOS.solver_tolerance(1e-10, closest_state.T), 100);
                 HEOS.unspecify_phase();
             } else {
                 throw ValueError("two-phase solution for Y");
             }
 
+        } else if (HEOS.imposed_phase_index == iphase_gas || HEOS.imposed_phase_index == iphase_supercritical_gas
+                   || HEOS.imposed_phase_index == iphase_supercritical) {
+            // The phase is known, so the phase envelope is not needed
+            HSU_P_flash_mixture_gas(HEOS, other, value);
         } else {
             throw ValueError("phase envelope must be built to carry out HSU_P_flash for mixture");
         }
     }
 }
+void FlashRoutines::HSU_P_flash_mixture_gas(HelmholtzEOSMixtureBackend& HEOS, parameters other, CoolPropDbl value) {
+    // Newton's method in temperature at the given pressure.  The density at each temperature is found by the density solver in
+    // the imposed phase, starting from the density of the previous step, and the derivative is the isobaric derivative of h, s or u
+    CoolPropDbl p = HEOS._p, T = 1.5 * HEOS.T_reducing(), rhomolar = -1;
+    for (int iter = 0; iter < 50; ++iter) {
+        rhomolar = HEOS.solver_rho_Tp(T, p, rhomolar);
+        HEOS.update_DmolarT_direct(rhomolar, T);
+        CoolPropDbl dT = -(HEOS.keyed_output(other) - value) / HEOS.first_partial_deriv(other, iT, iP);
+        if (!ValidNumber(dT)) {
+            break;
+        }
+        // Limit the step, since far from the solution the derivative can be a poor estimate of the secant slope
+        dT = std::max(std::min(dT, 0.25 * T), -0.25 * T);
+        T += dT;
+        if (std::abs(dT) < HEOS.solver_tolerance(1e-10) * T) {
+            HEOS.update_DmolarT_direct(HEOS.solver_rho_Tp(T, p, rhomolar), T);
+            HEOS._Q = -1;
+            HEOS._phase = HEOS.imposed_phase_index;
+            return;
+        }
+    }
+    throw ValueError(format("HSU_P_flash_mixture_gas did not converge for p=%Lg Pa and %s=%Lg", p, get_parameter_information(other, "short").c_str(),
+                            value));
+}
 void FlashRoutines::solver_for_rho_given_T_oneof_HSU(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl T, CoolPropDbl value, parameters other) {
     // Define the residual to be driven to zero
     class solver_resid : public FuncWrapper1DWithTwoDerivs
@@ -1674,7 +2072,7 @@ void FlashRoutines::solver_for_rho_given_T_oneof_HSU(HelmholtzEOSMixtureBackend&
                 throw ValueError();
         }
         if (is_in_closed_range(yc, ymin, y)) {
-            Brent(resid, rhoc, rhomin, LDBL_EPSILON, 1e-9, 100);
+            Brent(resid, rhoc, rhomin, LDBL_EPSILON, HEOS.solver_tolerance(1e-9, rhoc), 100);
         } else if (y < yc) {
             // Increase rhomelt until it bounds the solution
             int step_count = 0;
@@ -1698,7 +2096,7 @@ void FlashRoutines::solver_for_rho_given_T_oneof_HSU(HelmholtzEOSMixtureBackend&
                 }
                 step_count++;
             }
-            Brent(resid, rhomin, rhoc, LDBL_EPSILON, 1e-9, 100);
+            Brent(resid, rhomin, rhoc, LDBL_EPSILON, HEOS.solver_tolerance(1e-9, rhoc), 100);
         } else {
             throw ValueError(format("input %Lg is not in range %Lg,%Lg,%Lg", y, yc, ymin));
         }
@@ -1741,9 +2139,9 @@ void FlashRoutines::solver_for_rho_given_T_oneof_HSU(HelmholtzEOSMixtureBackend&
         CoolPropDbl rhomolar_guess = (rhomelt - rhoL) / (ymelt - yL) * (y - yL) + rhoL;
 
         try {
-            Halley(resid, rhomolar_guess, 1e-8, 100);
+            Halley(resid, rhomolar_guess, HEOS.solver_tolerance(1e-8, value), 100, HEOS.solver_tolerance(1e-12));
         } catch (...) {
-            Secant(resid, rhomolar_guess, 0.0001 * rhomolar_guess, 1e-12, 100);
+            Secant(resid, rhomolar_guess, 0.0001 * rhomolar_guess, HEOS.solver_tolerance(1e-12, value), 100);
         }
     }
     // Subcritical temperature gas
@@ -1752,10 +2150,10 @@ void FlashRoutines::solver_for_rho_given_T_oneof_HSU(HelmholtzEOSMixtureBackend&
         CoolPropDbl rhoV = static_cast<double>(HEOS._rhoVanc);
 
         try {
-            Halley(resid, 0.5 * (rhomin + rhoV), 1e-8, 100);
+            Halley(resid, 0.5 * (rhomin + rhoV), HEOS.solver_tolerance(1e-8, value), 100, HEOS.solver_tolerance(1e-12));
         } catch (...) {
             try {
-                Brent(resid, rhomin, rhoV, LDBL_EPSILON, 1e-12, 100);
+                Brent(resid, rhomin, rhoV, LDBL_EPSILON, HEOS.solver_tolerance(1e-12, rhoV), 100);
             } catch (...) {
                 throw ValueError();
             }
@@ -1913,7 +2311,7 @@ void FlashRoutines::HS_flash_twophase(HelmholtzEOSMixtureBackend& HEOS, CoolProp
     HEOS.calc_Tmin_sat(Tmin_satL, Tmin_satV);
     Tmin_sat = std::max(Tmin_satL, Tmin_satV) - 1e-13;
 
-    Brent(resid, Tmin_sat, Tmax_sat - 0.01, DBL_EPSILON, 1e-12, 20);
+    Brent(resid, Tmin_sat, Tmax_sat - 0.01, DBL_EPSILON, HEOS.solver_tolerance(1e-12, Tmax_sat), 20);
     // Run once more with the final vapor quality
     HEOS.update(QT_INPUTS, resid.Qs, HEOS.T());
 }
@@ -1965,7 +2363,7 @@ void FlashRoutines::HS_flash_singlephase(HelmholtzEOSMixtureBackend& HEOS, CoolP
         if (iter > 50) {
             throw ValueError(format("HS_flash_singlephase took too many iterations; residual is %g; prior was %g", resid, resid_old));
         }
-    } while (std::abs(resid) > 1e-9);
+    } while (std::abs(resid) > HEOS.solver_tolerance(1e-9, hmolar_spec));
 }
 void FlashRoutines::HS_flash_generate_TP_singlephase_guess(HelmholtzEOSMixtureBackend& HEOS, double& T, double& p) {
     // Randomly obtain a starting value that is single-phase
@@ -1974,6 +2372,9 @@ void FlashRoutines::HS_flash_generate_TP_singlephase_guess(HelmholtzEOSMixtureBa
     p = exp(logp);
 }
 void FlashRoutines::HS_flash(HelmholtzEOSMixtureBackend& HEOS) {
+    if (IF97_guesses_enabled(HEOS) && HS_flash_IF97_seeded(HEOS)) {
+        return;
+    }
     // Use TS flash and iterate on T (known to be between Tmin and Tmax)
     // in order to find H
     double hmolar = HEOS.hmolar(), smolar = HEOS.smolar();
@@ -2025,7 +2426,7 @@ void FlashRoutines::HS_flash(HelmholtzEOSMixtureBackend& HEOS) {
     if (rmin * rmax > 0 && std::abs(rmax) < std::abs(rmin)) {
         throw CoolProp::ValueError(format("HS inputs correspond to temperature above maximum temperature of EOS [%g K]", HEOS.Tmax()));
     }
-    Brent(resid, Tmin, Tmax, DBL_EPSILON, 1e-10, 100);
+    Brent(resid, Tmin, Tmax, DBL_EPSILON, HEOS.solver_tolerance(1e-10, Tmax), 100);
 }
 
 #if defined(ENABLE_CATCH)
@@ -2125,6 +2526,51 @@ TEST_CASE("Test critical points for nitrogen + ethane with PR", "[critical_point
     }
 }
 
+TEST_CASE("Check the flash routines for each of the solver tolerance tiers", "[flash],[tolerance_tiers]") {
+    shared_ptr<AbstractState> Exact(AbstractState::factory("HEOS", "Water"));
+    shared_ptr<AbstractState> Fast(AbstractState::factory("HEOS", "Water"));
+    Exact->set_tolerance_tier(iTOLERANCE_EXACT);
+    Fast->set_tolerance_tier(iTOLERANCE_FAST);
+    CHECK(Fast->tolerance_tier() == iTOLERANCE_FAST);
+
+    SECTION("Absolute tolerances follow the scale of the variable") {
+        shared_ptr<AbstractState> Standard(AbstractState::factory("HEOS", "Water"));
+        CHECK(Standard->solver_tolerance(1e-10, 1e6) == 1e-10);
+        CHECK(std::abs(Fast->solver_tolerance(1e-10, 1e6) - 1) < 1e-12);
+        CHECK(std::abs(Fast->solver_tolerance(1e-10, 300) - 3e-4) < 1e-16);
+        CHECK(Fast->solver_tolerance(1e-2, 300) == 1e-2);
+        CHECK(std::abs(Exact->solver_tolerance(1e-10, 300) - 1e-12) < 1e-24);
+        // The relative tolerances do not depend on a scale
+        CHECK(Fast->solver_tolerance(1e-10) == 1e-6);
+    }
+
+    SECTION("PT") {
+        Exact->update(PT_INPUTS, 101325, 300);
+        Fast->update(PT_INPUTS, 101325, 300);
+        CHECK(std::abs(Fast->rhomolar() / Exact->rhomolar() - 1) < 1e-6);
+    }
+    SECTION("PQ") {
+        Exact->update(PQ_INPUTS, 101325, 0.3);
+        Fast->update(PQ_INPUTS, 101325, 0.3);
+        CHECK(std::abs(Fast->T() / Exact->T() - 1) < 1e-6);
+        CHECK(std::abs(Fast->rhomolar() / Exact->rhomolar() - 1) < 1e-6);
+    }
+    SECTION("HmolarP") {
+        Exact->update(PT_INPUTS, 1e6, 500);
+        double h = Exact->hmolar();
+        Exact->update(HmolarP_INPUTS, h, 1e6);
+        Fast->update(HmolarP_INPUTS, h, 1e6);
+        CHECK(std::abs(Fast->T() / Exact->T() - 1) < 1e-6);
+    }
+    SECTION("DmolarUmolar") {
+        Exact->update(PT_INPUTS, 1e6, 500);
+        double rho = Exact->rhomolar(), u = Exact->umolar();
+        Exact->update(DmolarUmolar_INPUTS, rho, u);
+        Fast->update(DmolarUmolar_INPUTS, rho, u);
+        CHECK(std::abs(Fast->T() / Exact->T() - 1) < 1e-6);
+    }
+}
+
 #endif
 
 } /* namespace CoolProp */
@@ -140,6 +140,12 @@ class FlashRoutines
     static void HSU_P_flash_singlephase_Brent(HelmholtzEOSMixtureBackend& HEOS, parameters other, CoolPropDbl value, CoolPropDbl Tmin,
                                               CoolPropDbl Tmax, phases phase);
 
+    /// The flash routine for the pairs (P,H), (P,S), and (P,U) for a mixture in an imposed gas-like phase, which does not need the phase envelope
+    /// @param HEOS The HelmholtzEOSMixtureBackend to be used
+    /// @param other The index for the other input from CoolProp::parameters; allowed values are iHmolar, iSmolar, iUmolar
+    /// @param value The value of the other input
+    static void HSU_P_flash_mixture_gas(HelmholtzEOSMixtureBackend& HEOS, parameters other, CoolPropDbl value);
+
     /// A generic flash routine for the pairs (D,H), (D,S), and (D,U) for twophase state.  Similar analysis is needed
     /// @param HEOS The HelmholtzEOSMixtureBackend to be used
     /// @param other The index for the other input from CoolProp::parameters; allowed values are iP, iHmolar, iSmolar, iUmolar
@@ -150,6 +156,99 @@ class FlashRoutines
     /// @param other The index for the other input from CoolProp::parameters; allowed values are iP, iHmolar, iSmolar, iUmolar
     static void HSU_D_flash(HelmholtzEOSMixtureBackend& HEOS, parameters other);
 
+    /**
+     * @brief A fast (D,U) flash for pure and pseudo-pure fluids in the single-phase region, for the cells of compressible flow solvers
+     * @param HEOS The HelmholtzEOSMixtureBackend to be used
+     * @param rhomolar The molar density in mol/m^3
+     * @param umolar The molar internal energy in J/mol
+     * @param T0 The initial guess for the temperature in K, usually the solution for the cell at the last time step
+     * @return True if the state is set; false if the iteration did not converge, or if the state might be two-phase or metastable, in
+     * which case the full flash must be used
+     *
+     * A Newton iteration in T with \f$ \left.\partial u/\partial T\right|_\rho = c_v \f$.  The solution is accepted without a
+     * saturation calculation if it is supercritical, or if its density and pressure are clearly on the stable side of the saturation
+     * densities and pressures given by the ancillary equations at its temperature.
+     */
+    static bool DU_flash_singlephase_Newton(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl rhomolar, CoolPropDbl umolar, CoolPropDbl T0);
+
+    /// Return true if the flashes of this instance are to be seeded from IF97 (see the HEOS_WATER_IF97_GUESSES configuration variable),
+    /// which requires pure water and no imposed phase
+    static bool IF97_guesses_enabled(HelmholtzEOSMixtureBackend& HEOS);
+
+    /**
+     * @brief Solve for the temperature and density of a pure fluid with two specified properties by Newton's method, starting close to the solution
+     * @param HEOS The HelmholtzEOSMixtureBackend to be used
+     * @param in1 The first specified property; one of iP, iHmolar, iSmolar
+     * @param value1 The value of the first specified property
+     * @param in2 The second specified property; one of iP, iHmolar, iSmolar
+     * @param value2 The value of the second specified property
+     * @param T0 The initial guess for the temperature in K
+     * @param rhomolar0 The initial guess for the molar density in mol/m^3
+     * @return True if the iteration converged, in which case HEOS is updated at the solution
+     */
+    static bool singlephase_Newton_DT(HelmholtzEOSMixtureBackend& HEOS, parameters in1, CoolPropDbl value1, parameters in2, CoolPropDbl value2,
+                                      CoolPropDbl T0, CoolPropDbl rhomolar0);
+
+    /**
+     * @brief Check that a single-phase solution of a flash seeded from IF97 is stable, and on the same side of the saturation curve as the seed
+     * @param HEOS The HelmholtzEOSMixtureBackend at the solution
+     * @param T0 The temperature in K given by the IF97 backward equations
+     * @param p0 The pressure in Pa given by the IF97 backward equations
+     */
+    static bool IF97_seeded_singlephase_is_stable(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl T0, CoolPropDbl p0);
+
+    /**
+     * @brief A (P,H) or (P,S) flash for water that starts from the IF97 backward equations T(p,h) or T(p,s)
+     * @param HEOS The HelmholtzEOSMixtureBackend to be used
+     * @param other The index for the other input; allowed values are iHmolar, iSmolar
+     * @param value The value of the other input
+     * @return True if the state is set; false if the full flash must be used
+     *
+     * Far from the saturation curve, the IF97 temperature and density are refined with Newton steps in (T, rho) on IAPWS-95.  Close to
+     * it, the saturation state at the pressure is solved starting from the IF97 saturation state, and the quality follows from it.
+     */
+    static bool HSU_P_flash_IF97_seeded(HelmholtzEOSMixtureBackend& HEOS, parameters other, CoolPropDbl value);
+
+    /// A (H,S) flash for water in the single-phase region that starts from the IF97 backward equations p(h,s) and T(p,h); returns
+    /// false if the full flash must be used (always in the two-phase region and close to the saturation curve)
+    static bool HS_flash_IF97_seeded(HelmholtzEOSMixtureBackend& HEOS);
+
+    /// A (P,T) flash for water that starts from the IF97 density; returns false if the full flash must be used (close to the saturation curve)
+    static bool PT_flash_IF97_seeded(HelmholtzEOSMixtureBackend& HEOS);
+
+    /// Return true if the flashes of this mixture are to be seeded from a Peng-Robinson model of the mixture (see the
+    /// CUBIC_GUESSES_FOR_MIXTURE_FLASHES configuration variable); never true for the cubic backends themselves
+    static bool cubic_guesses_enabled(HelmholtzEOSMixtureBackend& HEOS);
+
+    /**
+     * @brief Get the Peng-Robinson model of the mixture that provides the initial guesses, at the composition of HEOS
+     * @param HEOS The HelmholtzEOSMixtureBackend to be used
+     *
+     * The model is built on first use from the critical temperatures, critical pressures and acentric factors of the components.  Each
+     * \f$ k_{ij} \f$ is fitted to the critical temperature of the equimolar binary mixture of HEOS (see fit_cubic_kij).
+     */
+    static HelmholtzEOSMixtureBackend& get_cubic_guess_state(HelmholtzEOSMixtureBackend& HEOS);
+
+    /**
+     * @brief Fit the \f$ k_{ij} \f$ of the Peng-Robinson model of the binary mixture of components i and j of HEOS such that the critical
+     * temperatures of the equimolar mixture of both models agree
+     * @param HEOS The HelmholtzEOSMixtureBackend to be used
+     * @param i The index of the first component
+     * @param j The index of the second component
+     * @param kij0 The starting value, which is returned if either model does not have a single critical point; from the cross temperature
+     * of the reducing function, \f$ 1-k_{ij} = 2\beta_{T,ij}\gamma_{T,ij}/(1+\beta_{T,ij}^2) \f$, for instance
+     */
+    static double fit_cubic_kij(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, double kij0);
+
+    /**
+     * @brief A bubble- or dew-point flash of a mixture that starts from the solution of the Peng-Robinson model
+     * @param HEOS The HelmholtzEOSMixtureBackend to be used
+     * @param input The imposed variable; iT for a (Q,T) flash, iP for a (P,Q) flash
+     * @return True if the Newton-Raphson saturation solver converged to a non-trivial solution, in which case SatL and SatV are set;
+     * false if the usual Wilson and successive substitution guesses must be used
+     */
+    static bool saturation_mixture_cubic_seeded(HelmholtzEOSMixtureBackend& HEOS, parameters input);
+
     /// A flash routine for (H,S)
     /// @param HEOS The HelmholtzEOSMixtureBackend to be used
     static void HS_flash(HelmholtzEOSMixtureBackend& HEOS);
@@ -1,10 +1,12 @@
 #include "Ancillaries.h"
 #include "DataStructures.h"
 #include "AbstractState.h"
+#include <algorithm>
 
 #if defined(ENABLE_CATCH)
 
 #    include "crossplatform_shared_ptr.h"
+#    include "Backends/Helmholtz/HelmholtzEOSMixtureBackend.h"
 #    include <catch2/catch_all.hpp>
 
 #endif
@@ -40,8 +42,100 @@ SaturationAncillaryFunction::SaturationAncillaryFunction(rapidjson::Value& json_
         using_tau_r = cpjson::get_bool(json_code, "using_tau_r");
         T_r = cpjson::get_double(json_code, "T_r");
     }
+    inv_log = (this->type == TYPE_EXPONENTIAL);
+    build_inverse();
 };
 
+void SaturationAncillaryFunction::build_inverse(void) {
+    inverse.reset();
+    if (!ValidNumber(Tmin) || !ValidNumber(Tmax) || Tmin >= _HUGE || Tmax >= _HUGE || Tmax <= Tmin) {
+        return;
+    }
+    // Sample the function, with the nodes crowded towards Tmax (usually the critical point) where the
+    // densities change most rapidly
+    const std::size_t Nsamples = 128;
+    std::vector<double> u(Nsamples), T(Nsamples);
+    try {
+        for (std::size_t k = 0; k < Nsamples; ++k) {
+            double s = 1 - static_cast<double>(k) / (Nsamples - 1);
+            T[k] = Tmax - (Tmax - Tmin) * (0.3 * s + 0.7 * s * s * s);
+            double y = evaluate(T[k]);
+            u[k] = (inv_log) ? log(y) : y;
+            if (!ValidNumber(u[k])) {
+                return;
+            }
+        }
+    } catch (...) {
+        return;
+    }
+    // The inverse is only fitted over the strictly monotonic part of the function that ends at Tmax;
+    // the liquid density of water, for instance, has a maximum close to the triple point
+    if (u[Nsamples - 1] == u[Nsamples - 2]) {
+        return;
+    }
+    bool increasing = u[Nsamples - 1] > u[Nsamples - 2];
+    std::size_t kstart = Nsamples - 2;
+    while (kstart > 0 && ((increasing) ? u[kstart] > u[kstart - 1] : u[kstart] < u[kstart - 1])) {
+        kstart--;
+    }
+    if (Nsamples - kstart < 16) {
+        return;
+    }
+    u.erase(u.begin(), u.begin() + kstart);
+    T.erase(T.begin(), T.begin() + kstart);
+    const std::size_t N = u.size();
+    if (!increasing) {
+        std::reverse(u.begin(), u.end());
+        std::reverse(T.begin(), T.end());
+    }
+    // Monotonic piecewise cubic Hermite interpolation (Fritsch and Carlson, 1980)
+    std::vector<double> secant(N - 1), m(N);
+    for (std::size_t k = 0; k < N - 1; ++k) {
+        secant[k] = (T[k + 1] - T[k]) / (u[k + 1] - u[k]);
+    }
+    m[0] = secant[0];
+    m[N - 1] = secant[N - 2];
+    for (std::size_t k = 1; k < N - 1; ++k) {
+        m[k] = (secant[k - 1] * secant[k] <= 0) ? 0 : 0.5 * (secant[k - 1] + secant[k]);
+    }
+    for (std::size_t k = 0; k < N - 1; ++k) {
+        if (secant[k] == 0) {
+            m[k] = 0;
+            m[k + 1] = 0;
+            continue;
+        }
+        double alpha = m[k] / secant[k], beta = m[k + 1] / secant[k], r2 = alpha * alpha + beta * beta;
+        if (r2 > 9) {
+            double tau = 3 / sqrt(r2);
+            m[k] = tau * alpha * secant[k];
+            m[k + 1] = tau * beta * secant[k];
+        }
+    }
+    shared_ptr<SaturationAncillaryInverse> fitted(new SaturationAncillaryInverse());
+    fitted->u.swap(u);
+    fitted->T.swap(T);
+    fitted->dTdu.swap(m);
+    inverse = fitted;
+}
+
+double SaturationAncillaryFunction::invert_approximate(double value) {
+    if (!inverse) {
+        return invert(value);
+    }
+    const std::vector<double>& inv_u = inverse->u;
+    const std::vector<double>& inv_T = inverse->T;
+    const std::vector<double>& inv_dTdu = inverse->dTdu;
+    double u = (inv_log) ? log(value) : value;
+    if (!ValidNumber(u) || u < inv_u.front() || u > inv_u.back()) {
+        return invert(value);
+    }
+    std::size_t i = std::upper_bound(inv_u.begin(), inv_u.end(), u) - inv_u.begin();
+    i = std::min(std::max(i, static_cast<std::size_t>(1)), inv_u.size() - 1) - 1;
+    double h = inv_u[i + 1] - inv_u[i], t = (u - inv_u[i]) / h, t2 = t * t, t3 = t2 * t;
+    return (2 * t3 - 3 * t2 + 1) * inv_T[i] + (t3 - 2 * t2 + t) * h * inv_dTdu[i] + (-2 * t3 + 3 * t2) * inv_T[i + 1]
+           + (t3 - t2) * h * inv_dTdu[i + 1];
+}
+
 double SaturationAncillaryFunction::evaluate(double T) {
     if (type == TYPE_NOT_SET) {
         throw ValueError(format("type not set"));
@@ -93,6 +187,23 @@ double SaturationAncillaryFunction::invert(double value, double min_bound, doubl
         max_bound = Tmax;
     }
 
+    // Start from the fitted inverse if possible, and polish it within a narrow bracket
+    double u = (inv_log) ? log(value) : value;
+    if (inverse && ValidNumber(u) && u >= inverse->u.front() && u <= inverse->u.back()) {
+        double T0 = invert_approximate(value), dT = 1e-3 * (Tmax - Tmin);
+        double Tlo = std::max(min_bound, T0 - dT), Thi = std::min(max_bound, T0 + dT);
+        if (Thi > Tlo) {
+            double flo = resid.call(Tlo), fhi = resid.call(Thi);
+            if (flo * fhi <= 0) {
+                try {
+                    return Brent(resid, Tlo, Thi, DBL_EPSILON, 1e-10, 100);
+                } catch (...) {
+                    // Fall through to the full bracket
+                }
+            }
+        }
+    }
+
     try {
         // Safe to expand the domain a little bit to lower temperature, absolutely cannot exceed Tmax
         // because then you get (negative number)^(double) which is undefined.
@@ -389,4 +500,43 @@ TEST_CASE("Surface tension", "[surface_tension]") {
         CHECK_NOTHROW(AS->surface_tension());
     }
 }
+
+TEST_CASE("Consistency of the forward and fitted inverse ancillaries", "[ancillaries]") {
+    std::string fluids[] = {"Water", "R134a", "Propane", "CarbonDioxide", "Nitrogen"};
+    for (std::size_t i = 0; i < 5; ++i) {
+        CoolProp::HelmholtzEOSMixtureBackend HEOS(std::vector<std::string>(1, fluids[i]));
+        CoolProp::Ancillaries& anc = HEOS.get_components()[0].ancillaries;
+        CoolProp::SaturationAncillaryFunction* funcs[] = {&anc.pL, &anc.pV, &anc.rhoL, &anc.rhoV};
+        std::string names[] = {"pL", "pV", "rhoL", "rhoV"};
+        for (std::size_t j = 0; j < 4; ++j) {
+            // The liquid density of water has a maximum, and cannot be inverted over the whole range
+            if (fluids[i] == "Water" && names[j] == "rhoL") {
+                continue;
+            }
+            CoolProp::SaturationAncillaryFunction& f = *funcs[j];
+            std::ostringstream ss;
+            ss << fluids[i] << " " << names[j];
+            SECTION(ss.str(), "") {
+                REQUIRE(f.has_inverse());
+                double Tmin = f.get_Tmin(), Tmax = f.get_Tmax();
+                for (double T = Tmin; T < Tmax - 1; T += (Tmax - Tmin) / 37) {
+                    double value = f.evaluate(T);
+                    double T_approx = f.invert_approximate(value), T_exact = f.invert(value);
+                    CAPTURE(T);
+                    CAPTURE(T_approx);
+                    CAPTURE(T_exact);
+                    CHECK(std::abs(T_approx - T) < 0.1);
+                    CHECK(std::abs(T_exact - T) < 1e-6);
+                }
+            }
+        }
+    }
+    SECTION("The fitted inverses are shared by the instances of a fluid") {
+        CoolProp::HelmholtzEOSMixtureBackend HEOS1(std::vector<std::string>(1, "R134a")), HEOS2(std::vector<std::string>(1, "R134a"));
+        CoolProp::Ancillaries &anc1 = HEOS1.get_components()[0].ancillaries, &anc2 = HEOS2.get_components()[0].ancillaries;
+        REQUIRE(anc1.pL.has_inverse());
+        CHECK(anc1.pL.get_inverse() == anc2.pL.get_inverse());
+        CHECK(anc1.rhoV.get_inverse() == anc2.rhoV.get_inverse());
+    }
+}
 #endif
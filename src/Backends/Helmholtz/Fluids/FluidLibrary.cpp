@@ -15,7 +15,10 @@ void load() {
         throw ValueError("Unable to load all_fluids.json");
     } else {
         try {
-            library.add_many(dd);
+            // The positions of the fluids in the source are kept instead of their JSON strings
+            for (rapidjson::SizeType i = 0; i < dd.Size(); ++i) {
+                library.add_one(dd[i], i);
+            }
         } catch (std::exception& e) {
             std::cout << e.what() << std::endl;
         }
@@ -103,7 +106,7 @@ void JSONFluidLibrary::add_many(rapidjson::Value& listing) {
     }
 };
 
-void JSONFluidLibrary::add_one(rapidjson::Value& fluid_json) {
+void JSONFluidLibrary::add_one(rapidjson::Value& fluid_json, std::size_t embedded_position) {
     _is_empty = false;
 
     // The variable index is initialized to the size of the fluid_map.
@@ -129,48 +132,52 @@ void JSONFluidLibrary::add_one(rapidjson::Value& fluid_json) {
         }
         fluid.CAS = fluid_json["INFO"]["CAS"].GetString();
 
+        // The descriptive data, shared by all the copies of the fluid
+        fluid.metadata.reset(new FluidMetadata());
+        FluidMetadata& metadata = *fluid.metadata;
+
         // REFPROP alias
         if (!fluid_json["INFO"].HasMember("REFPROP_NAME")) {
             throw ValueError(format("fluid [%s] does not have \"REFPROP_NAME\" member", fluid.name.c_str()));
         }
-        fluid.REFPROPname = fluid_json["INFO"]["REFPROP_NAME"].GetString();
+        metadata.REFPROPname = fluid_json["INFO"]["REFPROP_NAME"].GetString();
 
         // FORMULA
         if (fluid_json["INFO"].HasMember("FORMULA")) {
-            fluid.formula = cpjson::get_string(fluid_json["INFO"], "FORMULA");
+            metadata.formula = cpjson::get_string(fluid_json["INFO"], "FORMULA");
         } else {
-            fluid.formula = "N/A";
+            metadata.formula = "N/A";
         }
 
         // Abstract references
         if (fluid_json["INFO"].HasMember("INCHI_STRING")) {
-            fluid.InChI = cpjson::get_string(fluid_json["INFO"], "INCHI_STRING");
+            metadata.InChI = cpjson::get_string(fluid_json["INFO"], "INCHI_STRING");
         } else {
-            fluid.InChI = "N/A";
+            metadata.InChI = "N/A";
         }
 
         if (fluid_json["INFO"].HasMember("INCHI_KEY")) {
-            fluid.InChIKey = cpjson::get_string(fluid_json["INFO"], "INCHI_KEY");
+            metadata.InChIKey = cpjson::get_string(fluid_json["INFO"], "INCHI_KEY");
         } else {
-            fluid.InChIKey = "N/A";
+            metadata.InChIKey = "N/A";
         }
 
         if (fluid_json["INFO"].HasMember("SMILES")) {
-            fluid.smiles = cpjson::get_string(fluid_json["INFO"], "SMILES");
+            metadata.smiles = cpjson::get_string(fluid_json["INFO"], "SMILES");
         } else {
-            fluid.smiles = "N/A";
+            metadata.smiles = "N/A";
         }
 
         if (fluid_json["INFO"].HasMember("CHEMSPIDER_ID")) {
-            fluid.ChemSpider_id = cpjson::get_integer(fluid_json["INFO"], "CHEMSPIDER_ID");
+            metadata.ChemSpider_id = cpjson::get_integer(fluid_json["INFO"], "CHEMSPIDER_ID");
         } else {
-            fluid.ChemSpider_id = -1;
+            metadata.ChemSpider_id = -1;
         }
 
         if (fluid_json["INFO"].HasMember("2DPNG_URL")) {
-            fluid.TwoDPNG_URL = cpjson::get_string(fluid_json["INFO"], "2DPNG_URL");
+            metadata.TwoDPNG_URL = cpjson::get_string(fluid_json["INFO"], "2DPNG_URL");
         } else {
-            fluid.TwoDPNG_URL = "N/A";
+            metadata.TwoDPNG_URL = "N/A";
         }
 
         // Parse the environmental parameters
@@ -284,14 +291,17 @@ void JSONFluidLibrary::add_one(rapidjson::Value& fluid_json) {
         // if not, it will add the (index,fluid) pair to the map using the new index value (fluid_map.size())
         fluid_map[index] = fluid;
 
-        // Add/Replace index->JSONstring mapping to easily pull out if the user wants it
-        // Convert fuid_json to a string and store it in the map at index.
-        // if the fluid index exists, the [] operator replaces the existing entry with the new JSONstring;
-        //    However, since fluid_json is a custom type, the old entry must be erased first to properly
-        //    release the memory before adding in the new fluid object at the same location (index)
-        if (fluid_exists) JSONstring_map.erase(JSONstring_map.find(index));
-        // if not, it will add the new (index,JSONstring) pair to the map.
-        JSONstring_map[index] = cpjson::json2string(fluid_json);
+        // Add/Replace the mapping to the JSON source of the fluid to easily pull out if the user wants it
+        // The fluids from the embedded source only keep their position in it, and the JSON string is parsed
+        // out of the source again when requested; the JSON of the fluids from other sources is converted
+        // to a string and stored in the map at index.
+        JSONstring_map.erase(index);
+        embedded_JSON_map.erase(index);
+        if (embedded_position != std::string::npos) {
+            embedded_JSON_map[index] = embedded_position;
+        } else {
+            JSONstring_map[index] = cpjson::json2string(fluid_json);
+        }
 
         // Add/Replace CAS->index mapping
         // This map helps find the index of a fluid in the fluid_map given a CAS string
@@ -324,6 +334,85 @@ void JSONFluidLibrary::add_one(rapidjson::Value& fluid_json) {
     }
 };
 
+std::string JSONFluidLibrary::get_JSONstring(const std::string& key) {
+    // Try to find it
+    std::map<std::string, std::size_t>::const_iterator it = string_to_index_map.find(key);
+    if (it == string_to_index_map.end()) {
+        throw ValueError(format("Unable to obtain index for this identifier [%s]", key.c_str()));
+    }
+    rapidjson::Document doc2;
+    doc2.SetArray();
+    std::map<std::size_t, std::size_t>::const_iterator it_embedded = embedded_JSON_map.find(it->second);
+    std::map<std::size_t, std::string>::const_iterator it2 = JSONstring_map.find(it->second);
+    if (it_embedded != embedded_JSON_map.end()) {
+        // Parse the embedded source again, and copy the entry of the fluid out of it
+        rapidjson::Document dd;
+        dd.Parse<0>(all_fluids_JSON.c_str());
+        if (dd.HasParseError() || !dd.IsArray() || it_embedded->second >= dd.Size()) {
+            throw ValueError("Unable to load all_fluids.json");
+        }
+        rapidjson::Value fluid_json(dd[static_cast<rapidjson::SizeType>(it_embedded->second)], doc2.GetAllocator());
+        doc2.PushBack(fluid_json, doc2.GetAllocator());
+    } else if (it2 != JSONstring_map.end()) {
+        // Then, load the fluids we would like to add
+        rapidjson::Document doc;
+        cpjson::JSON_string_to_rapidjson(it2->second, doc);
+        doc2.PushBack(doc, doc.GetAllocator());
+    } else {
+        throw ValueError(format("Unable to obtain JSON string for this identifier [%d]", it->second));
+    }
+    return cpjson::json2string(doc2);
+}
+
+std::size_t JSONFluidLibrary::memory_footprint(void) const {
+    std::size_t bytes = 0;
+    for (std::map<std::size_t, CoolPropFluid>::const_iterator it = fluid_map.begin(); it != fluid_map.end(); ++it) {
+        bytes += sizeof(std::size_t) + fluid_memory_footprint(it->second);
+        // The descriptive data, shared by the copies of the fluid
+        if (it->second.metadata) {
+            const FluidMetadata& metadata = *it->second.metadata;
+            const BibTeXKeysStruct& keys = metadata.BibTeXKeys;
+            bytes += sizeof(FluidMetadata) + metadata.REFPROPname.capacity() + metadata.formula.capacity() + metadata.InChI.capacity()
+                     + metadata.InChIKey.capacity() + metadata.smiles.capacity() + metadata.TwoDPNG_URL.capacity() + metadata.ASHRAE34.capacity();
+            bytes += keys.EOS.capacity() + keys.CP0.capacity() + keys.VISCOSITY.capacity() + keys.CONDUCTIVITY.capacity()
+                     + keys.ECS_LENNARD_JONES.capacity() + keys.ECS_FITS.capacity() + keys.SURFACE_TENSION.capacity();
+        }
+    }
+    for (std::vector<std::string>::const_iterator it = name_vector.begin(); it != name_vector.end(); ++it) {
+        bytes += sizeof(std::string) + it->capacity();
+    }
+    for (std::map<std::string, std::size_t>::const_iterator it = string_to_index_map.begin(); it != string_to_index_map.end(); ++it) {
+        bytes += sizeof(std::string) + it->first.capacity() + sizeof(std::size_t);
+    }
+    return bytes;
+}
+
+std::size_t JSONFluidLibrary::JSON_memory_footprint(void) const {
+    std::size_t bytes = 0;
+    for (std::map<std::size_t, std::string>::const_iterator it = JSONstring_map.begin(); it != JSONstring_map.end(); ++it) {
+        bytes += sizeof(std::size_t) + sizeof(std::string) + it->second.capacity();
+    }
+    return bytes + embedded_JSON_map.size() * 2 * sizeof(std::size_t);
+}
+
+std::size_t fluid_memory_footprint(const CoolPropFluid& fluid) {
+    std::size_t bytes = sizeof(CoolPropFluid) + fluid.name.capacity() + fluid.CAS.capacity();
+    for (std::vector<std::string>::const_iterator it = fluid.aliases.begin(); it != fluid.aliases.end(); ++it) {
+        bytes += sizeof(std::string) + it->capacity();
+    }
+    bytes += fluid.EOSVector.capacity() * sizeof(EquationOfState);
+    for (std::vector<EquationOfState>::const_iterator it = fluid.EOSVector.begin(); it != fluid.EOSVector.end(); ++it) {
+        bytes += it->alphar.GenExp.elements.capacity() * sizeof(ResidualHelmholtzGeneralizedExponentialElement);
+        bytes += it->alphar.NonAnalytic.elements.capacity() * sizeof(ResidualHelmholtzNonAnalyticElement);
+        bytes += (it->critical_region_splines.cL.capacity() + it->critical_region_splines.cV.capacity()) * sizeof(double);
+    }
+    const Ancillaries& anc = fluid.ancillaries;
+    bytes += anc.pL.memory_footprint() + anc.pV.memory_footprint() + anc.rhoL.memory_footprint() + anc.rhoV.memory_footprint()
+             + anc.hL.memory_footprint() + anc.hLV.memory_footprint() + anc.sL.memory_footprint() + anc.sLV.memory_footprint();
+    bytes += (anc.surface_tension.a.capacity() + anc.surface_tension.n.capacity() + anc.surface_tension.s.capacity()) * sizeof(CoolPropDbl);
+    return bytes;
+}
+
 JSONFluidLibrary& get_library(void) {
     if (library.is_empty()) {
         load();
@@ -28,7 +28,10 @@ class JSONFluidLibrary
 {
     /// Map from CAS code to JSON instance.  For pseudo-pure fluids, use name in place of CAS code since no CAS number is defined for mixtures
     std::map<std::size_t, CoolPropFluid> fluid_map;
-    /// Map from index of fluid to a string
+    /// Map from index of fluid to its position in the embedded JSON source (all_fluids_JSON), for the fluids that were loaded from it;
+    /// their JSON strings are parsed out of the source again when they are requested, rather than kept
+    std::map<std::size_t, std::size_t> embedded_JSON_map;
+    /// Map from index of fluid to a string, for the fluids that were added from other JSON sources
     std::map<std::size_t, std::string> JSONstring_map;
     std::vector<std::string> name_vector;
     std::map<std::string, std::size_t> string_to_index_map;
@@ -323,7 +326,7 @@ class JSONFluidLibrary
    protected:
     /// Parse the environmental parameters (ODP, GWP, etc.)
     void parse_environmental(rapidjson::Value& json, CoolPropFluid& fluid) {
-        fluid.environment.ASHRAE34 = cpjson::get_string(json, "ASHRAE34");
+        fluid.metadata->ASHRAE34 = cpjson::get_string(json, "ASHRAE34");
         fluid.environment.GWP20 = cpjson::get_double(json, "GWP20");
         fluid.environment.GWP100 = cpjson::get_double(json, "GWP100");
         fluid.environment.GWP500 = cpjson::get_double(json, "GWP500");
@@ -372,9 +375,11 @@ class JSONFluidLibrary
         EOS.ptriple = cpjson::get_double(satminL_state, "p");
         EOS.Ttriple = EOS.limits.Tmin;
 
-        // BibTex keys
-        EOS.BibTeX_EOS = cpjson::get_string(EOS_json, "BibTeX_EOS");
-        EOS.BibTeX_CP0 = cpjson::get_string(EOS_json, "BibTeX_CP0");
+        // BibTex keys, of the first equation of state
+        if (fluid.EOSVector.size() == 1) {
+            fluid.metadata->BibTeXKeys.EOS = cpjson::get_string(EOS_json, "BibTeX_EOS");
+            fluid.metadata->BibTeXKeys.CP0 = cpjson::get_string(EOS_json, "BibTeX_CP0");
+        }
 
         EOS.alphar = parse_alphar(EOS_json["alphar"]);
         EOS.alpha0 = parse_alpha0(EOS_json["alpha0"]);
@@ -699,7 +704,7 @@ class JSONFluidLibrary
         }
 
         // Load the BibTeX key
-        fluid.transport.BibTeX_viscosity = cpjson::get_string(viscosity, "BibTeX");
+        fluid.metadata->BibTeXKeys.VISCOSITY = cpjson::get_string(viscosity, "BibTeX");
 
         // Set the Lennard-Jones 12-6 potential variables, or approximate them from method of Chung
         if (!viscosity.HasMember("sigma_eta") || !viscosity.HasMember("epsilon_over_k")) {
@@ -923,7 +928,7 @@ class JSONFluidLibrary
     /// Parse the thermal conductivity data
     void parse_thermal_conductivity(rapidjson::Value& conductivity, CoolPropFluid& fluid) {
         // Load the BibTeX key
-        fluid.transport.BibTeX_conductivity = cpjson::get_string(conductivity, "BibTeX");
+        fluid.metadata->BibTeXKeys.CONDUCTIVITY = cpjson::get_string(conductivity, "BibTeX");
 
         // If it is using ECS, set ECS parameters and quit
         if (conductivity.HasMember("type") && !cpjson::get_string(conductivity, "type").compare("ECS")) {
@@ -1182,29 +1187,12 @@ class JSONFluidLibrary
     /// Add all the fluid entries in the rapidjson::Value instance passed in
     void add_many(rapidjson::Value& listing);
 
-    void add_one(rapidjson::Value& fluid_json);
-
-    std::string get_JSONstring(const std::string& key) {
-        // Try to find it
-        std::map<std::string, std::size_t>::const_iterator it = string_to_index_map.find(key);
-        if (it != string_to_index_map.end()) {
+    /// Add one fluid entry; embedded_position is the position of the entry in the embedded JSON source, or std::string::npos
+    /// if the entry comes from elsewhere, in which case its JSON string is kept
+    void add_one(rapidjson::Value& fluid_json, std::size_t embedded_position = std::string::npos);
 
-            std::map<std::size_t, std::string>::const_iterator it2 = JSONstring_map.find(it->second);
-            if (it2 != JSONstring_map.end()) {
-                // Then, load the fluids we would like to add
-                rapidjson::Document doc;
-                cpjson::JSON_string_to_rapidjson(it2->second, doc);
-                rapidjson::Document doc2;
-                doc2.SetArray();
-                doc2.PushBack(doc, doc.GetAllocator());
-                return cpjson::json2string(doc2);
-            } else {
-                throw ValueError(format("Unable to obtain JSON string for this identifier [%d]", it->second));
-            }
-        } else {
-            throw ValueError(format("Unable to obtain index for this identifier [%s]", key.c_str()));
-        }
-    }
+    /// Get the JSON string of a fluid, as an array with one entry
+    std::string get_JSONstring(const std::string& key);
 
     /// Get a CoolPropFluid instance stored in this library
     /**
@@ -1319,8 +1307,20 @@ class JSONFluidLibrary
     std::string get_fluid_list(void) {
         return strjoin(name_vector, get_config_string(LIST_STRING_DELIMITER));
     };
+    /// Return the number of fluids in the library
+    std::size_t size(void) const {
+        return fluid_map.size();
+    };
+    /// The memory used by the fluids and by the lookup tables of their names, in bytes (see fluid_memory_footprint)
+    std::size_t memory_footprint(void) const;
+    /// The memory used by the references to the JSON sources of the fluids, kept for get_fluid_as_JSONstring, in bytes
+    std::size_t JSON_memory_footprint(void) const;
 };
 
+/// The memory used by a fluid, in bytes; an estimate that includes the equations of state, the ancillaries and the
+/// names, but not the (small) coefficient vectors of the transport models, nor the descriptive data, which the copies share
+std::size_t fluid_memory_footprint(const CoolPropFluid& fluid);
+
 /// Get a reference to the library instance
 JSONFluidLibrary& get_library(void);
 
@@ -0,0 +1,167 @@
+
+#include "GERG2008Backend.h"
+#include "Fluids/FluidLibrary.h"
+
+#include <algorithm>
+
+namespace CoolProp {
+
+void GERG2008ResidualHelmholtz::append_block(const ResidualHelmholtzGeneralizedExponential& source, std::size_t i, std::size_t j) {
+    TermBlock block;
+    block.begin = terms.elements.size();
+    block.i = i;
+    block.j = j;
+    for (std::size_t k = 0; k < source.elements.size(); ++k) {
+        terms.elements.push_back(source.elements[k]);
+        n_unweighted.push_back(source.elements[k].n);
+    }
+    block.end = terms.elements.size();
+    blocks.push_back(block);
+    // The parts of u that are evaluated must cover all the sources
+    terms.delta_li_in_u = terms.delta_li_in_u || source.delta_li_in_u;
+    terms.tau_mi_in_u = terms.tau_mi_in_u || source.tau_mi_in_u;
+    terms.eta1_in_u = terms.eta1_in_u || source.eta1_in_u;
+    terms.eta2_in_u = terms.eta2_in_u || source.eta2_in_u;
+    terms.beta1_in_u = terms.beta1_in_u || source.beta1_in_u;
+    terms.beta2_in_u = terms.beta2_in_u || source.beta2_in_u;
+}
+void GERG2008ResidualHelmholtz::build(HelmholtzEOSMixtureBackend& HEOS) {
+    std::vector<CoolPropFluid>& components = HEOS.get_components();
+    std::size_t N = components.size();
+
+    terms = ResidualHelmholtzGeneralizedExponential();
+    n_unweighted.clear();
+    blocks.clear();
+    other_terms.clear();
+
+    // The pure fluids
+    for (std::size_t i = 0; i < N; ++i) {
+        ResidualHelmholtzContainer& alphar = components[i].EOS().alphar;
+        append_block(alphar.GenExp, i, std::string::npos);
+        if (alphar.NonAnalytic.N > 0 || !alphar.SAFT.disabled || alphar.cubic.enabled || alphar.XiangDeiters.enabled || alphar.GaoB.enabled) {
+            other_terms.push_back(i);
+        }
+    }
+    // The departure functions of the binary pairs, skipping the pairs without one
+    if (Excess.N == N) {
+        for (std::size_t i = 0; i < N; ++i) {
+            for (std::size_t j = i + 1; j < N; ++j) {
+                if (std::abs(Excess.F[i][j]) > DBL_EPSILON && Excess.DepartureFunctionMatrix[i][j]) {
+                    append_block(Excess.DepartureFunctionMatrix[i][j]->phi, i, j);
+                }
+            }
+        }
+    }
+    terms.finish();
+    weighted_x.clear();
+    layout_valid = true;
+}
+
+void GERG2008ResidualHelmholtz::set_weights(const std::vector<CoolPropDbl>& x) {
+    for (std::vector<TermBlock>::const_iterator it = blocks.begin(); it != blocks.end(); ++it) {
+        CoolPropDbl w = (it->j == std::string::npos) ? x[it->i] : x[it->i] * x[it->j] * Excess.F[it->i][it->j];
+        // Only the coefficients change, so the cached factors of the terms stay valid
+        for (std::size_t k = it->begin; k < it->end; ++k) {
+            terms.elements[k].n = w * n_unweighted[k];
+        }
+    }
+    weighted_x = x;
+}
+
+HelmholtzDerivatives GERG2008ResidualHelmholtz::all(HelmholtzEOSMixtureBackend& HEOS, const std::vector<CoolPropDbl>& mole_fractions, double tau,
+                                                    double delta, bool cache_values) {
+    ++evaluations;
+    if (!layout_valid) {
+        build(HEOS);
+    }
+    if (mole_fractions != weighted_x) {
+        set_weights(mole_fractions);
+    }
+    HelmholtzDerivatives a;
+    terms.all(tau, delta, a);
+    for (std::vector<std::size_t>::const_iterator it = other_terms.begin(); it != other_terms.end(); ++it) {
+        ResidualHelmholtzContainer& alphar = HEOS.get_components()[*it].EOS().alphar;
+        HelmholtzDerivatives b;
+        alphar.NonAnalytic.all(tau, delta, b);
+        alphar.SAFT.all(tau, delta, b);
+        alphar.cubic.all(tau, delta, b);
+        alphar.XiangDeiters.all(tau, delta, b);
+        alphar.GaoB.all(tau, delta, b);
+        a = a + b * mole_fractions[*it];
+    }
+    a.delta_x_dalphar_ddelta = delta * a.dalphar_ddelta;
+    a.tau_x_dalphar_dtau = tau * a.dalphar_dtau;
+
+    a.delta2_x_d2alphar_ddelta2 = POW2(delta) * a.d2alphar_ddelta2;
+    a.deltatau_x_d2alphar_ddelta_dtau = delta * tau * a.d2alphar_ddelta_dtau;
+    a.tau2_x_d2alphar_dtau2 = POW2(tau) * a.d2alphar_dtau2;
+
+    return a;
+}
+
+GERG2008Backend::GERG2008Backend(const std::vector<std::string>& component_names, bool generate_SatL_and_SatV) : HelmholtzEOSMixtureBackend() {
+    std::vector<CoolPropFluid> components(component_names.size());
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        components[i] = get_library().get(component_names[i]);
+    }
+    set_GERG2008_components(components, generate_SatL_and_SatV);
+}
+GERG2008Backend::GERG2008Backend(const std::vector<CoolPropFluid>& components, bool generate_SatL_and_SatV) : HelmholtzEOSMixtureBackend() {
+    set_GERG2008_components(components, generate_SatL_and_SatV);
+}
+void GERG2008Backend::set_GERG2008_components(const std::vector<CoolPropFluid>& components, bool generate_SatL_and_SatV) {
+    for (std::size_t i = 0; i < components.size(); ++i) {
+        if (!is_GERG2008_component(components[i].CAS)) {
+            throw ValueError(format("The fluid [%s] is not one of the components of GERG-2008", components[i].name.c_str()));
+        }
+    }
+    // The residual Helmholtz energy class must be in place before the mixture parameters are set
+    residual_helmholtz.reset(new GERG2008ResidualHelmholtz());
+
+    // Set the components and associated flags
+    set_components(components, generate_SatL_and_SatV);
+
+    // Set the phase to default unknown value
+    _phase = iphase_unknown;
+}
+HelmholtzEOSMixtureBackend* GERG2008Backend::get_copy(bool generate_SatL_and_SatV) {
+    // Set up the class with these components
+    GERG2008Backend* ptr = new GERG2008Backend(components, generate_SatL_and_SatV);
+    // Recursively walk into linked states, setting the departure and reducing terms
+    // to be equal to the parent (this instance)
+    ptr->sync_linked_states(this);
+    ptr->set_tolerance_tier(_tolerance_tier);
+    return ptr;
+}
+bool GERG2008Backend::is_GERG2008_component(const std::string& CAS) {
+    // Methane, nitrogen, carbon dioxide, ethane, propane, n-butane, isobutane, n-pentane, isopentane, n-hexane, n-heptane,
+    // n-octane, n-nonane, n-decane, hydrogen, oxygen, carbon monoxide, water, hydrogen sulfide, helium and argon
+    static const char* const GERG2008_CAS[] = {"74-82-8",  "7727-37-9", "124-38-9", "74-84-0",   "74-98-6",   "106-97-8",  "75-28-5",
+                                               "109-66-0", "78-78-4",   "110-54-3", "142-82-5",  "111-65-9",  "111-84-2",  "124-18-5",
+                                               "1333-74-0", "7782-44-7", "630-08-0", "7732-18-5", "7783-06-4", "7440-59-7", "7440-37-1"};
+    const std::size_t N = sizeof(GERG2008_CAS) / sizeof(GERG2008_CAS[0]);
+    return std::find(GERG2008_CAS, GERG2008_CAS + N, CAS) != GERG2008_CAS + N;
+}
+void GERG2008Backend::invalidate_residual_helmholtz() {
+    GERG2008ResidualHelmholtz* residual = dynamic_cast<GERG2008ResidualHelmholtz*>(residual_helmholtz.get());
+    if (residual) {
+        residual->invalidate();
+    }
+}
+void GERG2008Backend::set_binary_interaction_double(const std::size_t i, const std::size_t j, const std::string& parameter, const double value) {
+    HelmholtzEOSMixtureBackend::set_binary_interaction_double(i, j, parameter, value);
+    if (parameter == "Fij") {
+        invalidate_residual_helmholtz();
+    }
+}
+void GERG2008Backend::set_binary_interaction_string(const std::size_t i, const std::size_t j, const std::string& parameter,
+                                                    const std::string& value) {
+    HelmholtzEOSMixtureBackend::set_binary_interaction_string(i, j, parameter, value);
+    invalidate_residual_helmholtz();
+}
+void GERG2008Backend::calc_change_EOS(const std::size_t i, const std::string& EOS_name) {
+    HelmholtzEOSMixtureBackend::calc_change_EOS(i, EOS_name);
+    invalidate_residual_helmholtz();
+}
+
+} /* namespace CoolProp */
@@ -0,0 +1,176 @@
+
+#ifndef GERG2008BACKEND_H_
+#define GERG2008BACKEND_H_
+
+#include "HelmholtzEOSMixtureBackend.h"
+
+#include <vector>
+
+namespace CoolProp {
+
+/// The residual Helmholtz energy of a mixture of the GERG-2008 natural gas components
+///
+/// The terms of the pure fluids and of the departure functions of all the binary pairs are collected into one generalized
+/// exponential term, with the coefficients scaled by \f$x_i\f$ (pure fluids) or \f$x_ix_jF_{ij}\f$ (departure functions).
+/// All the derivatives that do not involve the composition are then obtained in one pass over one contiguous set of terms.
+/// The factors of each term that only depend on \f$\tau\f$ or \f$\delta\f$ are cached by the collected term between calls; terms
+/// of different fluids or pairs with the same exponents are not merged, so their factors are calculated once per term.
+/// The cached departure functions of the excess term are only needed for the composition derivatives, so they are only
+/// updated once one of those is requested.
+class GERG2008ResidualHelmholtz : public ResidualHelmholtz
+{
+   protected:
+    /// A contiguous range [begin, end) of the collected terms, from pure fluid i (j = npos) or from the departure function of pair (i, j)
+    struct TermBlock
+    {
+        std::size_t begin, end, i, j;
+    };
+    ResidualHelmholtzGeneralizedExponential terms;  ///< The collected terms, with the weighted coefficients
+    std::vector<CoolPropDbl> n_unweighted;          ///< The coefficients of the collected terms before weighting
+    std::vector<TermBlock> blocks;                  ///< The source of each range of the collected terms
+    std::vector<std::size_t> other_terms;           ///< The pure fluids that also have terms that are not generalized exponential terms
+    std::vector<CoolPropDbl> weighted_x;            ///< The mole fractions used to weight the coefficients
+    bool layout_valid, excess_current;
+    double excess_tau, excess_delta;
+
+    /// Append the terms of a pure fluid (j = npos) or of the departure function of pair (i, j) to the collected terms
+    void append_block(const ResidualHelmholtzGeneralizedExponential& source, std::size_t i, std::size_t j);
+    /// Collect the terms of the pure fluids and of the departure functions
+    void build(HelmholtzEOSMixtureBackend& HEOS);
+    /// Scale the coefficients of the collected terms for these mole fractions
+    void set_weights(const std::vector<CoolPropDbl>& x);
+    /// Update the cached departure functions at the state of the last update, if not already done
+    void check_excess() {
+        if (!excess_current) {
+            Excess.update(excess_tau, excess_delta);
+            excess_current = true;
+        }
+    }
+
+   public:
+    GERG2008ResidualHelmholtz() : layout_valid(false), excess_current(false), excess_tau(_HUGE), excess_delta(_HUGE){};
+    GERG2008ResidualHelmholtz(const ExcessTerm& E, const CorrespondingStatesTerm& C)
+      : ResidualHelmholtz(E, C), layout_valid(false), excess_current(false), excess_tau(_HUGE), excess_delta(_HUGE){};
+
+    ResidualHelmholtz* copy_ptr() {
+        return new GERG2008ResidualHelmholtz(Excess.copy(), CS);
+    }
+    /// The terms must be collected again; to be called when an equation of state, a departure function or F_ij is changed
+    void invalidate() {
+        layout_valid = false;
+        excess_current = false;
+    }
+    void update_excess(double tau, double delta) {
+        excess_tau = tau;
+        excess_delta = delta;
+        excess_current = false;
+    }
+
+    HelmholtzDerivatives all(HelmholtzEOSMixtureBackend& HEOS, const std::vector<CoolPropDbl>& mole_fractions, double tau, double delta,
+                             bool cache_values = false);
+
+    CoolPropDbl dalphar_dxi(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::dalphar_dxi(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d2alphardxidxj(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d2alphardxidxj(HEOS, i, j, xN_flag);
+    }
+    CoolPropDbl d2alphar_dxi_dTau(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d2alphar_dxi_dTau(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d2alphar_dxi_dDelta(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d2alphar_dxi_dDelta(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d3alphar_dxi_dTau2(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d3alphar_dxi_dTau2(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d3alphar_dxi_dDelta_dTau(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d3alphar_dxi_dDelta_dTau(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d3alphar_dxi_dDelta2(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d3alphar_dxi_dDelta2(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d3alphar_dxi_dxj_dTau(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d3alphar_dxi_dxj_dTau(HEOS, i, j, xN_flag);
+    }
+    CoolPropDbl d3alphar_dxi_dxj_dDelta(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d3alphar_dxi_dxj_dDelta(HEOS, i, j, xN_flag);
+    }
+    CoolPropDbl d3alphardxidxjdxk(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, std::size_t k, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d3alphardxidxjdxk(HEOS, i, j, k, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dTau3(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dTau3(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dDelta2_dTau(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dDelta2_dTau(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dDelta_dTau2(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dDelta_dTau2(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dDelta3(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dDelta3(HEOS, i, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dxj_dTau2(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dxj_dTau2(HEOS, i, j, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dxj_dDelta_dTau(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dxj_dDelta_dTau(HEOS, i, j, xN_flag);
+    }
+    CoolPropDbl d4alphar_dxi_dxj_dDelta2(HelmholtzEOSMixtureBackend& HEOS, std::size_t i, std::size_t j, x_N_dependency_flag xN_flag) {
+        check_excess();
+        return ResidualHelmholtz::d4alphar_dxi_dxj_dDelta2(HEOS, i, j, xN_flag);
+    }
+};
+
+/** \brief A backend for natural gases, limited to the 21 components of the GERG-2008 model
+ *
+ * The pure fluids, reducing functions and departure functions are the same as those of the HEOS backend, so the results
+ * agree with those of HEOS to within round-off, but the residual Helmholtz energy is evaluated by the GERG2008ResidualHelmholtz
+ * class.  For the fastest single-phase (p,T), (p,h) and (p,s) flashes, impose the gas phase with specify_phase(iphase_gas)
+ */
+class GERG2008Backend : public HelmholtzEOSMixtureBackend
+{
+   protected:
+    /// Throw if a component is not one of the components of GERG-2008, and install the residual Helmholtz energy
+    void set_GERG2008_components(const std::vector<CoolPropFluid>& components, bool generate_SatL_and_SatV);
+    /// Collect the terms of the residual Helmholtz energy again at the next evaluation; the linked states are also
+    /// instances of this class, and the base class passes the changes on to them
+    void invalidate_residual_helmholtz();
+
+   public:
+    GERG2008Backend(const std::vector<std::string>& component_names, bool generate_SatL_and_SatV = true);
+    GERG2008Backend(const std::vector<CoolPropFluid>& components, bool generate_SatL_and_SatV = true);
+    virtual ~GERG2008Backend(){};
+
+    HelmholtzEOSMixtureBackend* get_copy(bool generate_SatL_and_SatV = true);
+    std::string backend_name(void) {
+        return get_backend_string(GERG2008_BACKEND);
+    }
+
+    /// Return true if the fluid with this CAS number is one of the 21 components of GERG-2008
+    static bool is_GERG2008_component(const std::string& CAS);
+
+    void set_binary_interaction_double(const std::size_t i, const std::size_t j, const std::string& parameter, const double value);
+    void set_binary_interaction_string(const std::size_t i, const std::size_t j, const std::string& parameter, const std::string& value);
+    void calc_change_EOS(const std::size_t i, const std::string& EOS_name);
+};
+
+} /* namespace CoolProp */
+#endif /* GERG2008BACKEND_H_ */
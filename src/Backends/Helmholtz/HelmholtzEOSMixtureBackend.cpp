@@ -35,10 +35,11 @@
 #include "MixtureParameters.h"
 #include "IdealCurves.h"
 #include "MixtureParameters.h"
+#if !defined(NO_TABULAR_BACKENDS)
+#    include "Backends/Tabular/TransportSurrogate.h"
+#endif
 #include <stdlib.h>
 
-static int deriv_counter = 0;
-
 namespace CoolProp {
 
 class HEOSGenerator : public AbstractStateGenerator
@@ -107,6 +108,9 @@ void HelmholtzEOSMixtureBackend::set_components(const std::vector<CoolPropFluid>
 
     imposed_phase_index = iphase_not_imposed;
 
+    // The transport models are resolved again for the new components
+    transport_plan = TransportPlan();
+
     // Top-level class can hold copies of the base saturation classes,
     // saturation classes cannot hold copies of the saturation classes
     if (generate_SatL_and_SatV) {
@@ -132,6 +136,7 @@ void HelmholtzEOSMixtureBackend::sync_linked_states(const HelmholtzEOSMixtureBac
     if (source->Reducing) {
         Reducing.reset(source->Reducing->copy());
     }
+    clear_model_caches();
     // Recurse into linked states of the class
     for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
         it->get()->sync_linked_states(source);
@@ -143,8 +148,181 @@ HelmholtzEOSMixtureBackend* HelmholtzEOSMixtureBackend::get_copy(bool generate_S
     // Recursively walk into linked states, setting the departure and reducing terms
     // to be equal to the parent (this instance)
     ptr->sync_linked_states(this);
+    ptr->set_tolerance_tier(_tolerance_tier);
     return ptr;
 };
+void HelmholtzEOSMixtureBackend::calc_set_tolerance_tier(tolerance_tiers tier) {
+    _tolerance_tier = tier;
+    // SatL and SatV are also in the linked states
+    for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
+        it->get()->set_tolerance_tier(tier);
+    }
+}
+void HelmholtzEOSMixtureBackend::calc_save_update_cache_entry(UpdateCacheEntry& entry) {
+    entry.T = _T;
+    entry.rhomolar = _rhomolar;
+    entry.p = _p;
+    entry.Q = _Q;
+    entry.phase = _phase;
+    entry.x.clear();
+    entry.y.clear();
+    if (_phase == iphase_twophase) {
+        entry.TL = SatL->T();
+        entry.rhomolarL = SatL->rhomolar();
+        entry.pL = SatL->p();
+        entry.TV = SatV->T();
+        entry.rhomolarV = SatV->rhomolar();
+        entry.pV = SatV->p();
+        if (!is_pure_or_pseudopure) {
+            entry.x = SatL->get_mole_fractions();
+            entry.y = SatV->get_mole_fractions();
+        }
+    } else {
+        entry.TL = entry.rhomolarL = entry.pL = _HUGE;
+        entry.TV = entry.rhomolarV = entry.pV = _HUGE;
+    }
+}
+void HelmholtzEOSMixtureBackend::calc_restore_update_cache_entry(const UpdateCacheEntry& entry) {
+    if (entry.phase == iphase_twophase) {
+        if (!is_pure_or_pseudopure) {
+            SatL->set_mole_fractions(entry.x);
+            SatV->set_mole_fractions(entry.y);
+        }
+        SatL->restore_state_essentials(entry.TL, entry.rhomolarL, entry.pL, 0, iphase_liquid);
+        SatV->restore_state_essentials(entry.TV, entry.rhomolarV, entry.pV, 1, iphase_gas);
+    }
+    restore_state_essentials(entry.T, entry.rhomolar, entry.p, entry.Q, entry.phase);
+}
+void HelmholtzEOSMixtureBackend::calc_snapshot(std::vector<double>& buffer) {
+    UpdateCacheEntry entry;
+    calc_save_update_cache_entry(entry);
+    snapshot_vector(buffer, get_mole_fractions_ref());
+    buffer.push_back(entry.T);
+    buffer.push_back(entry.rhomolar);
+    buffer.push_back(entry.p);
+    buffer.push_back(entry.Q);
+    buffer.push_back(static_cast<double>(entry.phase));
+    buffer.push_back(entry.TL);
+    buffer.push_back(entry.rhomolarL);
+    buffer.push_back(entry.pL);
+    buffer.push_back(entry.TV);
+    buffer.push_back(entry.rhomolarV);
+    buffer.push_back(entry.pV);
+    snapshot_vector(buffer, entry.x);
+    snapshot_vector(buffer, entry.y);
+    snapshot_vector(buffer, K);
+    snapshot_vector(buffer, lnK);
+}
+void HelmholtzEOSMixtureBackend::calc_restore(const std::vector<double>& buffer, std::size_t& i) {
+    UpdateCacheEntry entry;
+    std::vector<CoolPropDbl> K_snapshot, lnK_snapshot;
+    restore_vector(buffer, i, entry.z);
+    entry.T = restore_value(buffer, i);
+    entry.rhomolar = restore_value(buffer, i);
+    entry.p = restore_value(buffer, i);
+    entry.Q = restore_value(buffer, i);
+    entry.phase = static_cast<phases>(static_cast<int>(restore_value(buffer, i)));
+    entry.TL = restore_value(buffer, i);
+    entry.rhomolarL = restore_value(buffer, i);
+    entry.pL = restore_value(buffer, i);
+    entry.TV = restore_value(buffer, i);
+    entry.rhomolarV = restore_value(buffer, i);
+    entry.pV = restore_value(buffer, i);
+    restore_vector(buffer, i, entry.x);
+    restore_vector(buffer, i, entry.y);
+    restore_vector(buffer, i, K_snapshot);
+    restore_vector(buffer, i, lnK_snapshot);
+    restore_end(buffer, i);
+    if (entry.z.size() != N) {
+        throw ValueError(format("The snapshot is of a state with %d components, not %d", entry.z.size(), N));
+    }
+    if (entry.phase == iphase_twophase && (!SatL || !SatV || (!is_pure_or_pseudopure && (entry.x.size() != N || entry.y.size() != N)))) {
+        throw ValueError("The saturated phases of the snapshot cannot be restored in this state");
+    }
+    if (entry.z != get_mole_fractions_ref()) {
+        set_mole_fractions(entry.z);
+    }
+    calc_restore_update_cache_entry(entry);
+    K.swap(K_snapshot);
+    lnK.swap(lnK_snapshot);
+}
+std::string HelmholtzEOSMixtureBackend::calc_snapshot_fluids(void) {
+    if (components.empty()) {
+        // The cubics have their own components
+        return AbstractState::calc_snapshot_fluids();
+    }
+    std::string fluids;
+    for (std::vector<CoolPropFluid>::const_iterator it = components.begin(); it != components.end(); ++it) {
+        fluids += it->name + "|" + it->CAS + "|" + it->get_metadata().BibTeXKeys.EOS + "&";
+    }
+    return fluids;
+}
+void HelmholtzEOSMixtureBackend::calc_compressible_flow_state(double rhomass, double umass, CompressibleFlowState& state) {
+    // Start from the temperature that was passed in, or else from the last state of this instance (a neighboring cell, usually)
+    CoolPropDbl T0 = (ValidNumber(state.T) && state.T > 0) ? static_cast<CoolPropDbl>(state.T) : _T;
+    if (is_pure_or_pseudopure && imposed_phase_index == iphase_not_imposed && ValidNumber(T0) && T0 > 0) {
+        CoolPropDbl M = molar_mass();
+        if (FlashRoutines::DU_flash_singlephase_Newton(*this, rhomass / M, umass * M, T0)) {
+            fill_compressible_flow_state(state);
+            return;
+        }
+    }
+    AbstractState::calc_compressible_flow_state(rhomass, umass, state);
+}
+std::size_t HelmholtzEOSMixtureBackend::calc_memory_footprint(void) {
+    std::size_t bytes = AbstractState::calc_memory_footprint() + sizeof(HelmholtzEOSMixtureBackend) - sizeof(AbstractState);
+    bytes += (components.capacity() - components.size()) * sizeof(CoolPropFluid);
+    for (std::vector<CoolPropFluid>::const_iterator it = components.begin(); it != components.end(); ++it) {
+        bytes += fluid_memory_footprint(*it);
+    }
+    bytes += (get_mole_fractions_ref().capacity() + K.capacity() + lnK.capacity()) * sizeof(CoolPropDbl);
+    bytes += PhaseEnvelope.memory_footprint();
+    bytes += isotherm_stationary_points.capacity() * sizeof(IsothermStationaryPoints);
+    for (std::size_t i = 0; i < isotherm_stationary_points.size(); ++i) {
+        bytes += isotherm_stationary_points[i].z.capacity() * sizeof(CoolPropDbl);
+    }
+    bytes += (linked_states.capacity() + transport_plan.pure_components.capacity()) * sizeof(shared_ptr<HelmholtzEOSMixtureBackend>);
+    return bytes;
+}
+void HelmholtzEOSMixtureBackend::calc_child_states(std::vector<AbstractState*>& children) {
+    children.push_back(SatL.get());
+    children.push_back(SatV.get());
+    // The transient pure state, the TPD state and the critical state are also linked states
+    for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::const_iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
+        children.push_back(it->get());
+    }
+    children.push_back(cubic_guess_state.get());
+    children.push_back(transport_plan.viscosity_ECS_reference.get());
+    children.push_back(transport_plan.conductivity_ECS_reference.get());
+    for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::const_iterator it = transport_plan.pure_components.begin();
+         it != transport_plan.pure_components.end(); ++it) {
+        children.push_back(it->get());
+    }
+}
+void HelmholtzEOSMixtureBackend::restore_state_essentials(CoolPropDbl T, CoolPropDbl rhomolar, CoolPropDbl p, CoolPropDbl Q, phases phase) {
+    clear();
+    gas_constant();
+    calc_reducing_state();
+    _T = T;
+    _rhomolar = rhomolar;
+    _p = p;
+    _Q = Q;
+    _phase = phase;
+    post_update(false);
+}
+void HelmholtzEOSMixtureBackend::set_saturated_states(CoolPropDbl T, CoolPropDbl rhomolarL, CoolPropDbl rhomolarV, CoolPropDbl pL,
+                                                      CoolPropDbl pV, const std::vector<CoolPropDbl>& x, const std::vector<CoolPropDbl>& y) {
+    if (!SatL || !SatV) {
+        return;
+    }
+    if (!is_pure_or_pseudopure) {
+        SatL->set_mole_fractions(x);
+        SatV->set_mole_fractions(y);
+    }
+    // No call to the EOS here, the properties of the saturated states are calculated (and cached) when they are first requested
+    SatL->restore_state_essentials(T, rhomolarL, pL, 0, iphase_liquid);
+    SatV->restore_state_essentials(T, rhomolarV, pV, 1, iphase_gas);
+}
 void HelmholtzEOSMixtureBackend::set_mass_fractions(const std::vector<CoolPropDbl>& mass_fractions) {
     if (mass_fractions.size() != N) {
         throw ValueError(format("size of mass fraction vector [%d] does not equal that of component vector [%d]", mass_fractions.size(), N));
@@ -193,7 +371,8 @@ void HelmholtzEOSMixtureBackend::recalculate_singlephase_phase() {
     }
 }
 std::string HelmholtzEOSMixtureBackend::fluid_param_string(const std::string& ParamName) {
-    CoolProp::CoolPropFluid cpfluid = get_components()[0];
+    const CoolProp::CoolPropFluid& cpfluid = get_components()[0];
+    const CoolProp::FluidMetadata& metadata = cpfluid.get_metadata();
     if (!ParamName.compare("name")) {
         return cpfluid.name;
     } else if (!ParamName.compare("aliases")) {
@@ -201,11 +380,11 @@ std::string HelmholtzEOSMixtureBackend::fluid_param_string(const std::string& Pa
     } else if (!ParamName.compare("CAS") || !ParamName.compare("CAS_number")) {
         return cpfluid.CAS;
     } else if (!ParamName.compare("formula")) {
-        return cpfluid.formula;
+        return metadata.formula;
     } else if (!ParamName.compare("ASHRAE34")) {
-        return cpfluid.environment.ASHRAE34;
+        return metadata.ASHRAE34;
     } else if (!ParamName.compare("REFPROPName") || !ParamName.compare("REFPROP_name") || !ParamName.compare("REFPROPname")) {
-        return cpfluid.REFPROPname;
+        return metadata.REFPROPname;
     } else if (ParamName.find("BibTeX") == 0)  // Starts with "BibTeX"
     {
         std::vector<std::string> parts = strsplit(ParamName, '-');
@@ -214,13 +393,13 @@ std::string HelmholtzEOSMixtureBackend::fluid_param_string(const std::string& Pa
         }
         std::string key = parts[1];
         if (!key.compare("EOS")) {
-            return cpfluid.EOS().BibTeX_EOS;
+            return metadata.BibTeXKeys.EOS;
         } else if (!key.compare("CP0")) {
-            return cpfluid.EOS().BibTeX_CP0;
+            return metadata.BibTeXKeys.CP0;
         } else if (!key.compare("VISCOSITY")) {
-            return cpfluid.transport.BibTeX_viscosity;
+            return metadata.BibTeXKeys.VISCOSITY;
         } else if (!key.compare("CONDUCTIVITY")) {
-            return cpfluid.transport.BibTeX_conductivity;
+            return metadata.BibTeXKeys.CONDUCTIVITY;
         } else if (!key.compare("ECS_LENNARD_JONES")) {
             throw NotImplementedError();
         } else if (!key.compare("ECS_VISCOSITY_FITS")) {
@@ -241,15 +420,15 @@ std::string HelmholtzEOSMixtureBackend::fluid_param_string(const std::string& Pa
             return "false";
         }
     } else if (ParamName == "INCHI" || ParamName == "InChI" || ParamName == "INCHI_STRING") {
-        return cpfluid.InChI;
+        return metadata.InChI;
     } else if (ParamName == "INCHI_Key" || ParamName == "InChIKey" || ParamName == "INCHIKEY") {
-        return cpfluid.InChIKey;
+        return metadata.InChIKey;
     } else if (ParamName == "2DPNG_URL") {
-        return cpfluid.TwoDPNG_URL;
+        return metadata.TwoDPNG_URL;
     } else if (ParamName == "SMILES" || ParamName == "smiles") {
-        return cpfluid.smiles;
+        return metadata.smiles;
     } else if (ParamName == "CHEMSPIDER_ID") {
-        return format("%d", cpfluid.ChemSpider_id);
+        return format("%d", metadata.ChemSpider_id);
     } else if (ParamName == "JSON") {
         return get_fluid_as_JSONstring(cpfluid.CAS);
     } else {
@@ -309,6 +488,8 @@ void HelmholtzEOSMixtureBackend::set_binary_interaction_double(const std::size_t
     for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
         it->get()->set_binary_interaction_double(i, j, parameter, value);
     }
+    // The cached states and isotherms are no longer valid
+    clear_model_caches();
 };
 /// Get binary mixture floating point parameter for this instance
 double HelmholtzEOSMixtureBackend::get_binary_interaction_double(const std::size_t i, const std::size_t j, const std::string& parameter) {
@@ -355,6 +536,8 @@ void HelmholtzEOSMixtureBackend::set_binary_interaction_string(const std::size_t
     for (std::vector<shared_ptr<HelmholtzEOSMixtureBackend>>::iterator it = linked_states.begin(); it != linked_states.end(); ++it) {
         it->get()->set_binary_interaction_string(i, j, parameter, value);
     }
+    // The cached states and isotherms are no longer valid
+    clear_model_caches();
 };
 
 void HelmholtzEOSMixtureBackend::calc_change_EOS(const std::size_t i, const std::string& EOS_name) {
@@ -404,6 +587,12 @@ void HelmholtzEOSMixtureBackend::calc_change_EOS(const std::size_t i, const std:
     // Now do the same thing to the saturated liquid and vapor instances if possible
     if (this->SatL) SatL->change_EOS(i, EOS_name);
     if (this->SatV) SatV->change_EOS(i, EOS_name);
+    // The cached states and isotherms are no longer valid
+    clear_model_caches();
+    // The cached pure-component states of the mixture transport models and the transport tables use the old equation of state
+    transport_plan.pure_components.clear();
+    transport_plan.surrogate.reset();
+    transport_plan.surrogate_resolved = true;
 }
 void HelmholtzEOSMixtureBackend::calc_phase_envelope(const std::string& type) {
     // Clear the phase envelope data
@@ -559,39 +748,265 @@ CoolPropDbl HelmholtzEOSMixtureBackend::calc_surface_tension(void) {
         throw NotImplementedError(format("surface tension not implemented for mixtures"));
     }
 }
-CoolPropDbl HelmholtzEOSMixtureBackend::calc_viscosity_dilute(void) {
-    if (is_pure_or_pseudopure) {
-        CoolPropDbl eta_dilute;
-        switch (components[0].transport.viscosity_dilute.type) {
+void HelmholtzEOSMixtureBackend::resolve_viscosity_plan() {
+    if (transport_plan.viscosity_resolved) {
+        return;
+    }
+    TransportPlan plan = transport_plan;
+    CoolPropFluid& component = components[0];
+
+    if (!component.transport.viscosity_model_provided) {
+        throw ValueError(format("Viscosity model is not available for this fluid"));
+    }
+    if (component.transport.viscosity_using_ECS) {
+        // Get a managed pointer to the reference fluid for ECS
+        std::vector<std::string> names(1, component.transport.viscosity_ecs.reference_fluid);
+        plan.viscosity_ECS_reference.reset(new HelmholtzEOSMixtureBackend(names));
+    } else if (component.transport.viscosity_using_Chung) {
+        plan.viscosity_total = TransportRoutines::viscosity_Chung;
+    } else if (component.transport.viscosity_using_rhosr) {
+        plan.viscosity_total = TransportRoutines::viscosity_rhosr;
+    } else if (component.transport.hardcoded_viscosity != CoolProp::TransportPropertyData::VISCOSITY_NOT_HARDCODED) {
+        switch (component.transport.hardcoded_viscosity) {
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_WATER:
+                plan.viscosity_total = TransportRoutines::viscosity_water_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_HEAVYWATER:
+                plan.viscosity_total = TransportRoutines::viscosity_heavywater_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_HELIUM:
+                plan.viscosity_total = TransportRoutines::viscosity_helium_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_R23:
+                plan.viscosity_total = TransportRoutines::viscosity_R23_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_METHANOL:
+                plan.viscosity_total = TransportRoutines::viscosity_methanol_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_M_XYLENE:
+                plan.viscosity_total = TransportRoutines::viscosity_m_xylene_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_O_XYLENE:
+                plan.viscosity_total = TransportRoutines::viscosity_o_xylene_hardcoded;
+                break;
+            case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_P_XYLENE:
+                plan.viscosity_total = TransportRoutines::viscosity_p_xylene_hardcoded;
+                break;
+            default:
+                throw ValueError(
+                  format("hardcoded viscosity type [%d] is invalid for fluid %s", component.transport.hardcoded_viscosity, name().c_str()));
+        }
+    } else {
+        // Dilute part
+        switch (component.transport.viscosity_dilute.type) {
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_KINETIC_THEORY:
-                eta_dilute = TransportRoutines::viscosity_dilute_kinetic_theory(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_kinetic_theory;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_COLLISION_INTEGRAL:
-                eta_dilute = TransportRoutines::viscosity_dilute_collision_integral(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_collision_integral;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_POWERS_OF_T:
-                eta_dilute = TransportRoutines::viscosity_dilute_powers_of_T(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_powers_of_T;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_POWERS_OF_TR:
-                eta_dilute = TransportRoutines::viscosity_dilute_powers_of_Tr(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_powers_of_Tr;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_COLLISION_INTEGRAL_POWERS_OF_TSTAR:
-                eta_dilute = TransportRoutines::viscosity_dilute_collision_integral_powers_of_T(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_collision_integral_powers_of_T;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_ETHANE:
-                eta_dilute = TransportRoutines::viscosity_dilute_ethane(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_ethane;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_CYCLOHEXANE:
-                eta_dilute = TransportRoutines::viscosity_dilute_cyclohexane(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_cyclohexane;
                 break;
             case ViscosityDiluteVariables::VISCOSITY_DILUTE_CO2_LAESECKE_JPCRD_2017:
-                eta_dilute = TransportRoutines::viscosity_dilute_CO2_LaeseckeJPCRD2017(*this);
+                plan.viscosity_dilute = TransportRoutines::viscosity_dilute_CO2_LaeseckeJPCRD2017;
                 break;
             default:
                 throw ValueError(
-                  format("dilute viscosity type [%d] is invalid for fluid %s", components[0].transport.viscosity_dilute.type, name().c_str()));
+                  format("dilute viscosity type [%d] is invalid for fluid %s", component.transport.viscosity_dilute.type, name().c_str()));
+        }
+        // Initial density dependence
+        switch (component.transport.viscosity_initial.type) {
+            case ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_RAINWATER_FRIEND:
+                plan.viscosity_initial_density = TransportRoutines::viscosity_initial_density_dependence_Rainwater_Friend;
+                plan.viscosity_initial_density_times_dilute = true;
+                break;
+            case ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_EMPIRICAL:
+                plan.viscosity_initial_density = TransportRoutines::viscosity_initial_density_dependence_empirical;
+                break;
+            case ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_NOT_SET:
+                break;
+        }
+        // Higher order terms
+        switch (component.transport.viscosity_higher_order.type) {
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_BATSCHINKI_HILDEBRAND:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_higher_order_modified_Batschinski_Hildebrand;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_FRICTION_THEORY:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_higher_order_friction_theory;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_HYDROGEN:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_hydrogen_higher_order_hardcoded;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_TOLUENE:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_toluene_higher_order_hardcoded;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_HEXANE:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_hexane_higher_order_hardcoded;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_HEPTANE:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_heptane_higher_order_hardcoded;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_ETHANE:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_ethane_higher_order_hardcoded;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_BENZENE:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_benzene_higher_order_hardcoded;
+                break;
+            case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_CO2_LAESECKE_JPCRD_2017:
+                plan.viscosity_higher_order = TransportRoutines::viscosity_CO2_higher_order_hardcoded_LaeseckeJPCRD2017;
+                break;
+            default:
+                throw ValueError(format("higher order viscosity type [%d] is invalid for fluid %s", component.transport.viscosity_higher_order.type,
+                                        name().c_str()));
+        }
+    }
+    plan.viscosity_resolved = true;
+    transport_plan = plan;
+}
+void HelmholtzEOSMixtureBackend::resolve_conductivity_plan() {
+    if (transport_plan.conductivity_resolved) {
+        return;
+    }
+    TransportPlan plan = transport_plan;
+    CoolPropFluid& component = components[0];
+
+    if (!component.transport.conductivity_model_provided) {
+        throw ValueError(format("Thermal conductivity model is not available for this fluid"));
+    }
+    if (component.transport.conductivity_using_ECS) {
+        // Get a managed pointer to the reference fluid for ECS
+        std::vector<std::string> names(1, component.transport.conductivity_ecs.reference_fluid);
+        plan.conductivity_ECS_reference.reset(new HelmholtzEOSMixtureBackend(names));
+    } else if (component.transport.hardcoded_conductivity != CoolProp::TransportPropertyData::CONDUCTIVITY_NOT_HARDCODED) {
+        switch (component.transport.hardcoded_conductivity) {
+            case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_WATER:
+                plan.conductivity_total = TransportRoutines::conductivity_hardcoded_water;
+                break;
+            case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_HEAVYWATER:
+                plan.conductivity_total = TransportRoutines::conductivity_hardcoded_heavywater;
+                break;
+            case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_R23:
+                plan.conductivity_total = TransportRoutines::conductivity_hardcoded_R23;
+                break;
+            case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_HELIUM:
+                plan.conductivity_total = TransportRoutines::conductivity_hardcoded_helium;
+                break;
+            case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_METHANE:
+                plan.conductivity_total = TransportRoutines::conductivity_hardcoded_methane;
+                break;
+            default:
+                throw ValueError(format("hardcoded conductivity type [%d] is invalid for fluid %s", component.transport.hardcoded_conductivity,
+                                        name().c_str()));
         }
-        return eta_dilute;
+    } else {
+        // Dilute part
+        switch (component.transport.conductivity_dilute.type) {
+            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_RATIO_POLYNOMIALS:
+                plan.conductivity_dilute = TransportRoutines::conductivity_dilute_ratio_polynomials;
+                break;
+            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_ETA0_AND_POLY:
+                plan.conductivity_dilute = TransportRoutines::conductivity_dilute_eta0_and_poly;
+                break;
+            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_CO2:
+                plan.conductivity_dilute = TransportRoutines::conductivity_dilute_hardcoded_CO2;
+                break;
+            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_CO2_HUBER_JPCRD_2016:
+                plan.conductivity_dilute = TransportRoutines::conductivity_dilute_hardcoded_CO2_HuberJPCRD2016;
+                break;
+            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_ETHANE:
+                plan.conductivity_dilute = TransportRoutines::conductivity_dilute_hardcoded_ethane;
+                break;
+            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_NONE:
+                break;
+            default:
+                throw ValueError(
+                  format("dilute conductivity type [%d] is invalid for fluid %s", component.transport.conductivity_dilute.type, name().c_str()));
+        }
+        // Residual part
+        switch (component.transport.conductivity_residual.type) {
+            case ConductivityResidualVariables::CONDUCTIVITY_RESIDUAL_POLYNOMIAL:
+                plan.conductivity_residual = TransportRoutines::conductivity_residual_polynomial;
+                break;
+            case ConductivityResidualVariables::CONDUCTIVITY_RESIDUAL_POLYNOMIAL_AND_EXPONENTIAL:
+                plan.conductivity_residual = TransportRoutines::conductivity_residual_polynomial_and_exponential;
+                break;
+            default:
+                throw ValueError(format("residual conductivity type [%d] is invalid for fluid %s", component.transport.conductivity_residual.type,
+                                        name().c_str()));
+        }
+        // Critical part
+        switch (component.transport.conductivity_critical.type) {
+            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_SIMPLIFIED_OLCHOWY_SENGERS:
+                plan.conductivity_critical = TransportRoutines::conductivity_critical_simplified_Olchowy_Sengers;
+                break;
+            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_R123:
+                plan.conductivity_critical = TransportRoutines::conductivity_critical_hardcoded_R123;
+                break;
+            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_AMMONIA:
+                plan.conductivity_critical = TransportRoutines::conductivity_critical_hardcoded_ammonia;
+                break;
+            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_NONE:
+                break;
+            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_CARBONDIOXIDE_SCALABRIN_JPCRD_2006:
+                plan.conductivity_critical = TransportRoutines::conductivity_critical_hardcoded_CO2_ScalabrinJPCRD2006;
+                break;
+            default:
+                throw ValueError(format("critical conductivity type [%d] is invalid for fluid %s", component.transport.conductivity_critical.type,
+                                        name().c_str()));
+        }
+    }
+    plan.conductivity_resolved = true;
+    transport_plan = plan;
+}
+HelmholtzEOSMixtureBackend& HelmholtzEOSMixtureBackend::get_transport_pure_component(std::size_t i) {
+    if (transport_plan.pure_components.size() != components.size()) {
+        transport_plan.pure_components.resize(components.size());
+    }
+    if (!transport_plan.pure_components[i]) {
+        transport_plan.pure_components[i].reset(new HelmholtzEOSBackend(components[i]));
+    }
+    return *transport_plan.pure_components[i];
+}
+CoolPropDbl HelmholtzEOSMixtureBackend::transport_from_surrogate(parameters key) {
+#if !defined(NO_TABULAR_BACKENDS)
+    if (!transport_plan.surrogate_resolved) {
+        std::vector<std::string> fluids = strsplit(get_config_string(TRANSPORT_SURROGATE_FLUIDS), get_config_string(LIST_STRING_DELIMITER)[0]);
+        if (std::find(fluids.begin(), fluids.end(), name()) != fluids.end()) {
+            transport_plan.surrogate = TransportSurrogateData::get(*this);
+            transport_plan.surrogate_tolerance = get_config_double(TRANSPORT_SURROGATE_TOLERANCE);
+        }
+        transport_plan.surrogate_resolved = true;
+    }
+    if (transport_plan.surrogate) {
+        double value = (key == iviscosity) ? transport_plan.surrogate->viscosity(_T, _rhomolar, transport_plan.surrogate_tolerance)
+                                           : transport_plan.surrogate->conductivity(_T, _rhomolar, transport_plan.surrogate_tolerance);
+        if (ValidNumber(value)) {
+            return value;
+        }
+    }
+#endif
+    return _HUGE;
+}
+CoolPropDbl HelmholtzEOSMixtureBackend::calc_viscosity_dilute(void) {
+    if (is_pure_or_pseudopure) {
+        resolve_viscosity_plan();
+        if (transport_plan.viscosity_dilute == NULL) {
+            throw ValueError(format("The viscosity model of fluid %s does not have a dilute contribution", name().c_str()));
+        }
+        return transport_plan.viscosity_dilute(*this);
     } else {
         throw NotImplementedError(format("dilute viscosity not implemented for mixtures"));
     }
@@ -601,62 +1016,29 @@ CoolPropDbl HelmholtzEOSMixtureBackend::calc_viscosity_background() {
     return calc_viscosity_background(eta_dilute, initial_density, residual);
 }
 CoolPropDbl HelmholtzEOSMixtureBackend::calc_viscosity_background(CoolPropDbl eta_dilute, CoolPropDbl& initial_density, CoolPropDbl& residual) {
-
-    switch (components[0].transport.viscosity_initial.type) {
-        case ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_RAINWATER_FRIEND: {
-            CoolPropDbl B_eta_initial = TransportRoutines::viscosity_initial_density_dependence_Rainwater_Friend(*this);
-            CoolPropDbl rho = rhomolar();
-            initial_density = eta_dilute * B_eta_initial * rho; //TODO: Check units once AMTG
-            break;
-        }
-        case ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_EMPIRICAL: {
-            initial_density = TransportRoutines::viscosity_initial_density_dependence_empirical(*this);
-            break;
-        }
-        case ViscosityInitialDensityVariables::VISCOSITY_INITIAL_DENSITY_NOT_SET: {
-            break;
+    resolve_viscosity_plan();
+    if (transport_plan.viscosity_higher_order == NULL) {
+        throw ValueError(format("The viscosity model of fluid %s does not have a background contribution", name().c_str()));
+    }
+    // Initial density dependence
+    if (transport_plan.viscosity_initial_density != NULL) {
+        initial_density = transport_plan.viscosity_initial_density(*this);
+        if (transport_plan.viscosity_initial_density_times_dilute) {
+            initial_density *= eta_dilute * rhomolar();  //TODO: Check units once AMTG
         }
     }
-
     // Higher order terms
-    switch (components[0].transport.viscosity_higher_order.type) {
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_BATSCHINKI_HILDEBRAND:
-            residual = TransportRoutines::viscosity_higher_order_modified_Batschinski_Hildebrand(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_FRICTION_THEORY:
-            residual = TransportRoutines::viscosity_higher_order_friction_theory(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_HYDROGEN:
-            residual = TransportRoutines::viscosity_hydrogen_higher_order_hardcoded(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_TOLUENE:
-            residual = TransportRoutines::viscosity_toluene_higher_order_hardcoded(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_HEXANE:
-            residual = TransportRoutines::viscosity_hexane_higher_order_hardcoded(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_HEPTANE:
-            residual = TransportRoutines::viscosity_heptane_higher_order_hardcoded(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_ETHANE:
-            residual = TransportRoutines::viscosity_ethane_higher_order_hardcoded(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_BENZENE:
-            residual = TransportRoutines::viscosity_benzene_higher_order_hardcoded(*this);
-            break;
-        case ViscosityHigherOrderVariables::VISCOSITY_HIGHER_ORDER_CO2_LAESECKE_JPCRD_2017:
-            residual = TransportRoutines::viscosity_CO2_higher_order_hardcoded_LaeseckeJPCRD2017(*this);
-            break;
-        default:
-            throw ValueError(
-              format("higher order viscosity type [%d] is invalid for fluid %s", components[0].transport.viscosity_dilute.type, name().c_str()));
-    }
+    residual = transport_plan.viscosity_higher_order(*this);
 
     return initial_density + residual;
 }
 
 CoolPropDbl HelmholtzEOSMixtureBackend::calc_viscosity(void) {
     if (is_pure_or_pseudopure) {
+        CoolPropDbl eta = transport_from_surrogate(iviscosity);
+        if (ValidNumber(eta)) {
+            return eta;
+        }
         CoolPropDbl dilute = 0, initial_density = 0, residual = 0, critical = 0;
         calc_viscosity_contributions(dilute, initial_density, residual, critical);
         return dilute + initial_density + residual + critical;
@@ -664,9 +1046,9 @@ CoolPropDbl HelmholtzEOSMixtureBackend::calc_viscosity(void) {
         set_warning_string("Mixture model for viscosity is highly approximate");
         CoolPropDbl summer = 0;
         for (std::size_t i = 0; i < mole_fractions.size(); ++i) {
-            shared_ptr<HelmholtzEOSBackend> HEOS(new HelmholtzEOSBackend(components[i]));
-            HEOS->update(DmolarT_INPUTS, _rhomolar, _T);
-            summer += mole_fractions[i] * log(HEOS->viscosity());
+            HelmholtzEOSMixtureBackend& pure = get_transport_pure_component(i);
+            pure.update(DmolarT_INPUTS, _rhomolar, _T);
+            summer += mole_fractions[i] * log(pure.viscosity());
         }
         return exp(summer);
     }
@@ -680,85 +1062,24 @@ void HelmholtzEOSMixtureBackend::calc_viscosity_contributions(CoolPropDbl& dilut
         residual = 0;
         critical = 0;
 
-        // Get a reference for code cleanness
-        CoolPropFluid& component = components[0];
-
-        if (!component.transport.viscosity_model_provided) {
-            throw ValueError(format("Viscosity model is not available for this fluid"));
-        }
+        resolve_viscosity_plan();
 
-        // Check if using ECS
-        if (component.transport.viscosity_using_ECS) {
-            // Get reference fluid name
-            std::string fluid_name = component.transport.viscosity_ecs.reference_fluid;
-            std::vector<std::string> names(1, fluid_name);
-            // Get a managed pointer to the reference fluid for ECS
-            shared_ptr<HelmholtzEOSMixtureBackend> ref_fluid(new HelmholtzEOSMixtureBackend(names));
+        if (transport_plan.viscosity_ECS_reference) {
             // Get the viscosity using ECS and stick in the critical value
-            critical = TransportRoutines::viscosity_ECS(*this, *ref_fluid);
-            return;
-        }
-
-        // Check if using Chung model
-        if (component.transport.viscosity_using_Chung) {
-            // Get the viscosity using ECS and stick in the critical value
-            critical = TransportRoutines::viscosity_Chung(*this);
-            return;
-        }
+            critical = TransportRoutines::viscosity_ECS(*this, *transport_plan.viscosity_ECS_reference);
+        } else if (transport_plan.viscosity_total != NULL) {
+            // Evaluate the hardcoded, Chung or rho*sr model and stick in the critical value
+            critical = transport_plan.viscosity_total(*this);
+        } else {
+            // Dilute part
+            dilute = transport_plan.viscosity_dilute(*this);
 
-        // Check if using rho*sr model
-        if (component.transport.viscosity_using_rhosr) {
-            // Get the viscosity using rho*sr model and stick in the critical value
-            critical = TransportRoutines::viscosity_rhosr(*this);
-            return;
-        }
+            // Background viscosity given by the sum of the initial density dependence and higher order terms
+            calc_viscosity_background(dilute, initial_density, residual);
 
-        if (component.transport.hardcoded_viscosity != CoolProp::TransportPropertyData::VISCOSITY_NOT_HARDCODED) {
-            // Evaluate hardcoded model and stick in the critical value
-            switch (component.transport.hardcoded_viscosity) {
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_WATER:
-                    critical = TransportRoutines::viscosity_water_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_HEAVYWATER:
-                    critical = TransportRoutines::viscosity_heavywater_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_HELIUM:
-                    critical = TransportRoutines::viscosity_helium_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_R23:
-                    critical = TransportRoutines::viscosity_R23_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_METHANOL:
-                    critical = TransportRoutines::viscosity_methanol_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_M_XYLENE:
-                    critical = TransportRoutines::viscosity_m_xylene_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_O_XYLENE:
-                    critical = TransportRoutines::viscosity_o_xylene_hardcoded(*this);
-                    break;
-                case CoolProp::TransportPropertyData::VISCOSITY_HARDCODED_P_XYLENE:
-                    critical = TransportRoutines::viscosity_p_xylene_hardcoded(*this);
-                    break;
-                default:
-                    throw ValueError(
-                      format("hardcoded viscosity type [%d] is invalid for fluid %s", component.transport.hardcoded_viscosity, name().c_str()));
-            }
-            return;
+            // Critical part (no fluids have critical enhancement for viscosity currently)
+            critical = 0;
         }
-
-        // -------------------------
-        //     Normal evaluation
-        // -------------------------
-
-        // Dilute part
-        dilute = calc_viscosity_dilute();
-
-        // Background viscosity given by the sum of the initial density dependence and higher order terms
-        calc_viscosity_background(dilute, initial_density, residual);
-
-        // Critical part (no fluids have critical enhancement for viscosity currently)
-        critical = 0;
     } else {
         throw ValueError("calc_viscosity_contributions invalid for mixtures");
     }
@@ -772,103 +1093,25 @@ void HelmholtzEOSMixtureBackend::calc_conductivity_contributions(CoolPropDbl& di
         residual = 0;
         critical = 0;
 
-        // Get a reference for code cleanness
-        CoolPropFluid& component = components[0];
-
-        if (!component.transport.conductivity_model_provided) {
-            throw ValueError(format("Thermal conductivity model is not available for this fluid"));
-        }
-
-        // Check if using ECS
-        if (component.transport.conductivity_using_ECS) {
-            // Get reference fluid name
-            std::string fluid_name = component.transport.conductivity_ecs.reference_fluid;
-            std::vector<std::string> name(1, fluid_name);
-            // Get a managed pointer to the reference fluid for ECS
-            shared_ptr<HelmholtzEOSMixtureBackend> ref_fluid(new HelmholtzEOSMixtureBackend(name));
-            // Get the viscosity using ECS and store in initial_density (not normally used);
-            initial_density = TransportRoutines::conductivity_ECS(*this, *ref_fluid);  // Warning: not actually initial_density
-            return;
-        }
+        resolve_conductivity_plan();
 
-        if (component.transport.hardcoded_conductivity != CoolProp::TransportPropertyData::CONDUCTIVITY_NOT_HARDCODED) {
+        if (transport_plan.conductivity_ECS_reference) {
+            // Get the conductivity using ECS and store in initial_density (not normally used); warning: not actually initial_density
+            initial_density = TransportRoutines::conductivity_ECS(*this, *transport_plan.conductivity_ECS_reference);
+        } else if (transport_plan.conductivity_total != NULL) {
             // Evaluate hardcoded model and deposit in initial_density variable
-            // Warning: not actually initial_density
-            switch (component.transport.hardcoded_conductivity) {
-                case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_WATER:
-                    initial_density = TransportRoutines::conductivity_hardcoded_water(*this);
-                    break;
-                case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_HEAVYWATER:
-                    initial_density = TransportRoutines::conductivity_hardcoded_heavywater(*this);
-                    break;
-                case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_R23:
-                    initial_density = TransportRoutines::conductivity_hardcoded_R23(*this);
-                    break;
-                case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_HELIUM:
-                    initial_density = TransportRoutines::conductivity_hardcoded_helium(*this);
-                    break;
-                case CoolProp::TransportPropertyData::CONDUCTIVITY_HARDCODED_METHANE:
-                    initial_density = TransportRoutines::conductivity_hardcoded_methane(*this);
-                    break;
-                default:
-                    throw ValueError(format("hardcoded conductivity type [%d] is invalid for fluid %s",
-                                            components[0].transport.hardcoded_conductivity, name().c_str()));
+            initial_density = transport_plan.conductivity_total(*this);  // Warning: not actually initial_density
+        } else {
+            // Dilute part
+            if (transport_plan.conductivity_dilute != NULL) {
+                dilute = transport_plan.conductivity_dilute(*this);
+            }
+            // Residual part
+            residual = transport_plan.conductivity_residual(*this);
+            // Critical part
+            if (transport_plan.conductivity_critical != NULL) {
+                critical = transport_plan.conductivity_critical(*this);
             }
-            return;
-        }
-
-        // -------------------------
-        //     Normal evaluation
-        // -------------------------
-
-        // Dilute part
-        switch (component.transport.conductivity_dilute.type) {
-            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_RATIO_POLYNOMIALS:
-                dilute = TransportRoutines::conductivity_dilute_ratio_polynomials(*this);
-                break;
-            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_ETA0_AND_POLY:
-                dilute = TransportRoutines::conductivity_dilute_eta0_and_poly(*this);
-                break;
-            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_CO2:
-                dilute = TransportRoutines::conductivity_dilute_hardcoded_CO2(*this);
-                break;
-            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_CO2_HUBER_JPCRD_2016:
-                dilute = TransportRoutines::conductivity_dilute_hardcoded_CO2_HuberJPCRD2016(*this);
-                break;
-            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_ETHANE:
-                dilute = TransportRoutines::conductivity_dilute_hardcoded_ethane(*this);
-                break;
-            case ConductivityDiluteVariables::CONDUCTIVITY_DILUTE_NONE:
-                dilute = 0.0;
-                break;
-            default:
-                throw ValueError(
-                  format("dilute conductivity type [%d] is invalid for fluid %s", components[0].transport.conductivity_dilute.type, name().c_str()));
-        }
-
-        // Residual part
-        residual = calc_conductivity_background();
-
-        // Critical part
-        switch (component.transport.conductivity_critical.type) {
-            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_SIMPLIFIED_OLCHOWY_SENGERS:
-                critical = TransportRoutines::conductivity_critical_simplified_Olchowy_Sengers(*this);
-                break;
-            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_R123:
-                critical = TransportRoutines::conductivity_critical_hardcoded_R123(*this);
-                break;
-            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_AMMONIA:
-                critical = TransportRoutines::conductivity_critical_hardcoded_ammonia(*this);
-                break;
-            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_NONE:
-                critical = 0.0;
-                break;
-            case ConductivityCriticalVariables::CONDUCTIVITY_CRITICAL_CARBONDIOXIDE_SCALABRIN_JPCRD_2006:
-                critical = TransportRoutines::conductivity_critical_hardcoded_CO2_ScalabrinJPCRD2006(*this);
-                break;
-            default:
-                throw ValueError(
-                  format("critical conductivity type [%d] is invalid for fluid %s", components[0].transport.viscosity_dilute.type, name().c_str()));
         }
     } else {
         throw ValueError("calc_conductivity_contributions invalid for mixtures");
@@ -876,23 +1119,18 @@ void HelmholtzEOSMixtureBackend::calc_conductivity_contributions(CoolPropDbl& di
 };
 
 CoolPropDbl HelmholtzEOSMixtureBackend::calc_conductivity_background(void) {
-    // Residual part
-    CoolPropDbl lambda_residual = _HUGE;
-    switch (components[0].transport.conductivity_residual.type) {
-        case ConductivityResidualVariables::CONDUCTIVITY_RESIDUAL_POLYNOMIAL:
-            lambda_residual = TransportRoutines::conductivity_residual_polynomial(*this);
-            break;
-        case ConductivityResidualVariables::CONDUCTIVITY_RESIDUAL_POLYNOMIAL_AND_EXPONENTIAL:
-            lambda_residual = TransportRoutines::conductivity_residual_polynomial_and_exponential(*this);
-            break;
-        default:
-            throw ValueError(
-              format("residual conductivity type [%d] is invalid for fluid %s", components[0].transport.conductivity_residual.type, name().c_str()));
+    resolve_conductivity_plan();
+    if (transport_plan.conductivity_residual == NULL) {
+        throw ValueError(format("The conductivity model of fluid %s does not have a residual contribution", name().c_str()));
     }
-    return lambda_residual;
+    return transport_plan.conductivity_residual(*this);
 }
 CoolPropDbl HelmholtzEOSMixtureBackend::calc_conductivity(void) {
     if (is_pure_or_pseudopure) {
+        CoolPropDbl lambda = transport_from_surrogate(iconductivity);
+        if (ValidNumber(lambda)) {
+            return lambda;
+        }
         CoolPropDbl dilute = 0, initial_density = 0, residual = 0, critical = 0;
         calc_conductivity_contributions(dilute, initial_density, residual, critical);
         return dilute + initial_density + residual + critical;
@@ -900,9 +1138,9 @@ CoolPropDbl HelmholtzEOSMixtureBackend::calc_conductivity(void) {
         set_warning_string("Mixture model for conductivity is highly approximate");
         CoolPropDbl summer = 0;
         for (std::size_t i = 0; i < mole_fractions.size(); ++i) {
-            shared_ptr<HelmholtzEOSBackend> HEOS(new HelmholtzEOSBackend(components[i]));
-            HEOS->update(DmolarT_INPUTS, _rhomolar, _T);
-            summer += mole_fractions[i] * HEOS->conductivity();
+            HelmholtzEOSMixtureBackend& pure = get_transport_pure_component(i);
+            pure.update(DmolarT_INPUTS, _rhomolar, _T);
+            summer += mole_fractions[i] * pure.conductivity();
         }
         return summer;
     }
@@ -1232,6 +1470,13 @@ void HelmholtzEOSMixtureBackend::update(CoolProp::input_pairs input_pair, double
                   << std::endl;
     }
 
+    // Keep the inputs as given, they are the key of the update cache
+    const CoolProp::input_pairs input_pair_in = input_pair;
+    const double value1_in = value1, value2_in = value2;
+    if (restore_from_update_cache(input_pair_in, value1_in, value2_in)) {
+        return;
+    }
+
     CoolPropDbl ld_value1 = value1, ld_value2 = value2;
     pre_update(input_pair, ld_value1, ld_value2);
     value1 = ld_value1;
@@ -1332,6 +1577,8 @@ void HelmholtzEOSMixtureBackend::update(CoolProp::input_pairs input_pair, double
     }
 
     post_update();
+
+    store_in_update_cache(input_pair_in, value1_in, value2_in);
 }
 const std::vector<CoolPropDbl> HelmholtzEOSMixtureBackend::calc_mass_fractions() {
     // mass fraction is mass_i/total_mass;
@@ -1411,7 +1658,7 @@ void HelmholtzEOSMixtureBackend::post_update(bool optional_checks) {
     _delta = _rhomolar / _reducing.rhomolar;
 
     // Update the terms in the excess contribution
-    residual_helmholtz->Excess.update(_tau, _delta);
+    residual_helmholtz->update_excess(_tau, _delta);
 }
 
 CoolPropDbl HelmholtzEOSMixtureBackend::calc_Bvirial() {
@@ -1703,10 +1950,9 @@ void HelmholtzEOSMixtureBackend::p_phase_determination_pure_or_pseudopure(int ot
             default:
                 throw ValueError(format("bad input for other"));
         }
-        // TODO: Check the speed penalty of these calls
-        // Update the states
-        if (this->SatL) this->SatL->update(DmolarT_INPUTS, HEOS.SatL->rhomolar(), HEOS.SatL->T());
-        if (this->SatV) this->SatV->update(DmolarT_INPUTS, HEOS.SatV->rhomolar(), HEOS.SatV->T());
+        // Update the states; they are evaluated only if their properties are requested
+        set_saturated_states(HEOS.SatL->T(), HEOS.SatL->rhomolar(), HEOS.SatV->rhomolar(), HEOS.SatL->p(), HEOS.SatV->p(), mole_fractions,
+                             mole_fractions);
         // Update the two-Phase variables
         _rhoLmolar = HEOS.SatL->rhomolar();
         _rhoVmolar = HEOS.SatV->rhomolar();
@@ -2015,9 +2261,9 @@ void HelmholtzEOSMixtureBackend::T_phase_determination_pure_or_pseudopure(int ot
                 throw ValueError(format("bad input for other"));
         }
 
-        // Update the states
-        if (this->SatL) this->SatL->update(DmolarT_INPUTS, HEOS.SatL->rhomolar(), HEOS.SatL->T());
-        if (this->SatV) this->SatV->update(DmolarT_INPUTS, HEOS.SatV->rhomolar(), HEOS.SatV->T());
+        // Update the states; they are evaluated only if their properties are requested
+        set_saturated_states(HEOS.SatL->T(), HEOS.SatL->rhomolar(), HEOS.SatV->rhomolar(), HEOS.SatL->p(), HEOS.SatV->p(), mole_fractions,
+                             mole_fractions);
         // Update the two-Phase variables
         _rhoLmolar = HEOS.SatL->rhomolar();
         _rhoVmolar = HEOS.SatV->rhomolar();
@@ -2354,44 +2600,79 @@ CoolPropDbl HelmholtzEOSMixtureBackend::SRK_covolume() {
     }
     return b;
 }
+/// The number of isotherms whose stationary points are kept by solver_rho_Tp_global
+static const std::size_t ISOTHERM_STATIONARY_POINTS_CAPACITY = 8;
+
+HelmholtzEOSMixtureBackend::IsothermStationaryPoints& HelmholtzEOSMixtureBackend::get_isotherm_stationary_points(CoolPropDbl T, CoolPropDbl p,
+                                                                                                                  CoolPropDbl rhomax) {
+    const std::vector<CoolPropDbl>& z = get_mole_fractions_ref();
+    for (std::vector<IsothermStationaryPoints>::iterator it = isotherm_stationary_points.begin(); it != isotherm_stationary_points.end(); ++it) {
+        if (it->T == T && it->rhomax == rhomax && it->z == z) {
+            return *it;
+        }
+    }
+    IsothermStationaryPoints isotherm;
+    isotherm.T = T;
+    isotherm.rhomax = rhomax;
+    isotherm.z = z;
+    isotherm.light = -1;
+    isotherm.heavy = -1;
+    isotherm.retval = solver_dpdrho0_Tp(T, p, rhomax, isotherm.light, isotherm.heavy);
+    if (isotherm.retval == TWO_STATIONARY_POINTS_FOUND) {
+        // Calculate the pressures at the min and max densities where dpdrho|T = 0
+        isotherm.p_light = calc_pressure_nocache(T, isotherm.light);
+        isotherm.p_heavy = calc_pressure_nocache(T, isotherm.heavy);
+    } else {
+        isotherm.p_light = _HUGE;
+        isotherm.p_heavy = _HUGE;
+    }
+    isotherm.rhomax_liq = rhomax;
+    isotherm.p_rhomax_liq = _HUGE;
+    isotherm.bumps = 0;
+    // Replace the oldest isotherm if full
+    if (isotherm_stationary_points.size() >= ISOTHERM_STATIONARY_POINTS_CAPACITY) {
+        isotherm_stationary_points.erase(isotherm_stationary_points.begin());
+    }
+    isotherm_stationary_points.push_back(isotherm);
+    return isotherm_stationary_points.back();
+}
 CoolPropDbl HelmholtzEOSMixtureBackend::solver_rho_Tp_global(CoolPropDbl T, CoolPropDbl p, CoolPropDbl rhomolar_max) {
-    // Find the densities along the isotherm where dpdrho|T = 0 (if you can)
-    CoolPropDbl light = -1, heavy = -1;
-    StationaryPointReturnFlag retval = solver_dpdrho0_Tp(T, p, rhomolar_max, light, heavy);
+    // Find the densities along the isotherm where dpdrho|T = 0 (if you can); they are kept for the next call at this isotherm
+    IsothermStationaryPoints& isotherm = get_isotherm_stationary_points(T, p, rhomolar_max);
 
     // Define the solver class
     SolverTPResid resid(this, T, p);
 
-    if (retval == ZERO_STATIONARY_POINTS) {
+    // The roots are bracketed, so a Newton method with the analytic dp/drho|T, safeguarded by bisection, is used.  The
+    // ideal-gas density is the starting point for the vapor-like roots, the upper bound of the bracket for the liquid-like ones
+    double rho_ideal_gas = p / (gas_constant() * T);
+
+    if (isotherm.retval == ZERO_STATIONARY_POINTS) {
         // It's monotonic (no stationary points found), so do the full bounded solver
         // for the density
-        double rho = Brent(resid, 1e-10, rhomolar_max, DBL_EPSILON, 1e-8, 100);
+        double rho = BoundedNewton(resid, 1e-10, rhomolar_max, rho_ideal_gas, solver_tolerance(1e-8, rhomolar_max), 100);
         return rho;
-    } else if (retval == TWO_STATIONARY_POINTS_FOUND) {
-
-        // Calculate the pressures at the min and max densities where dpdrho|T = 0
-        double p_at_rhomin_stationary = calc_pressure_nocache(T, light);
-        double p_at_rhomax_stationary = calc_pressure_nocache(T, heavy);
+    } else if (isotherm.retval == TWO_STATIONARY_POINTS_FOUND) {
 
         double rho_liq = -1, rho_vap = -1;
-        if (p > p_at_rhomax_stationary) {
-            int counter = 0;
-            for (/* init above, for debugging */; counter <= 10; counter++) {
-                // Bump up rhomax if needed to bound the given pressure
-                double p_at_rhomax = calc_pressure_nocache(T, rhomolar_max);
-                if (p_at_rhomax < p) {
-                    rhomolar_max *= 1.05;
-                } else {
-                    break;
-                }
+        if (p > isotherm.p_heavy) {
+            // Bump up rhomax if needed to bound the given pressure
+            if (!ValidNumber(isotherm.p_rhomax_liq)) {
+                isotherm.p_rhomax_liq = calc_pressure_nocache(T, isotherm.rhomax_liq);
+            }
+            while (isotherm.p_rhomax_liq < p && isotherm.bumps <= 10) {
+                isotherm.rhomax_liq *= 1.05;
+                isotherm.p_rhomax_liq = calc_pressure_nocache(T, isotherm.rhomax_liq);
+                isotherm.bumps++;
             }
-            // Look for liquid root starting at stationary point density
-            rho_liq = Brent(resid, heavy, rhomolar_max, DBL_EPSILON, 1e-8, 100);
+            // Look for liquid root between the stationary point density and rhomax
+            rho_liq =
+              BoundedNewton(resid, isotherm.heavy, isotherm.rhomax_liq, isotherm.rhomax_liq, solver_tolerance(1e-8, isotherm.rhomax_liq), 100);
         }
 
-        if (p < p_at_rhomin_stationary) {
-            // Look for vapor root starting at stationary point density
-            rho_vap = Brent(resid, light, 1e-10, DBL_EPSILON, 1e-8, 100);
+        if (p < isotherm.p_light) {
+            // Look for vapor root below the stationary point density
+            rho_vap = BoundedNewton(resid, 1e-10, isotherm.light, rho_ideal_gas, solver_tolerance(1e-8, isotherm.light), 100);
         }
 
         if (rho_vap > 0 && rho_liq > 0) {
@@ -2455,27 +2736,27 @@ CoolPropDbl HelmholtzEOSMixtureBackend::solver_rho_Tp(CoolPropDbl T, CoolPropDbl
                 CoolPropDbl _rhoLancval = static_cast<CoolPropDbl>(components[0].ancillaries.rhoL.evaluate(T));
                 try {
                     // First we try with Halley's method starting at saturated liquid
-                    rhomolar = Halley(resid, _rhoLancval, 1e-8, 100);
+                    rhomolar = Halley(resid, _rhoLancval, solver_tolerance(1e-8), 100, solver_tolerance(1e-12));
                     if (!ValidNumber(rhomolar) || first_partial_deriv(iP, iDmolar, iT) < 0
                         || second_partial_deriv(iP, iDmolar, iT, iDmolar, iT) < 0) {
                         throw ValueError("Liquid density is invalid");
                     }
                 } catch (std::exception&) {
                     // Next we try with a Brent method bounded solver since the function is 1-1
-                    rhomolar = Brent(resid, _rhoLancval * 0.9, _rhoLancval * 1.3, DBL_EPSILON, 1e-8, 100);
+                    rhomolar = Brent(resid, _rhoLancval * 0.9, _rhoLancval * 1.3, DBL_EPSILON, solver_tolerance(1e-8, _rhoLancval), 100);
                     if (!ValidNumber(rhomolar)) {
                         throw ValueError();
                     }
                 }
             } else {
                 // Try with 4th order Householder method starting at a very high density
-                rhomolar = Householder4(&resid, 3 * rhomolar_reducing(), 1e-8, 100);
+                rhomolar = Householder4(&resid, 3 * rhomolar_reducing(), solver_tolerance(1e-8), 100, solver_tolerance(1e-12));
             }
             return rhomolar;
         } else if (phase == iphase_supercritical_liquid) {
             CoolPropDbl rhoLancval = static_cast<CoolPropDbl>(components[0].ancillaries.rhoL.evaluate(T));
             // Next we try with a Brent method bounded solver since the function is 1-1
-            double rhomolar = Brent(resid, rhoLancval * 0.99, rhomolar_critical() * 4, DBL_EPSILON, 1e-8, 100);
+            double rhomolar = Brent(resid, rhoLancval * 0.99, rhomolar_critical() * 4, DBL_EPSILON, solver_tolerance(1e-8, rhoLancval), 100);
             if (!ValidNumber(rhomolar)) {
                 throw ValueError();
             }
@@ -2484,7 +2765,7 @@ CoolPropDbl HelmholtzEOSMixtureBackend::solver_rho_Tp(CoolPropDbl T, CoolPropDbl
     }
 
     try {
-        double rhomolar = Householder4(resid, rhomolar_guess, 1e-8, 20);
+        double rhomolar = Householder4(resid, rhomolar_guess, solver_tolerance(1e-8), 20, solver_tolerance(1e-12));
         if (!ValidNumber(rhomolar) || rhomolar < 0) {
             throw ValueError();
         }
@@ -2493,7 +2774,7 @@ CoolPropDbl HelmholtzEOSMixtureBackend::solver_rho_Tp(CoolPropDbl T, CoolPropDbl
             double d2pdrho2 = second_partial_deriv(iP, iDmolar, iT, iDmolar, iT);
             if (dpdrho < 0 || d2pdrho2 < 0) {
                 // Try again with a larger density in order to end up at the right solution
-                rhomolar = Householder4(resid, 3 * rhomolar_reducing(), 1e-8, 100);
+                rhomolar = Householder4(resid, 3 * rhomolar_reducing(), solver_tolerance(1e-8), 100, solver_tolerance(1e-12));
                 return rhomolar;
             }
         } else if (phase == iphase_gas) {
@@ -2501,22 +2782,22 @@ CoolPropDbl HelmholtzEOSMixtureBackend::solver_rho_Tp(CoolPropDbl T, CoolPropDbl
             double d2pdrho2 = second_partial_deriv(iP, iDmolar, iT, iDmolar, iT);
             if (dpdrho < 0 || d2pdrho2 > 0) {
                 // Try again with a tiny density in order to end up at the right solution
-                rhomolar = Householder4(resid, 1e-6, 1e-8, 100);
+                rhomolar = Householder4(resid, 1e-6, solver_tolerance(1e-8), 100, solver_tolerance(1e-12));
                 return rhomolar;
             }
         }
         return rhomolar;
     } catch (std::exception& e) {
         if (phase == iphase_supercritical || phase == iphase_supercritical_gas) {
-            double rhomolar = Brent(resid, 1e-10, 3 * rhomolar_reducing(), DBL_EPSILON, 1e-8, 100);
+            double rhomolar = Brent(resid, 1e-10, 3 * rhomolar_reducing(), DBL_EPSILON, solver_tolerance(1e-8, rhomolar_reducing()), 100);
             return rhomolar;
         } else if (is_pure_or_pseudopure && T > T_critical()) {
             try {
-                double rhomolar = Brent(resid, 1e-10, 5 * rhomolar_reducing(), DBL_EPSILON, 1e-8, 100);
+                double rhomolar = Brent(resid, 1e-10, 5 * rhomolar_reducing(), DBL_EPSILON, solver_tolerance(1e-8, rhomolar_reducing()), 100);
                 return rhomolar;
 
             } catch (...) {
-                double rhomolar = Householder4(resid, 3 * rhomolar_reducing(), 1e-8, 100);
+                double rhomolar = Householder4(resid, 3 * rhomolar_reducing(), solver_tolerance(1e-8), 100, solver_tolerance(1e-12));
                 return rhomolar;
             }
         }
@@ -2957,7 +3238,6 @@ void HelmholtzEOSMixtureBackend::calc_reducing_state(void) {
 }
 void HelmholtzEOSMixtureBackend::calc_all_alphar_deriv_cache(const std::vector<CoolPropDbl>& mole_fractions, const CoolPropDbl& tau,
                                                              const CoolPropDbl& delta) {
-    deriv_counter++;
     bool cache_values = true;
     HelmholtzDerivatives derivs = residual_helmholtz->all(*this, get_mole_fractions_ref(), tau, delta, cache_values);
     _alphar = derivs.alphar;
@@ -2983,6 +3263,13 @@ CoolPropDbl HelmholtzEOSMixtureBackend::calc_alphar_deriv_nocache(const int nTau
     HelmholtzDerivatives derivs = residual_helmholtz->all(*this, mole_fractions, tau, delta, cache_values);
     return derivs.get(nTau, nDelta);
 }
+thread_local unsigned long long ResidualHelmholtz::evaluations = 0;
+unsigned long long HelmholtzEOSMixtureBackend::residual_helmholtz_evaluations() {
+    return ResidualHelmholtz::evaluations;
+}
+void HelmholtzEOSMixtureBackend::reset_residual_helmholtz_evaluations() {
+    ResidualHelmholtz::evaluations = 0;
+}
 CoolPropDbl HelmholtzEOSMixtureBackend::calc_alpha0_deriv_nocache(const int nTau, const int nDelta, const std::vector<CoolPropDbl>& mole_fractions,
                                                                   const CoolPropDbl& tau, const CoolPropDbl& delta, const CoolPropDbl& Tr,
                                                                   const CoolPropDbl& rhor) {
@@ -3850,6 +4137,8 @@ void HelmholtzEOSMixtureBackend::set_reference_stateS(const std::string& referen
             throw ValueError(format("reference state string is invalid: [%s]", reference_state.c_str()));
         }
     }
+    // The cached states have the enthalpies and entropies of the old reference state
+    clear_model_caches();
 }
 
 /// Set the reference state based on a thermodynamic state point specified by temperature and molar density
@@ -3870,6 +4159,8 @@ void HelmholtzEOSMixtureBackend::set_reference_stateD(double T, double rhomolar,
         double delta_a2 = -deltah / (HEOS.gas_constant() * HEOS.get_reducing_state().T);
         set_fluid_enthalpy_entropy_offset(components[i], delta_a1, delta_a2, "custom");
     }
+    // The cached states have the enthalpies and entropies of the old reference state
+    clear_model_caches();
 }
 
 void HelmholtzEOSMixtureBackend::set_fluid_enthalpy_entropy_offset(CoolPropFluid& component, double delta_a1, double delta_a2,
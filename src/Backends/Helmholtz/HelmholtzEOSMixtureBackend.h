@@ -55,6 +55,46 @@ class MoleFractions{
     operator std::vector<CoolPropDbl>& () { return mole_fractions; }
 };
 
+class HelmholtzEOSMixtureBackend;
+class TransportSurrogateData;
+
+/// The transport models of a fluid, resolved once per instance to the functions that evaluate each contribution, so that the
+/// types of the models are not dispatched again at each call.  A NULL function is a contribution that is not part of the model.
+class TransportPlan
+{
+   public:
+    typedef CoolPropDbl (*Contribution)(HelmholtzEOSMixtureBackend& HEOS);
+    bool viscosity_resolved, conductivity_resolved;
+    Contribution viscosity_total;            ///< A model for the whole viscosity (hardcoded, Chung or rho*sr); the contributions are not used
+    Contribution viscosity_dilute, viscosity_initial_density, viscosity_higher_order;
+    bool viscosity_initial_density_times_dilute;  ///< The initial density function gives B_eta, to be multiplied by eta_dilute*rho
+    Contribution conductivity_total;         ///< A hardcoded model for the whole conductivity; the contributions are not used
+    Contribution conductivity_dilute, conductivity_residual, conductivity_critical;
+    /// The reference fluids of the extended corresponding states models, kept between the calls
+    shared_ptr<HelmholtzEOSMixtureBackend> viscosity_ECS_reference, conductivity_ECS_reference;
+    /// The pure components of a mixture for the approximate mixture models, kept between the calls
+    std::vector<shared_ptr<HelmholtzEOSMixtureBackend>> pure_components;
+    bool surrogate_resolved;
+    /// The (T, log(rho)) tables of the transport properties if the fluid is one of the TRANSPORT_SURROGATE_FLUIDS, and their tolerance
+    shared_ptr<TransportSurrogateData> surrogate;
+    double surrogate_tolerance;
+
+    TransportPlan()
+      : viscosity_resolved(false),
+        conductivity_resolved(false),
+        viscosity_total(NULL),
+        viscosity_dilute(NULL),
+        viscosity_initial_density(NULL),
+        viscosity_higher_order(NULL),
+        viscosity_initial_density_times_dilute(false),
+        conductivity_total(NULL),
+        conductivity_dilute(NULL),
+        conductivity_residual(NULL),
+        conductivity_critical(NULL),
+        surrogate_resolved(false),
+        surrogate_tolerance(_HUGE){};
+};
+
 class HelmholtzEOSMixtureBackend : public AbstractState
 {
 
@@ -212,6 +252,35 @@ class HelmholtzEOSMixtureBackend : public AbstractState
     void calc_unspecify_phase() {
         imposed_phase_index = iphase_not_imposed;
     }
+    /**\brief Set the accuracy tier of the iterative solvers, also for the saturated and linked states
+     */
+    void calc_set_tolerance_tier(tolerance_tiers tier);
+    /**\brief Enable the cache of the results of update()
+     */
+    void calc_enable_update_cache(std::size_t capacity) {
+        update_cache.set_capacity(capacity);
+    }
+    void calc_save_update_cache_entry(UpdateCacheEntry& entry);
+    void calc_restore_update_cache_entry(const UpdateCacheEntry& entry);
+    /**\brief The composition, the values of an update cache entry and the K factors that seed the next mixture flash
+     */
+    void calc_snapshot(std::vector<double>& buffer);
+    void calc_restore(const std::vector<double>& buffer, std::size_t& i);
+    /// The names, CAS numbers and equations of state of the components
+    std::string calc_snapshot_fluids(void);
+    /**\brief Update from the mass density and specific internal energy with FlashRoutines::DU_flash_singlephase_Newton if there is an
+     * initial guess for the temperature, falling back to the full (D,U) flash
+     */
+    void calc_compressible_flow_state(double rhomass, double umass, CompressibleFlowState& state);
+    /**\brief The memory used by this instance: the copies of the components, the mole fractions, the phase envelope and the
+     * caches of the solvers
+     */
+    std::size_t calc_memory_footprint(void);
+    /**\brief The saturated phases, the linked states, the Peng-Robinson model of the flash guesses and the states of the transport models
+     */
+    void calc_child_states(std::vector<AbstractState*>& children);
+    /// Set the state directly from its temperature, density, pressure, quality and phase, without any flash calculation
+    void restore_state_essentials(CoolPropDbl T, CoolPropDbl rhomolar, CoolPropDbl p, CoolPropDbl Q, phases phase);
     CoolPropDbl calc_saturation_ancillary(parameters param, int Q, parameters given, double value);
     void calc_ssat_max(void);
     void calc_hsat_max(void);
@@ -313,6 +382,21 @@ class HelmholtzEOSMixtureBackend : public AbstractState
     HelmholtzEOSMixtureBackend& get_SatV() {
         return *SatV;
     };
+    /**
+     * @brief Set the saturated liquid and vapor states from an already converged saturation state without evaluating the EOS
+     *
+     * Only the essentials (T, densities, pressures and compositions) are stored; the properties of the saturated states are
+     * evaluated on first access, like those of any other state.
+     * @param T The saturation temperature in K
+     * @param rhomolarL The molar density of the saturated liquid in mol/m^3
+     * @param rhomolarV The molar density of the saturated vapor in mol/m^3
+     * @param pL The pressure of the saturated liquid in Pa
+     * @param pV The pressure of the saturated vapor in Pa
+     * @param x The mole fractions of the saturated liquid (not used for pure and pseudo-pure fluids)
+     * @param y The mole fractions of the saturated vapor (not used for pure and pseudo-pure fluids)
+     */
+    void set_saturated_states(CoolPropDbl T, CoolPropDbl rhomolarL, CoolPropDbl rhomolarV, CoolPropDbl pL, CoolPropDbl pV,
+                              const std::vector<CoolPropDbl>& x, const std::vector<CoolPropDbl>& y);
 
     std::vector<CoolPropDbl> calc_mole_fractions_liquid(void) {
         return SatL->get_mole_fractions();
@@ -559,6 +643,10 @@ class HelmholtzEOSMixtureBackend : public AbstractState
     void calc_all_alphar_deriv_cache(const std::vector<CoolPropDbl>& mole_fractions, const CoolPropDbl& tau, const CoolPropDbl& delta);
     virtual CoolPropDbl calc_alphar_deriv_nocache(const int nTau, const int nDelta, const std::vector<CoolPropDbl>& mole_fractions,
                                                   const CoolPropDbl& tau, const CoolPropDbl& delta);
+    /// The number of evaluations of the residual Helmholtz energy and its derivatives of the multiparameter models (cubics are not
+    /// counted) by all the instances in the calling thread since its last reset; to compare the work of the solvers in benchmarks and tests
+    static unsigned long long residual_helmholtz_evaluations();
+    static void reset_residual_helmholtz_evaluations();
 
     /**
     \brief Take derivatives of the ideal-gas part of the Helmholtz energy, don't use any cached values, or store any cached values
@@ -630,6 +718,55 @@ class HelmholtzEOSMixtureBackend : public AbstractState
     };
     virtual StationaryPointReturnFlag solver_dpdrho0_Tp(CoolPropDbl T, CoolPropDbl p, CoolPropDbl rhomax, CoolPropDbl& light, CoolPropDbl& heavy);
     virtual CoolPropDbl solver_rho_Tp_global(CoolPropDbl T, CoolPropDbl p, CoolPropDbl rhomax);
+    /// Forget the stationary points of the isotherms kept by solver_rho_Tp_global; needed when the equation of state changes
+    void clear_isotherm_stationary_points() {
+        isotherm_stationary_points.clear();
+    };
+    /// Forget everything that was calculated with the old model: the update cache, the stationary points of the isotherms and
+    /// the Peng-Robinson guesses.  Every setter that changes the equation of state, its parameters or its reference state must call this
+    void clear_model_caches() {
+        update_cache.clear();
+        clear_isotherm_stationary_points();
+        cubic_guess_state.reset();
+    };
+
+   protected:
+    /// The stationary points of p(rho)|T along one isotherm, as found by solver_dpdrho0_Tp.  They do not depend on the pressure,
+    /// so they are kept, together with the brackets of the liquid-like roots, for the next call at the same isotherm
+    class IsothermStationaryPoints
+    {
+       public:
+        CoolPropDbl T,                      ///< The temperature of the isotherm in K
+          rhomax;                           ///< The maximum molar density that was passed to solver_dpdrho0_Tp
+        std::vector<CoolPropDbl> z;         ///< The composition
+        StationaryPointReturnFlag retval;   ///< The number of stationary points
+        CoolPropDbl light,                  ///< The density of the vapor-like stationary point in mol/m^3
+          heavy,                            ///< The density of the liquid-like stationary point in mol/m^3
+          p_light,                          ///< The pressure at the vapor-like stationary point in Pa
+          p_heavy,                          ///< The pressure at the liquid-like stationary point in Pa
+          rhomax_liq,                       ///< The upper bound of the liquid-like roots in mol/m^3 (rhomax, possibly bumped up)
+          p_rhomax_liq;                     ///< The pressure at rhomax_liq in Pa, or _HUGE if not yet calculated
+        int bumps;                          ///< The number of times that rhomax_liq has been bumped up
+    };
+    std::vector<IsothermStationaryPoints> isotherm_stationary_points;  ///< The most recently used isotherms, oldest first
+    /// Get the stationary points along the isotherm for the current composition, from the cache if possible
+    IsothermStationaryPoints& get_isotherm_stationary_points(CoolPropDbl T, CoolPropDbl p, CoolPropDbl rhomax);
+
+    /// The Peng-Robinson model of this mixture that provides the initial guesses of the mixture flashes (see the
+    /// CUBIC_GUESSES_FOR_MIXTURE_FLASHES configuration variable); built on first use by FlashRoutines::get_cubic_guess_state
+    shared_ptr<HelmholtzEOSMixtureBackend> cubic_guess_state;
+
+    /// The resolved transport models of this fluid; reset when the components are set
+    TransportPlan transport_plan;
+    /// Resolve the viscosity model of the pure or pseudo-pure fluid into the transport plan, if not done already
+    void resolve_viscosity_plan();
+    /// Resolve the thermal conductivity model of the pure or pseudo-pure fluid into the transport plan, if not done already
+    void resolve_conductivity_plan();
+    /// Get the state of the pure component i, for the approximate mixture transport models
+    HelmholtzEOSMixtureBackend& get_transport_pure_component(std::size_t i);
+    /// Interpolate the viscosity (key = iviscosity) or the conductivity (key = iconductivity) of the pure fluid in its transport
+    /// tables, if it is one of the TRANSPORT_SURROGATE_FLUIDS; _HUGE if the fluid has no tables or the full model must be used
+    CoolPropDbl transport_from_surrogate(parameters key);
 };
 
 class CorrespondingStatesTerm
@@ -793,19 +930,27 @@ class ResidualHelmholtz
    public:
     ExcessTerm Excess;
     CorrespondingStatesTerm CS;
+    /// Counter of the calls to all() in this thread, see HelmholtzEOSMixtureBackend::residual_helmholtz_evaluations()
+    static thread_local unsigned long long evaluations;
 
     ResidualHelmholtz(){};
     ResidualHelmholtz(const ExcessTerm& E, const CorrespondingStatesTerm& C) : Excess(E), CS(C){};
+    virtual ~ResidualHelmholtz(){};
 
     ResidualHelmholtz copy() {
         return ResidualHelmholtz(Excess.copy(), CS);
     }
-    ResidualHelmholtz* copy_ptr() {
+    virtual ResidualHelmholtz* copy_ptr() {
         return new ResidualHelmholtz(Excess.copy(), CS);
     }
+    /// Update the cached derivatives of the departure functions at the new state, called at the end of each update
+    virtual void update_excess(double tau, double delta) {
+        Excess.update(tau, delta);
+    }
 
     virtual HelmholtzDerivatives all(HelmholtzEOSMixtureBackend& HEOS, const std::vector<CoolPropDbl>& mole_fractions, double tau, double delta,
                                      bool cache_values = false) {
+        ++evaluations;
         HelmholtzDerivatives a = CS.all(HEOS, tau, delta, mole_fractions, cache_values) + Excess.all(tau, delta, mole_fractions, cache_values);
         a.delta_x_dalphar_ddelta = delta * a.dalphar_ddelta;
         a.tau_x_dalphar_dtau = tau * a.dalphar_dtau;
@@ -110,11 +110,11 @@ void SaturationSolvers::saturation_T_pure_1D_P(HelmholtzEOSMixtureBackend& HEOS,
     };
 
     try {
-        Secant(resid, options.p, options.p * 1.1, 1e-10, 100);
+        Secant(resid, options.p, options.p * 1.1, HEOS.solver_tolerance(1e-10, HEOS.gas_constant() * T), 100);
     } catch (...) {
         CoolPropDbl pmax = std::min(options.p * 1.03, static_cast<CoolPropDbl>(HEOS.p_critical() + 1e-6));
         CoolPropDbl pmin = std::max(options.p * 0.97, static_cast<CoolPropDbl>(HEOS.p_triple() - 1e-6));
-        Brent(resid, pmin, pmax, LDBL_EPSILON, 1e-8, 100);
+        Brent(resid, pmin, pmax, LDBL_EPSILON, HEOS.solver_tolerance(1e-8, pmax), 100);
     }
 }
 
@@ -156,39 +156,21 @@ void SaturationSolvers::saturation_P_pure_1D_T(HelmholtzEOSMixtureBackend& HEOS,
 
     CoolPropDbl Tmax = std::min(options.T + 2, static_cast<CoolPropDbl>(HEOS.T_critical() - 1e-6));
     CoolPropDbl Tmin = std::max(options.T - 2, static_cast<CoolPropDbl>(HEOS.Ttriple() + 1e-6));
-    Brent(resid, Tmin, Tmax, LDBL_EPSILON, 1e-11, 100);
+    Brent(resid, Tmin, Tmax, LDBL_EPSILON, HEOS.solver_tolerance(1e-11, Tmax), 100);
 }
 
-void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl specified_value, saturation_PHSU_pure_options& options) {
-    /*
-    This function is inspired by the method of Akasaka:
-
-    R. Akasaka,"A Reliable and Useful Method to Determine the Saturation State from
-    Helmholtz Energy Equations of State",
-    Journal of Thermal Science and Technology v3 n3,2008
-
-    Ancillary equations are used to get a sensible starting point
-    */
-    std::vector<CoolPropDbl> negativer(3, _HUGE), v;
-    std::vector<std::vector<CoolPropDbl>> J(3, std::vector<CoolPropDbl>(3, _HUGE));
-
-    HEOS.calc_reducing_state();
-    const SimpleState& reduce = HEOS.get_reducing_state();
+void SaturationSolvers::saturation_PHSU_pure_ancillary_guess(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl specified_value,
+                                                             saturation_PHSU_pure_options& options, CoolPropDbl& T, CoolPropDbl& rhoL,
+                                                             CoolPropDbl& rhoV) {
     CoolProp::SimpleState crit = HEOS.get_state("reducing");
     shared_ptr<HelmholtzEOSMixtureBackend> SatL = HEOS.SatL, SatV = HEOS.SatV;
 
-    CoolPropDbl T, rhoL, rhoV, pL, pV, hL, sL, hV, sV;
-    CoolPropDbl deltaL = 0, deltaV = 0, tau = 0, error;
-    int iter = 0, specified_parameter;
-
-    // Use the density ancillary function as the starting point for the solver
     try {
         if (options.specified_variable == saturation_PHSU_pure_options::IMPOSED_PL
             || options.specified_variable == saturation_PHSU_pure_options::IMPOSED_PV) {
-            // Invert liquid density ancillary to get temperature
-            // TODO: fit inverse ancillaries too
+            // Evaluate the fitted inverse of the liquid pressure ancillary to get temperature
             try {
-                T = HEOS.get_components()[0].ancillaries.pL.invert(specified_value);
+                T = HEOS.get_components()[0].ancillaries.pL.invert_approximate(specified_value);
             } catch (...) {
                 throw ValueError("Unable to invert ancillary equation");
             }
@@ -196,7 +178,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, C
             CoolProp::SimpleState hs_anchor = HEOS.get_state("hs_anchor");
             // Ancillary is deltah = h - hs_anchor.h
             try {
-                T = HEOS.get_components()[0].ancillaries.hL.invert(specified_value - hs_anchor.hmolar);
+                T = HEOS.get_components()[0].ancillaries.hL.invert_approximate(specified_value - hs_anchor.hmolar);
             } catch (...) {
                 throw ValueError("Unable to invert ancillary equation for hL");
             }
@@ -223,7 +205,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, C
             double Tmin = Tmin_satL;
             double Tmax = HEOS.calc_Tmax_sat();
             try {
-                T = Brent(resid, Tmin - 3, Tmax + 1, DBL_EPSILON, 1e-10, 50);
+                T = Brent(resid, Tmin - 3, Tmax + 1, DBL_EPSILON, HEOS.solver_tolerance(1e-10, Tmax), 50);
             } catch (...) {
                 shared_ptr<HelmholtzEOSMixtureBackend> HEOS_copy(new HelmholtzEOSMixtureBackend(HEOS.get_components()));
                 HEOS_copy->update(QT_INPUTS, 1, Tmin);
@@ -289,7 +271,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, C
             double Tmin = Tmin_satL;
             double Tmax = HEOS.calc_Tmax_sat();
             try {
-                T = Brent(resid, Tmin - 3, Tmax, DBL_EPSILON, 1e-10, 50);
+                T = Brent(resid, Tmin - 3, Tmax, DBL_EPSILON, HEOS.solver_tolerance(1e-10, Tmax), 50);
             } catch (...) {
                 CoolPropDbl vmax = resid.call(Tmax);
                 // If near the critical point, use a near critical guess value for T
@@ -327,17 +309,48 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, C
         if (rhoL_updated > rhoV) {
             rhoL = rhoL_updated;
         }
-
-        // Update the state again with the better guess for the liquid density
-        SatL->update(DmolarT_INPUTS, rhoL, T);
-        SatV->update(DmolarT_INPUTS, rhoV, T);
-
-        deltaL = rhoL / reduce.rhomolar;
-        deltaV = rhoV / reduce.rhomolar;
-        tau = reduce.T / T;
     } catch (NotImplementedError&) {
         throw;  // ??? What is this try...catch for?
     }
+}
+
+void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl specified_value, saturation_PHSU_pure_options& options) {
+    /*
+    This function is inspired by the method of Akasaka:
+
+    R. Akasaka,"A Reliable and Useful Method to Determine the Saturation State from
+    Helmholtz Energy Equations of State",
+    Journal of Thermal Science and Technology v3 n3,2008
+
+    Ancillary equations are used to get a sensible starting point
+    */
+    std::vector<CoolPropDbl> negativer(3, _HUGE), v;
+    std::vector<std::vector<CoolPropDbl>> J(3, std::vector<CoolPropDbl>(3, _HUGE));
+
+    HEOS.calc_reducing_state();
+    const SimpleState& reduce = HEOS.get_reducing_state();
+    shared_ptr<HelmholtzEOSMixtureBackend> SatL = HEOS.SatL, SatV = HEOS.SatV;
+
+    CoolPropDbl T, rhoL, rhoV, pL, pV, hL, sL, hV, sV;
+    CoolPropDbl deltaL = 0, deltaV = 0, tau = 0, error;
+    int iter = 0, specified_parameter;
+
+    if (options.use_guesses && options.T > 0 && ValidNumber(options.T) && ValidNumber(options.rhoL) && ValidNumber(options.rhoV)
+        && options.rhoL > options.rhoV && options.rhoV > 0) {
+        // Start from the given saturation temperature and densities (from another model, for instance)
+        T = options.T;
+        rhoL = options.rhoL;
+        rhoV = options.rhoV;
+    } else {
+        // Use the density ancillary function as the starting point for the solver
+        saturation_PHSU_pure_ancillary_guess(HEOS, specified_value, options, T, rhoL, rhoV);
+    }
+    SatL->update(DmolarT_INPUTS, rhoL, T);
+    SatV->update(DmolarT_INPUTS, rhoV, T);
+
+    deltaL = rhoL / reduce.rhomolar;
+    deltaV = rhoV / reduce.rhomolar;
+    tau = reduce.T / T;
 
     do {
         /*if (get_debug_level()>8){
@@ -553,7 +566,7 @@ void SaturationSolvers::saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, C
             throw SolutionError(format("saturation_PHSU_pure solver did not converge after 50 iterations for %s=%Lg current error is %Lg",
                                        info.c_str(), specified_value, error));
         }
-    } while (error > 1e-9);
+    } while (error > HEOS.solver_tolerance(1e-9));
 }
 void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl rhomolar, saturation_D_pure_options& options)
 {
@@ -580,15 +593,13 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend& HEOS, Cool
     // Use the density ancillary function as the starting point for the solver
     try {
         if (options.imposed_rho == saturation_D_pure_options::IMPOSED_RHOL) {
-            // Invert liquid density ancillary to get temperature
-            // TODO: fit inverse ancillaries too
-            T = HEOS.get_components()[0].ancillaries.rhoL.invert(rhomolar);
+            // Evaluate the fitted inverse of the liquid density ancillary to get temperature
+            T = HEOS.get_components()[0].ancillaries.rhoL.invert_approximate(rhomolar);
             rhoV = HEOS.get_components()[0].ancillaries.rhoV.evaluate(T);
             rhoL = rhomolar;
         } else if (options.imposed_rho == saturation_D_pure_options::IMPOSED_RHOV) {
-            // Invert vapor density ancillary to get temperature
-            // TODO: fit inverse ancillaries too
-            T = HEOS.get_components()[0].ancillaries.rhoV.invert(rhomolar);
+            // Evaluate the fitted inverse of the vapor density ancillary to get temperature
+            T = HEOS.get_components()[0].ancillaries.rhoV.invert_approximate(rhomolar);
             rhoL = HEOS.get_components()[0].ancillaries.rhoL.evaluate(T);
             rhoV = rhomolar;
         } else {
@@ -698,7 +709,7 @@ void SaturationSolvers::saturation_D_pure(HelmholtzEOSMixtureBackend& HEOS, Cool
         if (iter > options.max_iterations){
             throw SolutionError(format("saturation_D_pure solver did not converge after %d iterations with rho: %g mol/m^3",options.max_iterations,rhomolar));
         }
-    } while (error > 1e-9);
+    } while (error > HEOS.solver_tolerance(1e-9));
     CoolPropDbl p_error_limit = 1e-3;
     if (std::abs(p_error) > p_error_limit) {
         throw SolutionError(format("saturation_D_pure solver abs error on p [%Lg] > limit [%Lg]", p_error, p_error_limit));
@@ -853,7 +864,8 @@ void SaturationSolvers::saturation_T_pure_Akasaka(HelmholtzEOSMixtureBackend& HE
         if (iter > 100) {
             throw SolutionError(format("Akasaka solver did not converge after 100 iterations"));
         }
-    } while (error > 1e-10 && std::abs(stepL) > 10 * DBL_EPSILON * std::abs(stepL) && std::abs(stepV) > 10 * DBL_EPSILON * std::abs(stepV));
+    } while (error > HEOS.solver_tolerance(1e-10) && std::abs(stepL) > 10 * DBL_EPSILON * std::abs(stepL)
+             && std::abs(stepV) > 10 * DBL_EPSILON * std::abs(stepV));
 
     CoolPropDbl p_error_limit = 1e-3;
     CoolPropDbl p_error = (PL - PV) / PL;
@@ -1054,7 +1066,7 @@ void SaturationSolvers::saturation_T_pure_Maxwell(HelmholtzEOSMixtureBackend& HE
                                        "dvV/vV: %Lg pL: %Lg pV: %Lg\n",
                                        rhoL, rhoV, error, DeltavL / vL, DeltavV / vV, pL, pV));
         }
-    } while ((SatL->p() < 0) || (error > 1e-10 && small_step_count < 4 && backwards_step_count < 6));
+    } while ((SatL->p() < 0) || (error > HEOS.solver_tolerance(1e-10) && small_step_count < 4 && backwards_step_count < 6));
     if (get_debug_level() > 5) {
         std::cout << format("[Maxwell] pL: %g pV: %g\n", SatL->p(), SatV->p());
     }
@@ -1362,7 +1374,7 @@ void SaturationSolvers::newton_raphson_saturation::call(HelmholtzEOSMixtureBacke
         if (iter == IO.Nstep_max) {
             throw ValueError(format("newton_raphson_saturation::call reached max number of iterations [%d]", IO.Nstep_max));
         }
-    } while (this->error_rms > 1e-7 && min_rel_change > 1000 * DBL_EPSILON && iter < IO.Nstep_max);
+    } while (this->error_rms > HEOS.solver_tolerance(1e-7) && min_rel_change > 1000 * DBL_EPSILON && iter < IO.Nstep_max);
 
     IO.Nsteps = iter;
     IO.p = p;
@@ -1580,7 +1592,7 @@ void SaturationSolvers::newton_raphson_twophase::call(HelmholtzEOSMixtureBackend
         if (iter == IO.Nstep_max) {
             throw ValueError(format("newton_raphson_saturation::call reached max number of iterations [%d]", IO.Nstep_max));
         }
-    } while (this->error_rms > 1e-9 && min_rel_change > 1000 * DBL_EPSILON && iter < IO.Nstep_max);
+    } while (this->error_rms > HEOS.solver_tolerance(1e-9) && min_rel_change > 1000 * DBL_EPSILON && iter < IO.Nstep_max);
 
     IO.Nsteps = iter;
     IO.p = p;
@@ -1990,7 +2002,7 @@ void SaturationSolvers::PTflash_twophase::solve() {
         if (iter == IO.Nstep_max) {
             throw ValueError(format("PTflash_twophase::call reached max number of iterations [%d]", IO.Nstep_max));
         }
-    } while (this->error_rms > 1e-9 && min_rel_change > 1000 * DBL_EPSILON && iter < IO.Nstep_max);
+    } while (this->error_rms > HEOS.solver_tolerance(1e-9) && min_rel_change > 1000 * DBL_EPSILON && iter < IO.Nstep_max);
 }
 void SaturationSolvers::PTflash_twophase::build_arrays() {
     const std::size_t N = IO.x.size();
@@ -105,6 +105,10 @@ inline int format_as(saturation_PHSU_pure_options::specified_variable_options op
 
 void saturation_PHSU_pure(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl specified_value, saturation_PHSU_pure_options& options);
 
+/// The starting temperature and densities of saturation_PHSU_pure from the ancillary equations, when no guesses are given
+void saturation_PHSU_pure_ancillary_guess(HelmholtzEOSMixtureBackend& HEOS, CoolPropDbl specified_value, saturation_PHSU_pure_options& options,
+                                          CoolPropDbl& T, CoolPropDbl& rhoL, CoolPropDbl& rhoV);
+
 /* \brief This is a backup saturation_p solver for the case where the Newton solver cannot approach closely enough the solution
      *
      * This is especially a problem at low pressures where catastrophic truncation error occurs, especially in the saturated vapor side
@@ -20,6 +20,33 @@ class IF97Backend : public AbstractState
     CachedElement _hmass, _rhomass, _smass;
     /// CachedElement  _hVmass, _hLmass, _sVmass, sLmass;
 
+    /// The temperature, pressure, quality and phase, which are all that the outputs need, and the mass-based values that update() caches
+    void calc_snapshot(std::vector<double>& buffer) {
+        buffer.push_back(_T);
+        buffer.push_back(_p);
+        buffer.push_back(_Q);
+        buffer.push_back(static_cast<double>(_phase));
+        snapshot_cached(buffer, _hmass);
+        snapshot_cached(buffer, _rhomass);
+        snapshot_cached(buffer, _smass);
+    };
+    void calc_restore(const std::vector<double>& buffer, std::size_t& i) {
+        double T = restore_value(buffer, i), p = restore_value(buffer, i), Q = restore_value(buffer, i), phase = restore_value(buffer, i);
+        CachedElement hmass, rhomass, smass;
+        restore_cached(buffer, i, hmass);
+        restore_cached(buffer, i, rhomass);
+        restore_cached(buffer, i, smass);
+        restore_end(buffer, i);
+        clear();
+        _T = T;
+        _p = p;
+        _Q = Q;
+        _phase = static_cast<phases>(static_cast<int>(phase));
+        _hmass = hmass;
+        _rhomass = rhomass;
+        _smass = smass;
+    };
+
    public:
     /// The name of the backend being used
     std::string backend_name(void) {
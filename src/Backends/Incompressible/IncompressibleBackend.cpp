@@ -151,6 +151,27 @@ void IncompressibleBackend::update(CoolProp::input_pairs input_pair, double valu
     fluid->checkTPX(_T, _p, _fractions[0]);
 }
 
+void IncompressibleBackend::calc_snapshot(std::vector<double>& buffer) {
+    snapshot_vector(buffer, _fractions);
+    buffer.push_back(_T);
+    buffer.push_back(_p);
+    buffer.push_back(static_cast<double>(_fluid_type));
+}
+
+void IncompressibleBackend::calc_restore(const std::vector<double>& buffer, std::size_t& i) {
+    std::vector<CoolPropDbl> fractions;
+    restore_vector(buffer, i, fractions);
+    double T = restore_value(buffer, i), p = restore_value(buffer, i), fluid_type = restore_value(buffer, i);
+    restore_end(buffer, i);
+    // Only changes the reference state if the fractions are not the current ones
+    set_fractions(fractions);
+    clear();
+    _T = T;
+    _p = p;
+    _fluid_type = static_cast<long>(fluid_type);
+    _phase = iphase_liquid;
+}
+
 /// Clear all the cached values
 bool IncompressibleBackend::clear() {
     AbstractState::clear();  // Call the base class
@@ -35,6 +35,10 @@ class IncompressibleBackend : public AbstractState
     */
     void set_fractions(const std::vector<CoolPropDbl>& fractions);
 
+    /// The fractions, temperature and pressure, from which all the outputs are calculated
+    void calc_snapshot(std::vector<double>& buffer);
+    void calc_restore(const std::vector<double>& buffer, std::size_t& i);
+
    public:
     IncompressibleBackend();
     virtual ~IncompressibleBackend(){};
@@ -56,6 +56,7 @@ surface tension                 N/m
 #    include <sys/stat.h>
 #endif
 
+// The signature of the setup that is currently loaded into REFPROP, empty if unknown
 std::string LoadedREFPROPRef;
 
 static bool dbg_refprop = false;
@@ -164,6 +165,25 @@ class REFPROPGenerator : public AbstractStateGenerator
 // This static initialization will cause the generator to register
 static GeneratorInitializer<REFPROPGenerator> refprop_gen(REFPROP_BACKEND_FAMILY);
 
+static REFPROPSetupStatistics refprop_setup_statistics;
+
+void REFPROPSetupSnapshot::update_signature() {
+    signature = format("%s|%s|GERG:%d|PR:%d", components.c_str(), predefined_mixture ? "MIX" : "SETUP", static_cast<int>(use_GERG), PR_flag);
+    for (std::size_t k = 0; k < binary_overrides.size(); ++k) {
+        const REFPROPBinaryOverride& o = binary_overrides[k];
+        signature += format("|KTV:%d,%d,%s,%s", o.icomp, o.jcomp, o.hmodij.c_str(), o.hfmix.c_str());
+        for (int l = 0; l < 6; ++l) {
+            signature += format(",%a", o.fij[l]);
+        }
+    }
+}
+REFPROPSetupStatistics REFPROPMixtureBackend::setup_statistics() {
+    return refprop_setup_statistics;
+}
+void REFPROPMixtureBackend::reset_setup_statistics() {
+    refprop_setup_statistics = REFPROPSetupStatistics();
+}
+
 void REFPROPMixtureBackend::construct(const std::vector<std::string>& fluid_names) {
     // Do the REFPROP instantiation for this fluid
     _mole_fractions_set = false;
@@ -280,16 +300,17 @@ std::string REFPROPMixtureBackend::version() {
 }
 
 void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& fluid_names) {
-    // If the name of the refrigerant doesn't match
-    // that of the currently loaded refrigerant, fluids must be loaded
-    if (!cached_component_string.empty() && LoadedREFPROPRef == cached_component_string) {
+    // If the setup of this instance doesn't match
+    // that of the currently loaded setup, fluids must be loaded
+    if (!setup_snapshot.signature.empty() && LoadedREFPROPRef == setup_snapshot.signature) {
         if (CoolProp::get_debug_level() > 5) {
-            std::cout << format("%s:%d: The current fluid can be reused; %s and %s match \n", __FILE__, __LINE__, cached_component_string.c_str(),
+            std::cout << format("%s:%d: The current fluid can be reused; %s and %s match \n", __FILE__, __LINE__, setup_snapshot.signature.c_str(),
                                 LoadedREFPROPRef.c_str());
         }
         if (dbg_refprop)
-            std::cout << format("%s:%d: The current fluid can be reused; %s and %s match \n", __FILE__, __LINE__, cached_component_string.c_str(),
+            std::cout << format("%s:%d: The current fluid can be reused; %s and %s match \n", __FILE__, __LINE__, setup_snapshot.signature.c_str(),
                                 LoadedREFPROPRef.c_str());
+        refprop_setup_statistics.reuses++;
         int N = static_cast<int>(this->fluid_names.size());
         if (N > ncmax) {
             throw ValueError(format("Size of fluid vector [%d] is larger than the maximum defined by REFPROP [%d]", fluid_names.size(), ncmax));
@@ -299,8 +320,15 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
         mole_fractions_liq.resize(ncmax);
         mole_fractions_vap.resize(ncmax);
         return;
+    } else if (!setup_snapshot.signature.empty() && fluid_names == this->fluid_names) {
+        // This instance has been set up before, but another setup has been loaded in the meantime; there is no need to
+        // try the file endings again
+        load_setup_snapshot();
+        return;
     } else {
         int ierr = 0;
+        // Whatever happens below, the setup that was loaded before is gone
+        LoadedREFPROPRef = "";
         this->fluid_names = fluid_names;
         char component_string[10000], herr[errormessagelength];
         std::string components_joined = strjoin(fluid_names, "|");
@@ -317,9 +345,9 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
         }
         strcpy(hmx_bnc, _HMX_path);
 
-        if (get_config_bool(REFPROP_USE_GERG)) {
-            int iflag = 1,  // Tell REFPROP to use GERG04; 0 unsets GERG usage
-              ierr = 0;
+        {
+            // Tell REFPROP to use GERG04 (1), or unset it (0), since another instance may have set it
+            int iflag = get_config_bool(REFPROP_USE_GERG) ? 1 : 0, ierr = 0;
             char herr[255];
             GERG04dll(&N, &iflag, &ierr, herr, 255);
         }
@@ -343,13 +371,19 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
             strcpy(mix, _components_joined_raw);
 
             SETMIXdll(mix, hmx_bnc, reference_state, &N, component_string, &(x[0]), &ierr, herr, 255, 255, 3, 10000, 255);
+            refprop_setup_statistics.setup_calls++;
             if (static_cast<int>(ierr) <= 0) {
                 this->Ncomp = N;
                 mole_fractions.resize(ncmax);
                 mole_fractions_liq.resize(ncmax);
                 mole_fractions_vap.resize(ncmax);
-                LoadedREFPROPRef = mix;
-                cached_component_string = mix;
+                setup_snapshot = REFPROPSetupSnapshot();
+                setup_snapshot.components = mix;
+                setup_snapshot.predefined_mixture = true;
+                setup_snapshot.use_GERG = get_config_bool(REFPROP_USE_GERG);
+                setup_snapshot.PR_flag = get_config_bool(REFPROP_USE_PENGROBINSON) ? 2 : 0;
+                setup_snapshot.update_signature();
+                LoadedREFPROPRef = setup_snapshot.signature;
                 this->fluid_names.clear();
                 this->fluid_names.push_back(components_joined_raw);
                 if (CoolProp::get_debug_level() > 5) {
@@ -360,13 +394,8 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
                     throw ValueError(format("Interaction parameter estimation has been disabled: %s", herr));
                 }
                 set_mole_fractions(std::vector<CoolPropDbl>(x.begin(), x.begin() + N));
-                if (get_config_bool(REFPROP_USE_PENGROBINSON)) {
-                    int iflag = 2;  // Tell REFPROP to use Peng-Robinson;
-                    PREOSdll(&iflag);
-                } else {
-                    int iflag = 0;  // Tell REFPROP to use normal Helmholtz models
-                    PREOSdll(&iflag);
-                }
+                // Tell REFPROP to use Peng-Robinson (2) or the normal Helmholtz models (0)
+                PREOSdll(&setup_snapshot.PR_flag);
                 return;
             } else {
                 if (CoolProp::get_debug_level() > 0) {
@@ -411,6 +440,7 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
                      lengthofreference,  // Length of reference
                      errormessagelength  // Length of error message
             );
+            refprop_setup_statistics.setup_calls++;
             if (get_config_bool(REFPROP_DONT_ESTIMATE_INTERACTION_PARAMETERS) && ierr == -117) {
                 throw ValueError(format("Interaction parameter estimation has been disabled: %s", herr));
             }
@@ -423,20 +453,19 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
                 mole_fractions.resize(ncmax);
                 mole_fractions_liq.resize(ncmax);
                 mole_fractions_vap.resize(ncmax);
-                LoadedREFPROPRef = _components_joined;
-                cached_component_string = _components_joined;
+                setup_snapshot = REFPROPSetupSnapshot();
+                setup_snapshot.components = _components_joined;
+                setup_snapshot.use_GERG = get_config_bool(REFPROP_USE_GERG);
+                setup_snapshot.PR_flag = get_config_bool(REFPROP_USE_PENGROBINSON) ? 2 : 0;
+                setup_snapshot.update_signature();
+                LoadedREFPROPRef = setup_snapshot.signature;
                 if (CoolProp::get_debug_level() > 5) {
                     std::cout << format("%s:%d: Successfully loaded REFPROP fluid: %s\n", __FILE__, __LINE__, components_joined.c_str());
                 }
                 if (dbg_refprop) std::cout << format("%s:%d: Successfully loaded REFPROP fluid: %s\n", __FILE__, __LINE__, components_joined.c_str());
 
-                if (get_config_bool(REFPROP_USE_PENGROBINSON)) {
-                    int iflag = 2;  // Tell REFPROP to use Peng-Robinson;
-                    PREOSdll(&iflag);
-                } else {
-                    int iflag = 0;  // Tell REFPROP to use normal Helmholtz models
-                    PREOSdll(&iflag);
-                }
+                // Tell REFPROP to use Peng-Robinson (2) or the normal Helmholtz models (0)
+                PREOSdll(&setup_snapshot.PR_flag);
                 return;
             } else if (k < number_of_endings - 1) {  // Keep going
                 if (CoolProp::get_debug_level() > 5) {
@@ -452,7 +481,93 @@ void REFPROPMixtureBackend::set_REFPROP_fluids(const std::vector<std::string>& f
         }
     }
 }
+void REFPROPMixtureBackend::load_setup_snapshot() {
+    int ierr = 0, N = static_cast<int>(fluid_names.size());
+    char herr[errormessagelength + 1] = "";
+    LoadedREFPROPRef = "";
+
+    // Get path to HMX.BNC file
+    char hmx_bnc[255];
+    const std::string HMX_path = get_REFPROP_HMX_BNC_path();
+    if (HMX_path.size() > refpropcharlength) {
+        throw ValueError(format("Full HMX path (%s) is too long; max length is 255 characters", HMX_path.c_str()));
+    }
+    strcpy(hmx_bnc, HMX_path.c_str());
+
+    // Tell REFPROP to use GERG04 (1), or unset it (0) if the setup that was loaded before used it
+    int iflag = setup_snapshot.use_GERG ? 1 : 0;
+    GERG04dll(&N, &iflag, &ierr, herr, 255);
+    ierr = 0;
+    if (setup_snapshot.predefined_mixture) {
+        std::vector<double> x(ncmax);
+        char mix[255], component_string[10000], reference_state[4] = "DEF";
+        strcpy(mix, setup_snapshot.components.c_str());
+        // The composition from the .MIX file is not used; this instance keeps its own composition
+        SETMIXdll(mix, hmx_bnc, reference_state, &N, component_string, &(x[0]), &ierr, herr, 255, 255, 3, 10000, 255);
+    } else {
+        N = static_cast<int>(this->Ncomp);
+        char component_string[10000];
+        strcpy(component_string, setup_snapshot.components.c_str());
+        // Pad the fluid string all the way to 10k characters with spaces to deal with string parsing bug in REFPROP in SETUPdll
+        for (std::size_t i = setup_snapshot.components.size(); i < 10000; ++i) {
+            component_string[i] = ' ';
+        }
+        SETUPdll(&N, component_string, hmx_bnc, default_reference_state, &ierr, herr, 10000, refpropcharlength, lengthofreference,
+                 errormessagelength);
+    }
+    refprop_setup_statistics.setup_calls++;
+    if (get_config_bool(REFPROP_IGNORE_ERROR_ESTIMATED_INTERACTION_PARAMETERS) && ierr == 117) {
+        ierr = 0;
+    }
+    if (static_cast<int>(ierr) > 0) {
+        throw ValueError(format("Could not load these fluids again [%s]: %s", setup_snapshot.components.c_str(), herr));
+    }
+    PREOSdll(&setup_snapshot.PR_flag);
+
+    // Set the interaction parameters that were modified by the user again, since SETUP goes back to the values from the files
+    for (std::size_t k = 0; k < setup_snapshot.binary_overrides.size(); ++k) {
+        REFPROPBinaryOverride& o = setup_snapshot.binary_overrides[k];
+        char hmodij[4], hfmix[255];
+        strcpy(hmodij, o.hmodij.c_str());
+        strcpy(hfmix, o.hfmix.c_str());
+        ierr = 0;
+        SETKTVdll(&o.icomp, &o.jcomp, hmodij, o.fij, hfmix, &ierr, herr, 3, 255, 255);
+        if (ierr > get_config_int(REFPROP_ERROR_THRESHOLD)) {
+            throw ValueError(format("Unable to set the interaction parameters of the pair (%d,%d) again: %s", o.icomp, o.jcomp, herr));
+        }
+    }
+    LoadedREFPROPRef = setup_snapshot.signature;
+    refprop_setup_statistics.switches++;
+    if (CoolProp::get_debug_level() > 5) {
+        std::cout << format("%s:%d: Loaded REFPROP setup again: %s\n", __FILE__, __LINE__, setup_snapshot.signature.c_str());
+    }
+}
+void REFPROPMixtureBackend::add_binary_override(int icomp, int jcomp, const char* hmodij, const double* fij, const char* hfmix) {
+    REFPROPBinaryOverride o;
+    o.icomp = icomp;
+    o.jcomp = jcomp;
+    o.hmodij = std::string(hmodij, strnlen(hmodij, 3));
+    o.hfmix = std::string(hfmix, strnlen(hfmix, 254));
+    for (int l = 0; l < 6; ++l) {
+        o.fij[l] = fij[l];
+    }
+    std::vector<REFPROPBinaryOverride>& overrides = setup_snapshot.binary_overrides;
+    std::size_t k = 0;
+    for (; k < overrides.size(); ++k) {
+        if (overrides[k].icomp == icomp && overrides[k].jcomp == jcomp) {
+            overrides[k] = o;
+            break;
+        }
+    }
+    if (k == overrides.size()) {
+        overrides.push_back(o);
+    }
+    // The loaded setup now has the modified parameters
+    setup_snapshot.update_signature();
+    LoadedREFPROPRef = setup_snapshot.signature;
+}
 std::string REFPROPMixtureBackend::fluid_param_string(const std::string& ParamName) {
+    this->check_loaded_fluid();
     if (ParamName == "CAS") {
         //        subroutine NAME (icomp,hnam,hn80,hcasn)
         //        c
@@ -495,6 +610,7 @@ std::string REFPROPMixtureBackend::fluid_param_string(const std::string& ParamNa
     }
 };
 int REFPROPMixtureBackend::match_CAS(const std::string& CAS) {
+    this->check_loaded_fluid();
     for (int icomp = 1L; icomp <= static_cast<int>(fluid_names.size()); ++icomp) {
         char hnam[13], hn80[81], hcasn[13];
         NAMEdll(&icomp, hnam, hn80, hcasn, 12, 80, 12);
@@ -558,6 +674,7 @@ void REFPROPMixtureBackend::set_binary_interaction_string(const std::size_t i, c
     } else if (j < 0 || j >= Ncomp) {
         throw ValueError(format("Index j [%d] is out of bounds. Must be between 0 and %d.", j, Ncomp-1));
     }
+    this->check_loaded_fluid();
     int icomp = static_cast<int>(i) + 1, jcomp = static_cast<int>(j) + 1, ierr = 0L;
     char hmodij[4], hfmix[255], hbinp[255], hfij[255], hmxrul[255];
     double fij[6];
@@ -579,6 +696,7 @@ void REFPROPMixtureBackend::set_binary_interaction_string(const std::size_t i, c
     if (ierr > get_config_int(REFPROP_ERROR_THRESHOLD)) {
         throw ValueError(format("Unable to set parameter[%s] to value[%s]: %s", parameter.c_str(), value.c_str(), herr));
     }
+    add_binary_override(icomp, jcomp, hmodij, fij, hfmix);
 }
 /// Set binary mixture string parameter (EXPERT USE ONLY!!!)
 void REFPROPMixtureBackend::set_binary_interaction_double(const std::size_t i, const std::size_t j, const std::string& parameter,
@@ -593,6 +711,7 @@ void REFPROPMixtureBackend::set_binary_interaction_double(const std::size_t i, c
     } else if (j < 0 || j >= Ncomp) {
         throw ValueError(format("Index j [%d] is out of bounds. Must be between 0 and %d.", j, Ncomp-1));
     }
+    this->check_loaded_fluid();
     int icomp = static_cast<int>(i) + 1, jcomp = static_cast<int>(j) + 1, ierr = 0L;
     char hmodij[4], hfmix[255], hbinp[255], hfij[255], hmxrul[255];
     double fij[6];
@@ -621,6 +740,7 @@ void REFPROPMixtureBackend::set_binary_interaction_double(const std::size_t i, c
         if (ierr > get_config_int(REFPROP_ERROR_THRESHOLD)) {
             throw ValueError(format("Unable to set parameter[%s] to value[%g]: %s", parameter.c_str(), value, herr));
         }
+        add_binary_override(icomp, jcomp, hmodij, fij, hfmix);
     } else {
         throw ValueError(format("For now, model [%s] must start with KW or GE", hmodij));
     }
@@ -638,6 +758,7 @@ double REFPROPMixtureBackend::get_binary_interaction_double(const std::size_t i,
     } else if (j < 0 || j >= Ncomp) {
         throw ValueError(format("Index j [%d] is out of bounds. Must be between 0 and %d.", j, Ncomp-1));
     }
+    this->check_loaded_fluid();
     int icomp = static_cast<int>(i) + 1, jcomp = static_cast<int>(j) + 1;
     char hmodij[4], hfmix[255], hbinp[255], hfij[255], hmxrul[255];
     double fij[6];
@@ -687,6 +808,7 @@ void REFPROPMixtureBackend::set_mass_fractions(const std::vector<CoolPropDbl>& m
         throw ValueError(
           format("size of mass fraction vector [%d] does not equal that of component vector [%d]", mass_fractions.size(), this->Ncomp));
     }
+    this->check_loaded_fluid();
     std::vector<double> moles(this->Ncomp);
     double sum_moles = 0.0;
     double wmm, ttrp, tnbpt, tc, pc, Dc, Zc, acf, dip, Rgas;
@@ -775,6 +897,7 @@ CoolPropDbl REFPROPMixtureBackend::calc_p_critical() {
     return static_cast<CoolPropDbl>(pcrit_kPa * 1000);
 };
 CoolPropDbl REFPROPMixtureBackend::calc_rhomolar_critical() {
+    this->check_loaded_fluid();
     int ierr = 0;
     char herr[255];
     double Tcrit, pcrit_kPa, dcrit_mol_L;
@@ -910,16 +1033,19 @@ CoolPropDbl REFPROPMixtureBackend::calc_molar_mass(void) {
     return static_cast<CoolPropDbl>(_molar_mass.pt());
 };
 CoolPropDbl REFPROPMixtureBackend::calc_Bvirial(void) {
+    this->check_loaded_fluid();
     double b;
     VIRBdll(&_T, &(mole_fractions[0]), &b);
     return b * 0.001;  // 0.001 to convert from l/mol to m^3/mol
 }
 CoolPropDbl REFPROPMixtureBackend::calc_dBvirial_dT(void) {
+    this->check_loaded_fluid();
     double b;
     DBDTdll(&_T, &(mole_fractions[0]), &b);
     return b * 0.001;  // 0.001 to convert from l/mol to m^3/mol
 }
 CoolPropDbl REFPROPMixtureBackend::calc_Cvirial(void) {
+    this->check_loaded_fluid();
     double c;
     VIRCdll(&_T, &(mole_fractions[0]), &c);
     return c * 1e-6;  // 1e-6 to convert from (l/mol)^2 to (m^3/mol)^2
@@ -980,6 +1106,7 @@ bool REFPROPMixtureBackend::has_melting_line() {
 const std::vector<CoolPropDbl> REFPROPMixtureBackend::calc_mass_fractions() {
     // mass fraction is mass_i/total_mass;
     // REFPROP yields mm in kg/kmol, CP uses base SI units of kg/mol;
+    this->check_loaded_fluid();
     CoolPropDbl mm = molar_mass();
     std::vector<CoolPropDbl> mass_fractions(mole_fractions_long_double.size());
     double wmm, ttrp, tnbpt, tc, pc, Dc, Zc, acf, dip, Rgas;
@@ -996,6 +1123,7 @@ CoolPropDbl REFPROPMixtureBackend::calc_PIP(void) {
     // Calculate the PIP factor of Venkatharathnam and Oellrich, "Identification of the phase of a fluid using
     // partial derivatives of pressure, volume,and temperature without reference to saturation properties:
     // Applications in phase equilibria calculations"
+    this->check_loaded_fluid();
     double t = _T, rho = _rhomolar / 1000.0,  // mol/dm^3
       p = 0, e = 0, h = 0, s = 0, cv = 0, cp = 0, w = 0, Z = 0, hjt = 0, A = 0, G = 0, xkappa = 0, beta = 0, dPdrho = 0, d2PdD2 = 0, dPT = 0,
            drhodT = 0, drhodP = 0, d2PT2 = 0, d2PdTD = 0, spare3 = 0, spare4 = 0;
@@ -2069,6 +2197,7 @@ CoolPropDbl REFPROPMixtureBackend::calc_saturated_liquid_keyed_output(parameters
         } else if (key == iDmass) {
             return static_cast<double>(_rhoLmolar) * calc_saturated_liquid_keyed_output(imolar_mass);
         } else if (key == imolar_mass) {
+            this->check_loaded_fluid();
             double wmm_kg_kmol = 0;
             WMOLdll(&(mole_fractions_liq[0]), &wmm_kg_kmol);  // returns mole mass in kg/kmol
             return wmm_kg_kmol / 1000;                        // kg/mol
@@ -2087,6 +2216,7 @@ CoolPropDbl REFPROPMixtureBackend::calc_saturated_vapor_keyed_output(parameters
         } else if (key == iDmass) {
             return static_cast<double>(_rhoVmolar) * calc_saturated_vapor_keyed_output(imolar_mass);
         } else if (key == imolar_mass) {
+            this->check_loaded_fluid();
             double wmm_kg_kmol = 0;
             WMOLdll(&(mole_fractions_vap[0]), &wmm_kg_kmol);  // returns mole mass in kg/kmol
             return wmm_kg_kmol / 1000;                        // kg/mol
@@ -2302,4 +2432,93 @@ TEST_CASE("Check PHI0 derivatives", "[REFPROP_PHI0]") {
     }
 }
 
+#    if defined(REFPROP_STUB_LIBRARY) && defined(REFPROP_STUB_ROOT)
+#        if !defined(_WIN32)
+#            include <dlfcn.h>
+/// The flag of the last call to GERG04 in the stand-in for REFPROP, which is already loaded
+static int REFPROP_stub_GERG_flag() {
+    void* handle = dlopen(REFPROP_STUB_LIBRARY, RTLD_NOW);
+    REQUIRE(handle != NULL);
+    int (*get_flag)() = reinterpret_cast<int (*)()>(dlsym(handle, "REFPROPSTUB_GERG_flag"));
+    REQUIRE(get_flag != NULL);
+    int flag = get_flag();
+    dlclose(handle);
+    return flag;
+}
+#        endif
+// These tests use the loopback stand-in for REFPROP from src/Tests/REFPROP-stub.cpp, which models all fluids as ideal gases
+TEST_CASE("Switching between the setups of several REFPROP instances", "[REFPROP_switching]") {
+    std::string err, alt_path = CoolProp::get_config_string(ALTERNATIVE_REFPROP_PATH);
+    CoolProp::force_unload_REFPROP();
+    REQUIRE(::load_REFPROP(err, "", REFPROP_STUB_LIBRARY));
+    CoolProp::set_config_string(ALTERNATIVE_REFPROP_PATH, REFPROP_STUB_ROOT);
+    {
+        shared_ptr<CoolProp::AbstractState> N2(CoolProp::AbstractState::factory("REFPROP", "Nitrogen")),
+          N2b(CoolProp::AbstractState::factory("REFPROP", "Nitrogen")), Ar(CoolProp::AbstractState::factory("REFPROP", "Argon")),
+          mix(CoolProp::AbstractState::factory("REFPROP", "Nitrogen&Argon"));
+        mix->set_mole_fractions(std::vector<double>(2, 0.5));
+        double T = 300, p = 101325, rho_ideal = p / (8.314462618 * T);
+
+        SECTION("Instances with the same setup share it without reloading") {
+            N2->update(CoolProp::PT_INPUTS, p, T);
+            CoolProp::REFPROPMixtureBackend::reset_setup_statistics();
+            for (int i = 0; i < 10; ++i) {
+                N2->update(CoolProp::PT_INPUTS, p, T);
+                N2b->update(CoolProp::PT_INPUTS, p, T);
+            }
+            CoolProp::REFPROPSetupStatistics stats = CoolProp::REFPROPMixtureBackend::setup_statistics();
+            CHECK(stats.setup_calls == 0);
+            CHECK(stats.switches == 0);
+            CHECK(stats.reuses > 0);
+        }
+        SECTION("Each switch needs one call to SETUP, without trying the file endings again") {
+            CoolProp::REFPROPMixtureBackend::reset_setup_statistics();
+            for (int i = 0; i < 10; ++i) {
+                N2->update(CoolProp::PT_INPUTS, p, T);
+                CHECK(std::abs(N2->molar_mass() / 0.02801348 - 1) < 1e-12);
+                Ar->update(CoolProp::PT_INPUTS, p, T);
+                CHECK(std::abs(Ar->molar_mass() / 0.039948 - 1) < 1e-12);
+                CHECK(std::abs(Ar->rhomolar() / rho_ideal - 1) < 1e-12);
+            }
+            CoolProp::REFPROPSetupStatistics stats = CoolProp::REFPROPMixtureBackend::setup_statistics();
+            CHECK(stats.setup_calls == 20);
+            CHECK(stats.switches == 20);
+        }
+        SECTION("Modified interaction parameters survive a switch") {
+            mix->set_binary_interaction_double(0, 1, "betaT", 1.1);
+            N2->update(CoolProp::PT_INPUTS, p, T);
+            CoolProp::REFPROPMixtureBackend::reset_setup_statistics();
+            CHECK(mix->get_binary_interaction_double(0, 1, "betaT") == 1.1);
+            CHECK(CoolProp::REFPROPMixtureBackend::setup_statistics().setup_calls == 1);
+            mix->update(CoolProp::PT_INPUTS, p, T);
+            CHECK(std::abs(mix->molar_mass() / (0.5 * 0.02801348 + 0.5 * 0.039948) - 1) < 1e-12);
+            CHECK(CoolProp::REFPROPMixtureBackend::setup_statistics().setup_calls == 1);
+        }
+#        if !defined(_WIN32)
+        SECTION("Switching from an instance that uses GERG-2004 to one that does not unsets it") {
+            bool use_GERG = CoolProp::get_config_bool(REFPROP_USE_GERG);
+            CoolProp::set_config_bool(REFPROP_USE_GERG, true);
+            shared_ptr<CoolProp::AbstractState> A(CoolProp::AbstractState::factory("REFPROP", "Nitrogen&Argon"));
+            CHECK(REFPROP_stub_GERG_flag() == 1);
+            CoolProp::set_config_bool(REFPROP_USE_GERG, false);
+            shared_ptr<CoolProp::AbstractState> B(CoolProp::AbstractState::factory("REFPROP", "Nitrogen&Argon"));
+            CoolProp::set_config_bool(REFPROP_USE_GERG, use_GERG);
+            CHECK(REFPROP_stub_GERG_flag() == 0);
+            A->set_mole_fractions(std::vector<double>(2, 0.5));
+            B->set_mole_fractions(std::vector<double>(2, 0.5));
+            for (int i = 0; i < 3; ++i) {
+                A->update(CoolProp::PT_INPUTS, p, T);
+                CHECK(REFPROP_stub_GERG_flag() == 1);
+                B->update(CoolProp::PT_INPUTS, p, T);
+                CHECK(REFPROP_stub_GERG_flag() == 0);
+            }
+        }
+#        endif
+    }
+    // Unload the stub, so that the later tests load the real REFPROP again
+    CoolProp::force_unload_REFPROP();
+    CoolProp::set_config_string(ALTERNATIVE_REFPROP_PATH, alt_path);
+}
+#    endif
+
 #endif
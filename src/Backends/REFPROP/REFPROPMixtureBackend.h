@@ -15,10 +15,46 @@
 
 namespace CoolProp {
 
+/// A binary interaction parameter set that was modified with SETKTV, and that must be set again after SETUP is called
+struct REFPROPBinaryOverride
+{
+    int icomp, jcomp;
+    std::string hmodij, hfmix;
+    double fij[6];
+};
+
+/// Everything that is needed to bring REFPROP back into the state that is used by one instance of the backend
+struct REFPROPSetupSnapshot
+{
+    std::string components;                             ///< The component string that was accepted by SETUP (or the path to the .MIX file)
+    bool predefined_mixture;                            ///< True if the fluids are loaded with SETMIX from a .MIX file
+    bool use_GERG;                                      ///< True if GERG04 was called before SETUP
+    int PR_flag;                                        ///< The flag passed to PREOS after SETUP
+    std::vector<REFPROPBinaryOverride> binary_overrides;  ///< The interaction parameters set by the user
+    std::string signature;  ///< Identifies the setup; instances with the same signature share the loaded setup without reloading
+    REFPROPSetupSnapshot() : predefined_mixture(false), use_GERG(false), PR_flag(0){};
+    /// Update the signature after one of the other fields has been changed
+    void update_signature();
+};
+
+/// Counters for the loading of fluids into REFPROP, shared by all the instances of the backend
+struct REFPROPSetupStatistics
+{
+    std::size_t setup_calls;  ///< The number of calls to SETUP or SETMIX, including the unsuccessful ones while the file endings are tried
+    std::size_t switches;     ///< The number of times a previously resolved setup of an instance had to be loaded again
+    std::size_t reuses;       ///< The number of times the loaded setup could be used as it is
+    REFPROPSetupStatistics() : setup_calls(0), switches(0), reuses(0){};
+};
+
 class REFPROPMixtureBackend : public AbstractState
 {
    private:
-    std::string cached_component_string;
+    REFPROPSetupSnapshot setup_snapshot;
+
+    /// Load the setup from the snapshot with a single call to SETUP (or SETMIX), followed by the calls that restore the modifications
+    void load_setup_snapshot();
+    /// Store an interaction parameter set that has been passed to SETKTV in the snapshot
+    void add_binary_override(int icomp, int jcomp, const char* hmodij, const double* fij, const char* hfmix);
 
    protected:
     std::size_t Ncomp;
@@ -57,6 +93,11 @@ class REFPROPMixtureBackend : public AbstractState
 
     static std::string version();
 
+    /// Get the counters for the loading of fluids into REFPROP
+    static REFPROPSetupStatistics setup_statistics();
+    /// Reset the counters for the loading of fluids into REFPROP
+    static void reset_setup_statistics();
+
     std::vector<std::string> calc_fluid_names() {
         return fluid_names;
     };
@@ -157,6 +198,11 @@ class REFPROPMixtureBackend : public AbstractState
 
     /// Set the fluids in REFPROP DLL by calling the SETUPdll function
     /**
+    If the setup of this instance is already loaded, nothing is done.  If the setup of this instance has been resolved before,
+    it is loaded again from the snapshot of the instance with a single call to SETUP, and the interaction parameters that
+    were modified are set again.  Otherwise the file endings are tried one after the other.
+
+    REFPROP only holds one setup at a time, so instances that are used in alternation still need one SETUP call for each switch.
     @param fluid_names The vector of strings of the fluid components, without file ending
     */
     void set_REFPROP_fluids(const std::vector<std::string>& fluid_names);
@@ -87,7 +87,8 @@ double CoolProp::BicubicBackend::evaluate_single_phase(const SinglePhaseGriddedT
     const CellCoeffs& cell = coeffs[i][j];
 
     // Get the alpha coefficients
-    const std::vector<double>& alpha = cell.get(output);
+    double alpha[16];
+    cell.get(output, alpha);
 
     // Normalized value in the range (0, 1)
     double xhat = (x - table.xvec[i]) / (table.xvec[i + 1] - table.xvec[i]);
@@ -136,7 +137,8 @@ double CoolProp::BicubicBackend::evaluate_single_phase_derivative(SinglePhaseGri
     CellCoeffs& cell = coeffs[i][j];
 
     // Get the alpha coefficients
-    const std::vector<double>& alpha = cell.get(output);
+    double alpha[16];
+    cell.get(output, alpha);
 
     // Normalized value in the range (0, 1)
     double xhat = (x - table.xvec[i]) / (table.xvec[i + 1] - table.xvec[i]);
@@ -186,7 +188,8 @@ void CoolProp::BicubicBackend::invert_single_phase_x(const SinglePhaseGriddedTab
     const CellCoeffs& cell = coeffs[i][j];
 
     // Get the alpha coefficients
-    const std::vector<double>& alpha = cell.get(other_key);
+    double alpha[16];
+    cell.get(other_key, alpha);
 
     // Normalized value in the range (0, 1)
     double yhat = (y - table.yvec[j]) / (table.yvec[j + 1] - table.yvec[j]);
@@ -242,7 +245,8 @@ void CoolProp::BicubicBackend::invert_single_phase_y(const SinglePhaseGriddedTab
     const CellCoeffs& cell = coeffs[i][j];
 
     // Get the alpha coefficients
-    const std::vector<double>& alpha = cell.get(other_key);
+    double alpha[16];
+    cell.get(other_key, alpha);
 
     // Normalized value in the range (0, 1)
     double xhat = (x - table.xvec[i]) / (table.xvec[i + 1] - table.xvec[i]);
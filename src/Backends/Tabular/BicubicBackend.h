@@ -67,10 +67,7 @@ class BicubicBackend : public TabularBackend
         // If a pure fluid or a predefined mixture, don't need to set fractions, go ahead and build
         if (!this->AS->get_mole_fractions().empty()) {
             check_tables();
-            SinglePhaseGriddedTableData& single_phase_logph = dataset->single_phase_logph;
-            SinglePhaseGriddedTableData& single_phase_logpT = dataset->single_phase_logpT;
-            dataset->build_coeffs(single_phase_logph, dataset->coeffs_ph);
-            dataset->build_coeffs(single_phase_logpT, dataset->coeffs_pT);
+            prepare_bicubic_storage();
             is_mixture = (this->AS->get_mole_fractions().size() > 1);
         }
     };
@@ -81,10 +78,7 @@ class BicubicBackend : public TabularBackend
         check_tables();
         // For mixtures, the construction of the coefficients is delayed until this
         // function so that the set_mole_fractions function can be called
-        SinglePhaseGriddedTableData& single_phase_logph = dataset->single_phase_logph;
-        SinglePhaseGriddedTableData& single_phase_logpT = dataset->single_phase_logpT;
-        dataset->build_coeffs(single_phase_logph, dataset->coeffs_ph);
-        dataset->build_coeffs(single_phase_logpT, dataset->coeffs_pT);
+        prepare_bicubic_storage();
     };
     std::string backend_name(void) {
         return get_backend_string(BICUBIC_BACKEND);
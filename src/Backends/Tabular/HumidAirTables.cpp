@@ -0,0 +1,184 @@
+#if !defined(NO_TABULAR_BACKENDS)
+
+#    include "HumidAirTables.h"
+#    include "CPfilepaths.h"
+#    include "Solvers.h"
+#    include <ctime>
+#    include <limits>
+
+namespace {
+
+/// The triple point temperature of water [K]; saturation is over ice below it and over liquid water above it
+const double T_triple_water = 273.16;
+
+/// The index of the node at the triple point of water, or NT if there is none
+std::size_t triple_point_node(double Tmin, double Tmax, std::size_t NT) {
+    double t = (T_triple_water - Tmin) / (Tmax - Tmin) * static_cast<double>(NT - 1);
+    double j = floor(t + 0.5);
+    if (j < 0 || j > static_cast<double>(NT - 1) || std::abs(t - j) > 1e-8) {
+        return NT;
+    }
+    return static_cast<std::size_t>(j);
+}
+
+/**
+ * @brief Solve f(x) = 0 for x on a regularly spaced axis, for f monotonic in x
+ *
+ * The nodes that bracket the solution are found by bisection, and the solution within the bracket with Brent's method
+ */
+bool solve_on_axis(CoolProp::FuncWrapper1D& f, double xmin, double xmax, std::size_t N, double& x) {
+    double dx = (xmax - xmin) / static_cast<double>(N - 1);
+    std::size_t L = 0, R = N - 1;
+    double fL = f.call(xmin), fR = f.call(xmax);
+    if (!ValidNumber(fL) || !ValidNumber(fR) || fL * fR > 0) {
+        return false;
+    }
+    while (R - L > 1) {
+        std::size_t M = (L + R) / 2;
+        double fM = f.call(xmin + dx * static_cast<double>(M));
+        if (!ValidNumber(fM)) {
+            return false;
+        }
+        if (fM * fL > 0) {
+            L = M;
+            fL = fM;
+        } else {
+            R = M;
+        }
+    }
+    try {
+        x = CoolProp::Brent(f, xmin + dx * static_cast<double>(L), xmin + dx * static_cast<double>(R), DBL_EPSILON, 1e-10 * dx, 50);
+    } catch (...) {
+        return false;
+    }
+    return ValidNumber(x);
+}
+
+class HumidAirTableResidual : public CoolProp::FuncWrapper1D
+{
+   public:
+    const CoolProp::HumidAirTableData& table;
+    const std::vector<double>& values;
+    double p, T, W, target;
+    /// 'T' to vary the temperature, 'W' to vary the humidity ratio, or 'S' to vary the temperature on a surface
+    char variable;
+    HumidAirTableResidual(const CoolProp::HumidAirTableData& table, const std::vector<double>& values, double p, double T, double W, double target,
+                          char variable)
+      : table(table), values(values), p(p), T(T), W(W), target(target), variable(variable){};
+    double call(double x) {
+        double y;
+        if (variable == 'T') {
+            y = table.evaluate(values, p, x, W);
+        } else if (variable == 'W') {
+            y = table.evaluate(values, p, T, x);
+        } else {
+            y = table.evaluate_surface(values, p, x);
+        }
+        return y - target;
+    }
+};
+
+}  // namespace
+
+void CoolProp::HumidAirTableData::build(property_function f) {
+    const bool debug = get_debug_level() > 5 || false;
+    clock_t t1 = clock();
+    std::vector<double> pvec = logspace(pmin, pmax, Np), Tvec = linspace(Tmin, Tmax, NT), Wvec = linspace(Wmin, Wmax, NW);
+#    define X(name, key) name.assign(Np * NT * NW, _HUGE);
+    LIST_OF_HUMID_AIR_MATRICES
+#    undef X
+#    define X(name) name.assign(Np * NT, _HUGE);
+    LIST_OF_HUMID_AIR_SURFACES
+#    undef X
+    for (std::size_t i = 0; i < Np; ++i) {
+        for (std::size_t j = 0; j < NT; ++j) {
+            psi_w_sat[i * NT + j] = f("Y", pvec[i], Tvec[j], "R", 1.0);
+            for (std::size_t k = 0; k < NW; ++k) {
+                std::size_t n = (i * NT + j) * NW + k;
+#    define X(name, key) name[n] = f(key, pvec[i], Tvec[j], "W", Wvec[k]);
+                LIST_OF_HUMID_AIR_MATRICES
+#    undef X
+            }
+        }
+        if (debug) {
+            std::cout << format("Humid air tables: %d/%d pressures done\n", i + 1, Np);
+        }
+    }
+    if (debug) {
+        std::cout << format("Built humid air tables in %g sec.\n", static_cast<double>(clock() - t1) / CLOCKS_PER_SEC);
+    }
+}
+
+void CoolProp::HumidAirTableData::load(const std::string& path_to_tables) {
+    std::string path_to_table = path_to_tables + "/humid_air.bin.z";
+    std::vector<char> charbuffer = read_packed_table(path_to_table);
+    try {
+        msgpack::unpacked msg;
+        msgpack::unpack(msg, &(charbuffer[0]), charbuffer.size());
+        msgpack::object deserialized = msg.get();
+        deserialize(deserialized);
+    } catch (std::exception& e) {
+        throw UnableToLoadError(format("Unable to msgpack deserialize %s; err: %s", path_to_table.c_str(), e.what()));
+    }
+}
+
+void CoolProp::HumidAirTableData::write(const std::string& path_to_tables) {
+    make_dirs(path_to_tables);
+    pack();
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, *this);
+    vectors.clear();
+    write_packed_table(sbuf, path_to_tables, "humid_air");
+}
+
+double CoolProp::HumidAirTableData::evaluate(const std::vector<double>& matrix, double p, double T, double W) const {
+    std::size_t i0, j0, k0;
+    double wp[4], wT[4], wW[4];
+    if (!cubic_stencil(log(p / pmin) / log(pmax / pmin) * static_cast<double>(Np - 1), Np, Np, i0, wp)
+        || !cubic_stencil((T - Tmin) / (Tmax - Tmin) * static_cast<double>(NT - 1), NT, NT, j0, wT)
+        || !cubic_stencil((W - Wmin) / (Wmax - Wmin) * static_cast<double>(NW - 1), NW, NW, k0, wW)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    double y = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+            const double* node = &matrix[((i0 + i) * NT + j0 + j) * NW + k0];
+            double yW = wW[0] * node[0] + wW[1] * node[1] + wW[2] * node[2] + wW[3] * node[3];
+            y += wp[i] * wT[j] * yW;
+        }
+    }
+    // NaN at any of the nodes propagates into y
+    return ValidNumber(y) ? y : std::numeric_limits<double>::quiet_NaN();
+}
+
+double CoolProp::HumidAirTableData::evaluate_surface(const std::vector<double>& surface, double p, double T) const {
+    std::size_t i0, j0;
+    double wp[4], wT[4];
+    if (!cubic_stencil(log(p / pmin) / log(pmax / pmin) * static_cast<double>(Np - 1), Np, Np, i0, wp)
+        || !cubic_stencil((T - Tmin) / (Tmax - Tmin) * static_cast<double>(NT - 1), NT, triple_point_node(Tmin, Tmax, NT), j0, wT)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    double y = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+        const double* node = &surface[(i0 + i) * NT + j0];
+        y += wp[i] * (wT[0] * node[0] + wT[1] * node[1] + wT[2] * node[2] + wT[3] * node[3]);
+    }
+    return ValidNumber(y) ? y : std::numeric_limits<double>::quiet_NaN();
+}
+
+bool CoolProp::HumidAirTableData::solve_for_T(const std::vector<double>& matrix, double p, double W, double value, double& T) const {
+    HumidAirTableResidual resid(*this, matrix, p, _HUGE, W, value, 'T');
+    return solve_on_axis(resid, Tmin, Tmax, NT, T);
+}
+
+bool CoolProp::HumidAirTableData::solve_for_W(const std::vector<double>& matrix, double p, double T, double value, double& W) const {
+    HumidAirTableResidual resid(*this, matrix, p, T, _HUGE, value, 'W');
+    return solve_on_axis(resid, Wmin, Wmax, NW, W);
+}
+
+bool CoolProp::HumidAirTableData::solve_surface_for_T(const std::vector<double>& surface, double p, double value, double& T) const {
+    HumidAirTableResidual resid(*this, surface, p, _HUGE, _HUGE, value, 'S');
+    return solve_on_axis(resid, Tmin, Tmax, NT, T);
+}
+
+#endif  // !defined(NO_TABULAR_BACKENDS)
@@ -0,0 +1,139 @@
+#ifndef HUMIDAIR_TABLES_H
+#define HUMIDAIR_TABLES_H
+
+#include "TabularBackends.h"
+
+/** ***MAGIC WARNING***!! X Macros in use
+ * The properties of humid air that are tabulated in (p, T, W), and the names of the outputs of HAPropsSI that they hold
+ */
+#define LIST_OF_HUMID_AIR_MATRICES \
+    X(hda, "H")                    \
+    X(sda, "S")                    \
+    X(vda, "V")                    \
+    X(cpda, "C")                   \
+    X(Twb, "B")                    \
+    X(visc, "M")                   \
+    X(cond, "K")                   \
+    X(Z, "Z")
+
+/** ***MAGIC WARNING***!! X Macros in use
+ * The saturation surfaces of humid air that are tabulated in (p, T); psi_w_sat is the mole fraction of water in saturated
+ * humid air, the output "Y" of HAPropsSI at R = 1
+ */
+#define LIST_OF_HUMID_AIR_SURFACES X(psi_w_sat)
+
+namespace CoolProp {
+
+/** \brief This class holds the tables of the properties of humid air, regularly spaced in log(p), T and W
+ *
+ * The values are interpolated with (tri)cubic Lagrange polynomials through the 4 (x 4 x 4) nodes around the point.  The
+ * temperature grid has a node at the triple point of water, and the saturation surfaces are never interpolated across it
+ * because saturation over ice and over liquid water have different slopes there.
+ *
+ * Nodes where a property could not be calculated hold NaN; interpolations that need such a node, or that are outside
+ * the tables, return NaN so that the caller can fall back to the full calculation.
+ */
+class HumidAirTableData
+{
+   public:
+    std::size_t Np, NT, NW;
+    double pmin, pmax, Tmin, Tmax, Wmin, Wmax;
+    int revision;
+
+    /// Calculates an output of HAPropsSI at the given pressure and temperature and a third input, without the tables and without
+    /// checking the limits of the inputs (the nodes also cover supersaturated states); NaN if it fails
+    typedef double (*property_function)(const std::string& output, double p, double T, const std::string& input, double value);
+
+    HumidAirTableData() {
+        // 2 K steps in T, with a node at the triple point of water
+        Np = 12;
+        NT = 76;
+        NW = 61;
+        pmin = 50000;
+        pmax = 200000;
+        Tmin = 223.16;
+        Tmax = 373.16;
+        Wmin = 0;
+        Wmax = 0.15;
+        revision = 0;
+    }
+
+/* Use X macros to auto-generate the variables; the nodes are stored at [(i*NT + j)*NW + k] for p_i, T_j and W_k */
+#define X(name, key) std::vector<double> name;
+    LIST_OF_HUMID_AIR_MATRICES
+#undef X
+/* Use X macros to auto-generate the variables; the nodes are stored at [i*NT + j] for p_i and T_j */
+#define X(name) std::vector<double> name;
+    LIST_OF_HUMID_AIR_SURFACES
+#undef X
+    std::map<std::string, std::vector<double>> vectors;
+
+    MSGPACK_DEFINE(revision, vectors, Np, NT, NW, pmin, pmax, Tmin, Tmax, Wmin, Wmax);  // write the member variables that you want to pack
+
+    /// Build the tables with the given function
+    void build(property_function f);
+    /// Take all the vectors that are in the class and pack them into the vectors map for easy unpacking using msgpack
+    void pack() {
+#define X(name, key) vectors.insert(std::pair<std::string, std::vector<double>>(#name, name));
+        LIST_OF_HUMID_AIR_MATRICES
+#undef X
+#define X(name) vectors.insert(std::pair<std::string, std::vector<double>>(#name, name));
+        LIST_OF_HUMID_AIR_SURFACES
+#undef X
+    };
+    std::map<std::string, std::vector<double>>::iterator get_vector_iterator(const std::string& name) {
+        std::map<std::string, std::vector<double>>::iterator it = vectors.find(name);
+        if (it == vectors.end()) {
+            throw UnableToLoadError(format("could not find vector %s", name.c_str()));
+        }
+        return it;
+    }
+    /// Take all the vectors that are in the class and unpack them from the vectors map
+    void unpack() {
+#define X(name, key) name = get_vector_iterator(#name)->second;
+        LIST_OF_HUMID_AIR_MATRICES
+#undef X
+#define X(name) name = get_vector_iterator(#name)->second;
+        LIST_OF_HUMID_AIR_SURFACES
+#undef X
+        vectors.clear();
+    };
+    void deserialize(msgpack::object& deserialized) {
+        HumidAirTableData temp;
+        deserialized.convert(temp);
+        temp.unpack();
+        if (Np != temp.Np || NT != temp.NT || NW != temp.NW) {
+            throw ValueError(format("old [%dx%dx%d] and new [%dx%dx%d] dimensions don't agree", temp.Np, temp.NT, temp.NW, Np, NT, NW));
+        } else if (revision > temp.revision) {
+            throw ValueError(format("loaded revision [%d] is older than current revision [%d]", temp.revision, revision));
+        } else if (pmin != temp.pmin || pmax != temp.pmax || Tmin != temp.Tmin || Tmax != temp.Tmax || Wmin != temp.Wmin || Wmax != temp.Wmax) {
+            throw ValueError("Current limits of the humid air tables do not agree with the loaded limits");
+        } else if (temp.hda.size() != Np * NT * NW || temp.psi_w_sat.size() != Np * NT) {
+            throw ValueError("The loaded humid air tables have the wrong number of nodes");
+        }
+        std::swap(*this, temp);
+    };
+    /// Load the tables from path_to_tables; throws UnableToLoadError if there is a problem
+    void load(const std::string& path_to_tables);
+    /// Write the tables to path_to_tables
+    void write(const std::string& path_to_tables);
+
+    /// Check whether the point is within the tables
+    bool in_range(double p, double T, double W) const {
+        return p >= pmin && p <= pmax && T >= Tmin && T <= Tmax && W >= Wmin && W <= Wmax;
+    }
+    /// Interpolate a matrix (one of LIST_OF_HUMID_AIR_MATRICES) at (p, T, W)
+    double evaluate(const std::vector<double>& matrix, double p, double T, double W) const;
+    /// Interpolate a surface (one of LIST_OF_HUMID_AIR_SURFACES) at (p, T)
+    double evaluate_surface(const std::vector<double>& surface, double p, double T) const;
+    /// Find T such that matrix(p, T, W) = value; the matrix must be monotonic in T.  Returns false if there is no solution in the tables
+    bool solve_for_T(const std::vector<double>& matrix, double p, double W, double value, double& T) const;
+    /// Find W such that matrix(p, T, W) = value; the matrix must be monotonic in W.  Returns false if there is no solution in the tables
+    bool solve_for_W(const std::vector<double>& matrix, double p, double T, double value, double& W) const;
+    /// Find T such that surface(p, T) = value; the surface must be monotonic in T.  Returns false if there is no solution in the tables
+    bool solve_surface_for_T(const std::vector<double>& surface, double p, double value, double& T) const;
+};
+
+} /* namespace CoolProp */
+
+#endif
@@ -18,10 +18,7 @@ class TTSEBackend : public TabularBackend
         // If a pure fluid or a predefined mixture, don't need to set fractions, go ahead and build
         if (!this->AS->get_mole_fractions().empty()) {
             check_tables();
-            SinglePhaseGriddedTableData& single_phase_logph = dataset->single_phase_logph;
-            SinglePhaseGriddedTableData& single_phase_logpT = dataset->single_phase_logpT;
-            dataset->build_coeffs(single_phase_logph, dataset->coeffs_ph);
-            dataset->build_coeffs(single_phase_logpT, dataset->coeffs_pT);
+            prepare_TTSE_storage();
             is_mixture = (this->AS->get_mole_fractions().size() > 1);
         }
     }
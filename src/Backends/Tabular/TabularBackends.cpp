@@ -3,10 +3,13 @@
 
 #    include "TabularBackends.h"
 #    include "CoolProp.h"
+#    include "Backends/Helmholtz/HelmholtzEOSMixtureBackend.h"
 #    include <sstream>
 #    include "time.h"
 #    include "miniz.h"
 #    include <fstream>
+#    include <cstdio>
+#    include <algorithm>
 
 /// The inverse of the A matrix for the bicubic interpolation (http://en.wikipedia.org/wiki/Bicubic_interpolation)
 /// NOTE: The matrix is transposed below
@@ -24,20 +27,7 @@ static CoolProp::TabularDataLibrary library;
 
 namespace CoolProp {
 
-/**
- * @brief
- * @param table
- * @param path_to_tables
- * @param filename
- */
-template <typename T>
-void load_table(T& table, const std::string& path_to_tables, const std::string& filename) {
-
-    double tic = clock();
-    std::string path_to_table = path_to_tables + "/" + filename;
-    if (get_debug_level() > 0) {
-        std::cout << format("Loading table: %s", path_to_table.c_str()) << std::endl;
-    }
+std::vector<char> read_packed_table(const std::string& path_to_table) {
     std::vector<char> raw;
     try {
         raw = get_binary_file_contents(path_to_table.c_str());
@@ -67,7 +57,64 @@ void load_table(T& table, const std::string& path_to_tables, const std::string&
         }
     } while (code != 0);
     // Copy the buffer from unsigned char to char (yuck)
-    std::vector<char> charbuffer(newBuffer.begin(), newBuffer.begin() + newBufferSize);
+    return std::vector<char>(newBuffer.begin(), newBuffer.begin() + newBufferSize);
+}
+
+void write_packed_table(const msgpack::sbuffer& sbuf, const std::string& path_to_tables, const std::string& name) {
+    std::string tabPath = std::string(path_to_tables + "/" + name + ".bin");
+    std::string zPath = tabPath + ".z";
+    std::vector<char> buffer(sbuf.size());
+    uLong outSize = static_cast<uLong>(buffer.size());
+    compress((unsigned char*)(&(buffer[0])), &outSize, (unsigned char*)(sbuf.data()), static_cast<mz_ulong>(sbuf.size()));
+    std::ofstream ofs2(zPath.c_str(), std::ofstream::binary);
+    ofs2.write(&buffer[0], outSize);
+    ofs2.close();
+
+    if (CoolProp::get_config_bool(SAVE_RAW_TABLES)) {
+        std::ofstream ofs(tabPath.c_str(), std::ofstream::binary);
+        ofs.write(sbuf.data(), sbuf.size());
+    }
+}
+
+bool cubic_stencil(double t, std::size_t N, std::size_t ibreak, std::size_t& i0, double w[4]) {
+    if (!(t >= 0 && t <= static_cast<double>(N - 1)) || N < 4) {
+        return false;  // Also if t is NaN
+    }
+    // The interval [i, i+1] that contains t, and the stencil centered on it as far as the ends of the axis allow
+    long i = std::min(static_cast<long>(t), static_cast<long>(N) - 2);
+    long first = std::max(0L, std::min(i - 1, static_cast<long>(N) - 4));
+    long b = static_cast<long>(ibreak);
+    if (ibreak < N) {
+        if (i + 1 <= b && b >= 3) {
+            first = std::min(first, b - 3);
+        } else if (i >= b && b <= static_cast<long>(N) - 4) {
+            first = std::max(first, b);
+        }
+    }
+    i0 = static_cast<std::size_t>(first);
+    double s = t - static_cast<double>(first);
+    w[0] = -(s - 1) * (s - 2) * (s - 3) / 6;
+    w[1] = s * (s - 2) * (s - 3) / 2;
+    w[2] = -s * (s - 1) * (s - 3) / 2;
+    w[3] = s * (s - 1) * (s - 2) / 6;
+    return true;
+}
+
+/**
+ * @brief
+ * @param table
+ * @param path_to_tables
+ * @param filename
+ */
+template <typename T>
+void load_table(T& table, const std::string& path_to_tables, const std::string& filename) {
+
+    double tic = clock();
+    std::string path_to_table = path_to_tables + "/" + filename;
+    if (get_debug_level() > 0) {
+        std::cout << format("Loading table: %s", path_to_table.c_str()) << std::endl;
+    }
+    std::vector<char> charbuffer = read_packed_table(path_to_table);
     try {
         msgpack::unpacked msg;
         msgpack::unpack(msg, &(charbuffer[0]), charbuffer.size());
@@ -91,19 +138,84 @@ template <typename T>
 void write_table(const T& table, const std::string& path_to_tables, const std::string& name) {
     msgpack::sbuffer sbuf;
     msgpack::pack(sbuf, table);
-    std::string tabPath = std::string(path_to_tables + "/" + name + ".bin");
-    std::string zPath = tabPath + ".z";
-    std::vector<char> buffer(sbuf.size());
-    uLong outSize = static_cast<uLong>(buffer.size());
-    compress((unsigned char*)(&(buffer[0])), &outSize, (unsigned char*)(sbuf.data()), static_cast<mz_ulong>(sbuf.size()));
-    std::ofstream ofs2(zPath.c_str(), std::ofstream::binary);
-    ofs2.write(&buffer[0], outSize);
-    ofs2.close();
+    write_packed_table(sbuf, path_to_tables, name);
+}
 
-    if (CoolProp::get_config_bool(SAVE_RAW_TABLES)) {
-        std::ofstream ofs(tabPath.c_str(), std::ofstream::binary);
-        ofs.write(sbuf.data(), sbuf.size());
+void get_table_limits(AbstractState& AS, CoolPropDbl& Tmin, CoolPropDbl& Tmax, CoolPropDbl& pmax) {
+    if (AS.has_limits_of_validity()) {
+        Tmin = std::max(AS.Ttriple(), AS.Tmin());
+        Tmax = AS.Tmax();
+        pmax = AS.pmax();
+        return;
+    }
+    // The pseudo-critical point of the mixture, or the critical point of a pure fluid
+    const std::vector<CoolPropDbl>& z = AS.get_mole_fractions();
+    if (z.empty()) {
+        throw ValueError("Mole fractions must be set before the limits of the tables can be determined");
+    }
+    CoolPropDbl Tc = 0, pc = 0;
+    for (std::size_t i = 0; i < z.size(); ++i) {
+        Tc += z[i] * AS.get_fluid_constant(i, iT_critical);
+        pc += z[i] * AS.get_fluid_constant(i, iP_critical);
+    }
+    // The reduced temperatures and pressures over which the cubic equations of state are generally used
+    Tmin = 0.4 * Tc;
+    Tmax = 2.0 * Tc;
+    pmax = 10.0 * pc;
+}
+
+static TableBuildProgressCallback table_build_progress_callback = NULL;
+
+void set_table_build_progress_callback(TableBuildProgressCallback callback) {
+    table_build_progress_callback = callback;
+}
+
+/// The value of the bicubic polynomial with coefficients a at (xhat, yhat)
+static double bicubic_value(const double a[16], double xhat, double yhat) {
+    double val = 0;
+    for (int m = 3; m >= 0; --m) {
+        val = val * yhat + (((a[m * 4 + 3] * xhat + a[m * 4 + 2]) * xhat + a[m * 4 + 1]) * xhat + a[m * 4 + 0]);
     }
+    return val;
+}
+
+/// Convert the coefficients of the cells of a table to single precision, and return the largest error at the corners of the cells relative
+/// to the largest magnitude of the property in the table
+static double convert_cells_to_float32(const SinglePhaseGriddedTableData& table, std::vector<std::vector<CellCoeffs>>& coeffs) {
+    const int param_count = 6;
+    const parameters param_list[param_count] = {iDmolar, iT, iSmolar, iHmolar, iP, iUmolar};
+    double max_value[param_count] = {0, 0, 0, 0, 0, 0}, max_error[param_count] = {0, 0, 0, 0, 0, 0};
+    double a64[param_count][16], a32[16];
+    for (std::size_t i = 0; i < coeffs.size(); ++i) {
+        for (std::size_t j = 0; j < coeffs[i].size(); ++j) {
+            CellCoeffs& cell = coeffs[i][j];
+            for (int k = 0; k < param_count; ++k) {
+                if (cell.has(param_list[k])) {
+                    cell.get(param_list[k], a64[k]);
+                }
+            }
+            cell.convert_to_float32();
+            for (int k = 0; k < param_count; ++k) {
+                if (!cell.valid() || !cell.has(param_list[k])) {
+                    continue;
+                }
+                cell.get(param_list[k], a32);
+                for (int corner = 0; corner < 4; ++corner) {
+                    double xhat = corner % 2, yhat = corner / 2;
+                    double v64 = bicubic_value(a64[k], xhat, yhat), v32 = bicubic_value(a32, xhat, yhat);
+                    max_value[k] = std::max(max_value[k], std::abs(v64));
+                    max_error[k] = std::max(max_error[k], std::abs(v32 - v64));
+                }
+            }
+        }
+    }
+    double worst = 0;
+    for (int k = 0; k < param_count; ++k) {
+        if (max_value[k] > 0) {
+            worst = std::max(worst, max_error[k] / max_value[k]);
+        }
+    }
+    return worst;
 }
 
 }  // namespace CoolProp
@@ -119,7 +231,8 @@ void CoolProp::PureFluidSaturationTableData::build(shared_ptr<CoolProp::Abstract
     // ------------------------
     // Actually build the table
     // ------------------------
-    CoolPropDbl Tmin = std::max(AS->Ttriple(), AS->Tmin());
+    CoolPropDbl Tmin, Tmax, pmax_table;
+    get_table_limits(*AS, Tmin, Tmax, pmax_table);
     AS->update(QT_INPUTS, 0, Tmin);
     CoolPropDbl p_triple = AS->p();
     CoolPropDbl p, pmin = p_triple, pmax = 0.9999 * AS->p_critical();
@@ -197,7 +310,12 @@ void CoolProp::PureFluidSaturationTableData::build(shared_ptr<CoolProp::Abstract
         }
     }
     // Last point is at the critical point
-    AS->update(PQ_INPUTS, AS->p_critical(), 1);
+    try {
+        AS->update(PQ_INPUTS, AS->p_critical(), 1);
+    } catch (std::exception&) {
+        // The saturation solvers of the cubic backends do not converge at the critical point itself
+        AS->update(PT_INPUTS, AS->p_critical(), AS->T_critical());
+    }
     std::size_t i = N - 1;
 
     pV[i] = AS->p();
@@ -219,10 +337,210 @@ void CoolProp::PureFluidSaturationTableData::build(shared_ptr<CoolProp::Abstract
 
     logpL[i] = log(AS->p());
     logrhomolarL[i] = log(rhomolarL[i]);
+
+    prepare_interpolation();
+}
+
+void CoolProp::SaturationCubics::build(const std::vector<double>& x, const std::vector<double>& y) {
+    std::size_t N = x.size();
+    a.assign((N > 3) ? 4 * (N - 3) : 0, _HUGE);
+    for (std::size_t i0 = 0; i0 + 3 < N; ++i0) {
+        double u[4], d[4];
+        bool valid = true;
+        for (std::size_t k = 0; k < 4; ++k) {
+            u[k] = x[i0 + k] - x[i0 + 2];
+            d[k] = y[i0 + k];
+            valid = valid && ValidNumber(x[i0 + k]) && ValidNumber(y[i0 + k]);
+        }
+        if (!valid) {
+            continue;
+        }
+        // Divided differences of the Newton form d0 + d1*(t-u0) + d2*(t-u0)*(t-u1) + d3*(t-u0)*(t-u1)*(t-u2)
+        for (std::size_t k = 1; k < 4; ++k) {
+            for (std::size_t m = 3; m >= k; --m) {
+                d[m] = (d[m] - d[m - 1]) / (u[m] - u[m - k]);
+            }
+        }
+        // Expand the Newton form in powers of t
+        double* c = &(a[4 * i0]);
+        double basis[4] = {1, 0, 0, 0};
+        c[0] = d[0];
+        c[1] = c[2] = c[3] = 0;
+        for (std::size_t k = 1; k < 4; ++k) {
+            for (std::size_t m = k; m > 0; --m) {
+                basis[m] = basis[m - 1] - u[k - 1] * basis[m];
+            }
+            basis[0] *= -u[k - 1];
+            for (std::size_t m = 0; m <= k; ++m) {
+                c[m] += d[k] * basis[m];
+            }
+        }
+    }
+}
+
+void CoolProp::PureFluidSaturationTableData::prepare_interpolation() {
+    if (TL.size() < 4) {
+        return;
+    }
+    // The properties, in the order of saturation_property, that are interpolated in log(p) and in T
+    const std::vector<double>* in_logp[2][isat_count] = {
+      {&TL, &logpL, &hmolarL, &smolarL, &umolarL, &rhomolarL, &logrhomolarL, &condL, &logviscL, &cpmolarL, &cvmolarL, &speed_soundL},
+      {&TV, &logpV, &hmolarV, &smolarV, &umolarV, &rhomolarV, &logrhomolarV, &condV, &logviscV, &cpmolarV, &cvmolarV, &speed_soundV}};
+    for (int Q = 0; Q < 2; ++Q) {
+        const std::vector<double>& logp = (Q == 0) ? logpL : logpV;
+        const std::vector<double>& T = (Q == 0) ? TL : TV;
+        for (int k = 0; k < isat_count; ++k) {
+            // Only the caloric properties and the pressure are needed in terms of T
+            bool needed_in_T = (k <= isat_rhomolar);
+            cubics[Q][0][k].build(logp, *in_logp[Q][k]);
+            if (needed_in_T) {
+                cubics[Q][1][k].build(T, *in_logp[Q][k]);
+            } else {
+                cubics[Q][1][k].a.clear();
+            }
+        }
+    }
+
+    // The table is built uniformly spaced in log(p) up to the node before the critical point, which then needs no bisection
+    dlogp = (logpL[N - 2] - logpL[0]) / (N - 2);
+    logp_first = logpL[0];
+    for (std::size_t i = 0; i + 1 < N; ++i) {
+        double logp = logp_first + dlogp * i;
+        if (!ValidNumber(logpL[i]) || !ValidNumber(logpV[i]) || std::abs(logpL[i] - logp) > 1e-9 * std::abs(logp)
+            || std::abs(logpV[i] - logp) > 1e-9 * std::abs(logp)) {
+            dlogp = 0;
+            break;
+        }
+    }
+    if (!(dlogp > 0)) {
+        dlogp = 0;
+    }
+
+    // T is not uniformly spaced, so index the nodes with a uniform grid in T
+    for (int Q = 0; Q < 2; ++Q) {
+        const std::vector<double>& T = (Q == 0) ? TL : TV;
+        T_index[Q].clear();
+        bool increasing = ValidNumber(T[0]);
+        for (std::size_t i = 1; i < N && increasing; ++i) {
+            increasing = ValidNumber(T[i]) && T[i] > T[i - 1];
+        }
+        if (!increasing) {
+            continue;
+        }
+        T_first[Q] = T[0];
+        dT[Q] = (T[N - 1] - T[0]) / (N - 1);
+        T_index[Q].resize(N);
+        std::size_t i = 0;
+        for (std::size_t b = 0; b < N; ++b) {
+            double Tb = T_first[Q] + dT[Q] * b;
+            while (i + 2 < N && T[i + 1] <= Tb) {
+                i++;
+            }
+            T_index[Q][b] = i;
+        }
+    }
+}
+
+/// The saturation limits of an isobar that is used for the continuation along the isobar in SinglePhaseGriddedTableData::build
+struct IsobarSaturationLimits
+{
+    bool split;                  ///< True if the isobar crosses the saturation curve at xL (bubble) and xV (dew)
+    CoolPropDbl xL, xV,          ///< The x-variable of the table at the saturated liquid and vapor
+      rhomolarL, rhomolarV;      ///< The densities of the saturated liquid and vapor
+    IsobarSaturationLimits() : split(false), xL(_HUGE), xV(_HUGE), rhomolarL(_HUGE), rhomolarV(_HUGE){};
+    /// The region of the value of the x-variable: -1 for liquid, 1 for vapor, 2 if the isobar is not split, 0 if two-phase or on the boundary
+    int region(CoolPropDbl x) const {
+        if (!split) {
+            return 2;
+        } else if (x < xL) {
+            return -1;
+        } else if (x > xV) {
+            return 1;
+        } else {
+            return 0;
+        }
+    };
+};
+
+/// Find the saturation limits of the isobar; returns false if they cannot be found, in which case each node must be calculated on its own
+static bool isobar_saturation_limits(CoolProp::AbstractState& AS, CoolProp::parameters xkey, CoolPropDbl p, IsobarSaturationLimits& limits) {
+    try {
+        if (p > AS.p_critical()) {
+            // Supercritical isobar, no phase boundary to cross
+            limits.split = false;
+            return true;
+        }
+        AS.update(CoolProp::PQ_INPUTS, p, 0);
+        limits.xL = AS.keyed_output(xkey);
+        limits.rhomolarL = AS.rhomolar();
+        AS.update(CoolProp::PQ_INPUTS, p, 1);
+        limits.xV = AS.keyed_output(xkey);
+        limits.rhomolarV = AS.rhomolar();
+        limits.split = true;
+        return ValidNumber(limits.xL) && ValidNumber(limits.xV);
+    } catch (...) {
+        return false;
+    }
+}
+
+/**
+ * @brief Calculate the state at the next node of an isobar, starting from the state at the previous node in the same region
+ *
+ * The density at (T,p) is solved directly with HelmholtzEOSMixtureBackend::solver_rho_Tp, starting from the density of the
+ * previous node, and the state is set with update_DmolarT_direct; the phase determination of the PT flash is skipped since
+ * the region is already known.  For x = T this is one density solve.  For x = h, the temperature is found with Newton's
+ * method, starting from the linear extrapolation with the isobaric heat capacity of the previous node, with one density
+ * solve per step.  Returns false if the state could not be found or if it ended up in another region than the one of the
+ * node, in which case the node is calculated with the normal flash.  Throws NotImplementedError if AS is not a HEOS backend.
+ */
+static bool continue_isobar(CoolProp::AbstractState& AS, CoolProp::parameters xkey, CoolPropDbl x, CoolPropDbl p, int region,
+                            const IsobarSaturationLimits& limits, CoolPropDbl T_last, CoolPropDbl rhomolar_last, CoolPropDbl x_last,
+                            CoolPropDbl cpmolar_last, CoolPropDbl Tmin, CoolPropDbl Tmax) {
+    CoolProp::HelmholtzEOSMixtureBackend* HEOS = dynamic_cast<CoolProp::HelmholtzEOSMixtureBackend*>(&AS);
+    if (HEOS == NULL) {
+        throw CoolProp::NotImplementedError("The continuation along the isobars is only implemented for the HEOS backend");
+    }
+    if (xkey == CoolProp::iT) {
+        HEOS->update_DmolarT_direct(HEOS->solver_rho_Tp(x, p, rhomolar_last), x);
+    } else {
+        CoolPropDbl T = T_last + (x - x_last) / cpmolar_last;
+        CoolPropDbl rhomolar = rhomolar_last;
+        bool converged = false;
+        for (int iter = 0; iter < 30; ++iter) {
+            if (!ValidNumber(T) || T < Tmin || T > Tmax) {
+                return false;
+            }
+            rhomolar = HEOS->solver_rho_Tp(T, p, rhomolar);
+            HEOS->update_DmolarT_direct(rhomolar, T);
+            CoolPropDbl dT = -(HEOS->hmolar() - x) / HEOS->cpmolar();
+            if (std::abs(dT) < HEOS->solver_tolerance(1e-12) * T) {
+                converged = true;
+                break;
+            }
+            T += dT;
+        }
+        if (!converged) {
+            return false;
+        }
+    }
+    // Make sure that the density is on the correct side of the saturation curve
+    CoolPropDbl rho = AS.rhomolar();
+    if (!ValidNumber(rho) || rho <= 0) {
+        return false;
+    } else if (region == -1 && rho < limits.rhomolarL) {
+        return false;
+    } else if (region == 1 && rho > limits.rhomolarV) {
+        return false;
+    }
+    return true;
 }
 
 void CoolProp::SinglePhaseGriddedTableData::build(shared_ptr<CoolProp::AbstractState>& AS) {
-    CoolPropDbl x, y;
+    build(AS, "", "", false);
+}
+
+void CoolProp::SinglePhaseGriddedTableData::build(shared_ptr<CoolProp::AbstractState>& AS, const std::string& path_to_tables,
+                                                   const std::string& name, bool lazy) {
     const bool debug = get_debug_level() > 5 || false;
 
     resize(Nx, Ny);
@@ -232,62 +550,195 @@ void CoolProp::SinglePhaseGriddedTableData::build(shared_ptr<CoolProp::AbstractS
         std::cout << format(" Single-Phase Table (%s) \n", strjoin(AS->fluid_names(), "&").c_str());
         std::cout << format("***********************************************\n");
     }
-    // ------------------------
-    // Actually build the table
-    // ------------------------
     for (std::size_t i = 0; i < Nx; ++i) {
         // Calculate the x value
         if (logx) {
             // Log spaced
-            x = exp(log(xmin) + (log(xmax) - log(xmin)) / (Nx - 1) * i);
+            xvec[i] = exp(log(xmin) + (log(xmax) - log(xmin)) / (Nx - 1) * i);
         } else {
             // Linearly spaced
-            x = xmin + (xmax - xmin) / (Nx - 1) * i;
+            xvec[i] = xmin + (xmax - xmin) / (Nx - 1) * i;
         }
-        xvec[i] = x;
-        for (std::size_t j = 0; j < Ny; ++j) {
-            // Calculate the x value
-            if (logy) {
-                // Log spaced
-                y = exp(log(ymin) + (log(ymax / ymin)) / (Ny - 1) * j);
-            } else {
-                // Linearly spaced
-                y = ymin + (ymax - ymin) / (Ny - 1) * j;
+    }
+    for (std::size_t j = 0; j < Ny; ++j) {
+        // Calculate the y value
+        if (logy) {
+            // Log spaced
+            yvec[j] = exp(log(ymin) + (log(ymax / ymin)) / (Ny - 1) * j);
+        } else {
+            // Linearly spaced
+            yvec[j] = ymin + (ymax - ymin) / (Ny - 1) * j;
+        }
+    }
+    isobars_per_tile = static_cast<std::size_t>(std::max(1, get_config_int(TABULAR_TILE_ISOBARS)));
+    tiles_built.assign(tile_count(), false);
+    if (!lazy) {
+        build_tiles(AS, path_to_tables, name, 0, Ny);
+    }
+}
+
+std::size_t CoolProp::SinglePhaseGriddedTableData::build_tiles(shared_ptr<CoolProp::AbstractState>& AS, const std::string& path_to_tables,
+                                                               const std::string& name, std::size_t j_begin, std::size_t j_end) {
+    std::size_t count = 0;
+    for (std::size_t k = j_begin / isobars_per_tile; k < tile_count() && k * isobars_per_tile < j_end; ++k) {
+        if (tiles_built[k]) {
+            continue;
+        }
+        std::string tile_name = format("%s_tile%d", name.c_str(), k);
+        bool resumed = false;
+        if (!path_to_tables.empty()) {
+            // Resume from the checkpoint of an earlier build if there is one
+            try {
+                std::vector<char> charbuffer = read_packed_table(path_to_tables + "/" + tile_name + ".bin.z");
+                msgpack::unpacked msg;
+                msgpack::unpack(msg, &(charbuffer[0]), charbuffer.size());
+                SinglePhaseTableTile tile;
+                msg.get().convert(tile);
+                resumed = unpack_tile(tile);
+            } catch (std::exception&) {
+                resumed = false;
+            }
+        }
+        if (!resumed) {
+            build_isobars(AS, k * isobars_per_tile, std::min(Ny, (k + 1) * isobars_per_tile));
+            if (!path_to_tables.empty()) {
+                SinglePhaseTableTile tile;
+                pack_tile(k, tile);
+                make_dirs(path_to_tables);
+                write_table(tile, path_to_tables, tile_name);
+            }
+        }
+        tiles_built[k] = true;
+        count++;
+        if (table_build_progress_callback != NULL) {
+            std::size_t done = static_cast<std::size_t>(std::count(tiles_built.begin(), tiles_built.end(), true));
+            table_build_progress_callback(name, done, tiles_built.size());
+        }
+    }
+    return count;
+}
+
+void CoolProp::SinglePhaseGriddedTableData::remove_tile_checkpoints(const std::string& path_to_tables, const std::string& name) const {
+    for (std::size_t k = 0; k < tile_count(); ++k) {
+        std::string path = format("%s/%s_tile%d.bin", path_to_tables.c_str(), name.c_str(), k);
+        std::remove((path + ".z").c_str());
+        std::remove(path.c_str());
+    }
+}
+
+void CoolProp::SinglePhaseGriddedTableData::build_isobars(shared_ptr<CoolProp::AbstractState>& AS, std::size_t j_begin, std::size_t j_end) {
+    CoolPropDbl x, y;
+    const bool debug = get_debug_level() > 5 || false;
+
+    // The table is built isobar by isobar.  For the tables in (h,p) and (T,p) of pure and pseudo-pure fluids, each node
+    // starts from the state at the previous node of the isobar if it is in the same region (liquid, vapor, or supercritical),
+    // which is much cheaper than a flash from scratch.  Two-phase nodes of the (h,p) table are skipped without a flash.
+    // Whenever the continuation fails, the node is calculated with the normal flash.
+    bool use_continuation = (get_config_bool(TABULAR_ISOBAR_CONTINUATION) && ykey == iP && (xkey == iT || xkey == iHmolar)
+                             && AS->get_mole_fractions().size() == 1);
+    CoolPropDbl Tmin = 0, Tmax = 0;
+    if (use_continuation) {
+        try {
+            CoolPropDbl pmax;
+            get_table_limits(*AS, Tmin, Tmax, pmax);
+            if (AS->has_limits_of_validity()) {
+                Tmin = std::min(AS->Tmin(), AS->Ttriple());
             }
-            yvec[j] = y;
+            Tmax *= 1.5;
+        } catch (...) {
+            use_continuation = false;
+        }
+    }
+
+    // ------------------------
+    // Actually build the table
+    // ------------------------
+    for (std::size_t j = j_begin; j < j_end; ++j) {
+        y = yvec[j];
+
+        IsobarSaturationLimits limits;
+        bool continue_this_isobar = use_continuation && isobar_saturation_limits(*AS, xkey, y, limits);
+        // The region of the last node that was calculated successfully; 0 if there is no such node to start from
+        int last_region = 0;
+        CoolPropDbl T_last = _HUGE, rhomolar_last = _HUGE, x_last = _HUGE, cpmolar_last = _HUGE;
+
+        for (std::size_t i = 0; i < Nx; ++i) {
+            x = xvec[i];
 
             if (debug) {
                 std::cout << "x: " << x << " y: " << y << std::endl;
             }
 
-            // Generate the input pair
-            CoolPropDbl v1, v2;
-            input_pairs input_pair = generate_update_pair(xkey, x, ykey, y, v1, v2);
+            int region = continue_this_isobar ? limits.region(x) : 0;
+            if (region == 0 && continue_this_isobar && xkey == iHmolar && x > limits.xL && x < limits.xV) {
+                // Skip two-phase states - they will remain as _HUGE holes in the table
+                if (debug) {
+                    std::cout << " 2Phase" << std::endl;
+                }
+                last_region = 0;
+                continue;
+            }
 
             // --------------------
             //   Update the state
             // --------------------
-            try {
-                AS->update(input_pair, v1, v2);
-                if (!ValidNumber(AS->rhomolar())) {
-                    throw ValueError("rhomolar is invalid");
-                }
-            } catch (std::exception& e) {
-                // That failed for some reason, go to the next pair
-                if (debug) {
-                    std::cout << " " << e.what() << std::endl;
+            bool continued = false;
+            if (region != 0 && region == last_region) {
+                try {
+                    continued =
+                      continue_isobar(*AS, xkey, x, y, region, limits, T_last, rhomolar_last, x_last, cpmolar_last, Tmin, Tmax);
+                } catch (NotImplementedError&) {
+                    // This backend cannot be continued; calculate all the remaining nodes with the normal flash
+                    use_continuation = false;
+                    continue_this_isobar = false;
+                    continued = false;
+                } catch (std::exception& e) {
+                    if (debug) {
+                        std::cout << " continuation: " << e.what() << std::endl;
+                    }
+                    continued = false;
                 }
-                continue;
             }
-
-            // Skip two-phase states - they will remain as _HUGE holes in the table
-            if (is_in_closed_range(0.0, 1.0, AS->Q())) {
-                if (debug) {
-                    std::cout << " 2Phase" << std::endl;
+            if (!continued) {
+                // Generate the input pair
+                CoolPropDbl v1, v2;
+                input_pairs input_pair = generate_update_pair(xkey, x, ykey, y, v1, v2);
+                try {
+                    AS->update(input_pair, v1, v2);
+                    if (!ValidNumber(AS->rhomolar())) {
+                        throw ValueError("rhomolar is invalid");
+                    }
+                } catch (std::exception& e) {
+                    // That failed for some reason, go to the next pair
+                    if (debug) {
+                        std::cout << " " << e.what() << std::endl;
+                    }
+                    last_region = 0;
+                    continue;
                 }
-                continue;
-            };
 
+                // Skip two-phase states - they will remain as _HUGE holes in the table
+                if (is_in_closed_range(0.0, 1.0, AS->Q())) {
+                    if (debug) {
+                        std::cout << " 2Phase" << std::endl;
+                    }
+                    last_region = 0;
+                    continue;
+                };
+            }
+            last_region = region;
+            if (last_region != 0) {
+                T_last = AS->T();
+                rhomolar_last = AS->rhomolar();
+                x_last = x;
+                if (xkey == iHmolar) {
+                    try {
+                        cpmolar_last = AS->cpmolar();
+                    } catch (std::exception&) {
+                        last_region = 0;
+                    }
+                }
+            }
             // --------------------
             //   State variables
             // --------------------
@@ -308,45 +759,70 @@ void CoolProp::SinglePhaseGriddedTableData::build(shared_ptr<CoolProp::AbstractS
                 // Failures will remain as holes in table
             }
 
-            // ----------------------------------------
-            //   First derivatives of state variables
-            // ----------------------------------------
-            dTdx[i][j] = AS->first_partial_deriv(iT, xkey, ykey);
-            dTdy[i][j] = AS->first_partial_deriv(iT, ykey, xkey);
-            dpdx[i][j] = AS->first_partial_deriv(iP, xkey, ykey);
-            dpdy[i][j] = AS->first_partial_deriv(iP, ykey, xkey);
-            drhomolardx[i][j] = AS->first_partial_deriv(iDmolar, xkey, ykey);
-            drhomolardy[i][j] = AS->first_partial_deriv(iDmolar, ykey, xkey);
-            dhmolardx[i][j] = AS->first_partial_deriv(iHmolar, xkey, ykey);
-            dhmolardy[i][j] = AS->first_partial_deriv(iHmolar, ykey, xkey);
-            dsmolardx[i][j] = AS->first_partial_deriv(iSmolar, xkey, ykey);
-            dsmolardy[i][j] = AS->first_partial_deriv(iSmolar, ykey, xkey);
-            dumolardx[i][j] = AS->first_partial_deriv(iUmolar, xkey, ykey);
-            dumolardy[i][j] = AS->first_partial_deriv(iUmolar, ykey, xkey);
-
-            // ----------------------------------------
-            //   Second derivatives of state variables
-            // ----------------------------------------
-            d2Tdx2[i][j] = AS->second_partial_deriv(iT, xkey, ykey, xkey, ykey);
-            d2Tdxdy[i][j] = AS->second_partial_deriv(iT, xkey, ykey, ykey, xkey);
-            d2Tdy2[i][j] = AS->second_partial_deriv(iT, ykey, xkey, ykey, xkey);
-            d2pdx2[i][j] = AS->second_partial_deriv(iP, xkey, ykey, xkey, ykey);
-            d2pdxdy[i][j] = AS->second_partial_deriv(iP, xkey, ykey, ykey, xkey);
-            d2pdy2[i][j] = AS->second_partial_deriv(iP, ykey, xkey, ykey, xkey);
-            d2rhomolardx2[i][j] = AS->second_partial_deriv(iDmolar, xkey, ykey, xkey, ykey);
-            d2rhomolardxdy[i][j] = AS->second_partial_deriv(iDmolar, xkey, ykey, ykey, xkey);
-            d2rhomolardy2[i][j] = AS->second_partial_deriv(iDmolar, ykey, xkey, ykey, xkey);
-            d2hmolardx2[i][j] = AS->second_partial_deriv(iHmolar, xkey, ykey, xkey, ykey);
-            d2hmolardxdy[i][j] = AS->second_partial_deriv(iHmolar, xkey, ykey, ykey, xkey);
-            d2hmolardy2[i][j] = AS->second_partial_deriv(iHmolar, ykey, xkey, ykey, xkey);
-            d2smolardx2[i][j] = AS->second_partial_deriv(iSmolar, xkey, ykey, xkey, ykey);
-            d2smolardxdy[i][j] = AS->second_partial_deriv(iSmolar, xkey, ykey, ykey, xkey);
-            d2smolardy2[i][j] = AS->second_partial_deriv(iSmolar, ykey, xkey, ykey, xkey);
-            d2umolardx2[i][j] = AS->second_partial_deriv(iUmolar, xkey, ykey, xkey, ykey);
-            d2umolardxdy[i][j] = AS->second_partial_deriv(iUmolar, xkey, ykey, ykey, xkey);
-            d2umolardy2[i][j] = AS->second_partial_deriv(iUmolar, ykey, xkey, ykey, xkey);
+            calculate_derivatives(AS, i, j);
+        }
+    }
+}
+void CoolProp::SinglePhaseGriddedTableData::calculate_derivatives(shared_ptr<CoolProp::AbstractState>& AS, std::size_t i, std::size_t j) {
+    // ----------------------------------------
+    //   First derivatives of state variables
+    // ----------------------------------------
+    dTdx[i][j] = AS->first_partial_deriv(iT, xkey, ykey);
+    dTdy[i][j] = AS->first_partial_deriv(iT, ykey, xkey);
+    dpdx[i][j] = AS->first_partial_deriv(iP, xkey, ykey);
+    dpdy[i][j] = AS->first_partial_deriv(iP, ykey, xkey);
+    drhomolardx[i][j] = AS->first_partial_deriv(iDmolar, xkey, ykey);
+    drhomolardy[i][j] = AS->first_partial_deriv(iDmolar, ykey, xkey);
+    dhmolardx[i][j] = AS->first_partial_deriv(iHmolar, xkey, ykey);
+    dhmolardy[i][j] = AS->first_partial_deriv(iHmolar, ykey, xkey);
+    dsmolardx[i][j] = AS->first_partial_deriv(iSmolar, xkey, ykey);
+    dsmolardy[i][j] = AS->first_partial_deriv(iSmolar, ykey, xkey);
+    dumolardx[i][j] = AS->first_partial_deriv(iUmolar, xkey, ykey);
+    dumolardy[i][j] = AS->first_partial_deriv(iUmolar, ykey, xkey);
+
+    // ----------------------------------------
+    //   Second derivatives of state variables
+    // ----------------------------------------
+    d2Tdx2[i][j] = AS->second_partial_deriv(iT, xkey, ykey, xkey, ykey);
+    d2Tdxdy[i][j] = AS->second_partial_deriv(iT, xkey, ykey, ykey, xkey);
+    d2Tdy2[i][j] = AS->second_partial_deriv(iT, ykey, xkey, ykey, xkey);
+    d2pdx2[i][j] = AS->second_partial_deriv(iP, xkey, ykey, xkey, ykey);
+    d2pdxdy[i][j] = AS->second_partial_deriv(iP, xkey, ykey, ykey, xkey);
+    d2pdy2[i][j] = AS->second_partial_deriv(iP, ykey, xkey, ykey, xkey);
+    d2rhomolardx2[i][j] = AS->second_partial_deriv(iDmolar, xkey, ykey, xkey, ykey);
+    d2rhomolardxdy[i][j] = AS->second_partial_deriv(iDmolar, xkey, ykey, ykey, xkey);
+    d2rhomolardy2[i][j] = AS->second_partial_deriv(iDmolar, ykey, xkey, ykey, xkey);
+    d2hmolardx2[i][j] = AS->second_partial_deriv(iHmolar, xkey, ykey, xkey, ykey);
+    d2hmolardxdy[i][j] = AS->second_partial_deriv(iHmolar, xkey, ykey, ykey, xkey);
+    d2hmolardy2[i][j] = AS->second_partial_deriv(iHmolar, ykey, xkey, ykey, xkey);
+    d2smolardx2[i][j] = AS->second_partial_deriv(iSmolar, xkey, ykey, xkey, ykey);
+    d2smolardxdy[i][j] = AS->second_partial_deriv(iSmolar, xkey, ykey, ykey, xkey);
+    d2smolardy2[i][j] = AS->second_partial_deriv(iSmolar, ykey, xkey, ykey, xkey);
+    d2umolardx2[i][j] = AS->second_partial_deriv(iUmolar, xkey, ykey, xkey, ykey);
+    d2umolardxdy[i][j] = AS->second_partial_deriv(iUmolar, xkey, ykey, ykey, xkey);
+    d2umolardy2[i][j] = AS->second_partial_deriv(iUmolar, ykey, xkey, ykey, xkey);
+}
+void CoolProp::SinglePhaseGriddedTableData::rebuild_derivatives(shared_ptr<CoolProp::AbstractState>& AS) {
+/* Use X macros to auto-generate the code; each will look something like: dTdx.assign(Nx, std::vector<double>(Ny, _HUGE)); */
+#define X(name) name.assign(Nx, std::vector<double>(Ny, _HUGE));
+    LIST_OF_DERIVATIVE_MATRICES
+#undef X
+    for (std::size_t i = 0; i < Nx; ++i) {
+        for (std::size_t j = 0; j < Ny; ++j) {
+            if (!ValidNumber(T[i][j]) || !ValidNumber(rhomolar[i][j])) {
+                continue;
+            }
+            try {
+                // The node is single-phase, so the state follows directly from its temperature and density
+                AS->update(DmolarT_INPUTS, rhomolar[i][j], T[i][j]);
+                calculate_derivatives(AS, i, j);
+            } catch (std::exception&) {
+                // Failures will remain as holes in table
+            }
         }
     }
+    make_good_neighbors();
+    derivatives_released = false;
 }
 std::string CoolProp::TabularBackend::path_to_tables(void) {
     std::vector<std::string> fluids = AS->fluid_names();
@@ -355,12 +831,7 @@ std::string CoolProp::TabularBackend::path_to_tables(void) {
     for (std::size_t i = 0; i < fluids.size(); ++i) {
         components.push_back(format("%s[%0.10Lf]", fluids[i].c_str(), fractions[i]));
     }
-    std::string table_directory = get_home_dir() + "/.CoolProp/Tables/";
-    std::string alt_table_directory = get_config_string(ALTERNATIVE_TABLES_DIRECTORY);
-    if (!alt_table_directory.empty()) {
-        table_directory = alt_table_directory;
-    }
-    return table_directory + AS->backend_name() + "(" + strjoin(components, "&") + ")";
+    return get_tables_directory() + AS->backend_name() + "(" + strjoin(components, "&") + ")";
 }
 
 void CoolProp::TabularBackend::write_tables() {
@@ -376,6 +847,12 @@ void CoolProp::TabularBackend::write_tables() {
     write_table(single_phase_logpT, path_to_tables, "single_phase_logpT");
     write_table(pure_saturation, path_to_tables, "pure_saturation");
     write_table(phase_envelope, path_to_tables, "phase_envelope");
+    // The packed copies are no longer needed once they are written
+    single_phase_logph.matrices.clear();
+    single_phase_logpT.matrices.clear();
+    pure_saturation.vectors.clear();
+    phase_envelope.vectors.clear();
+    phase_envelope.matrices.clear();
 }
 void CoolProp::TabularBackend::load_tables() {
     bool loaded = false;
@@ -387,6 +864,118 @@ void CoolProp::TabularBackend::load_tables() {
         std::cout << "Tables loaded" << std::endl;
     }
 }
+void CoolProp::TabularBackend::prepare_bicubic_storage() {
+    dataset->build_coeffs(dataset->single_phase_logph, dataset->coeffs_ph);
+    dataset->build_coeffs(dataset->single_phase_logpT, dataset->coeffs_pT);
+    std::size_t bytes_before = dataset->memory_footprint();
+    double error = 0;
+    if (get_config_bool(TABULAR_FLOAT32_COEFFICIENTS)) {
+        error = dataset->convert_coeffs_to_float32();
+    }
+    // The TTSE backend interpolates with the derivatives, so they must be kept if it shares the tables, as they must while
+    // there are tiles left to build
+    if (get_config_bool(TABULAR_COMPACT_STORAGE) && !dataset->derivatives_in_use && dataset->tables_complete()) {
+        dataset->release_derivatives();
+    }
+    if (get_debug_level() > 0) {
+        std::cout << format("Tabular data for %s use %0.2f MB (%0.2f MB before compaction); largest relative error of the coefficients is %g",
+                            path_to_tables().c_str(), dataset->memory_footprint() / 1048576.0, bytes_before / 1048576.0, error)
+                  << std::endl;
+    }
+}
+void CoolProp::TabularBackend::ensure_tiles(CoolProp::input_pairs input_pair, double val1, double val2) {
+    switch (input_pair) {
+        case HmolarP_INPUTS:
+        case DmolarP_INPUTS:
+            dataset->ensure_tiles(this->AS, dataset->single_phase_logph, dataset->coeffs_ph, val2);
+            break;
+        case PUmolar_INPUTS:
+        case PSmolar_INPUTS:
+            dataset->ensure_tiles(this->AS, dataset->single_phase_logph, dataset->coeffs_ph, val1);
+            break;
+        case PT_INPUTS:
+            dataset->ensure_tiles(this->AS, dataset->single_phase_logpT, dataset->coeffs_pT, val1);
+            break;
+        default:
+            // The pressure is not an input, so any isobar might be needed
+            dataset->ensure_tiles(this->AS, dataset->single_phase_logph, dataset->coeffs_ph, _HUGE);
+            dataset->ensure_tiles(this->AS, dataset->single_phase_logpT, dataset->coeffs_pT, _HUGE);
+    }
+}
+void CoolProp::TabularBackend::prepare_TTSE_storage() {
+    dataset->derivatives_in_use = true;
+    // A bicubic backend in compact mode may have released them; they are calculated again from the nodes rather than reloaded,
+    // since the tables might not have been written
+    dataset->rebuild_derivatives(this->AS);
+    if (!get_config_bool(TABULAR_COMPACT_STORAGE)) {
+        dataset->build_coeffs(dataset->single_phase_logph, dataset->coeffs_ph);
+        dataset->build_coeffs(dataset->single_phase_logpT, dataset->coeffs_pT);
+    }
+}
+
+/// A cached index of a cell as a value of a snapshot buffer, -1 if it is not set
+static double snapshot_index(std::size_t i) {
+    return (i == std::numeric_limits<std::size_t>::max()) ? -1 : static_cast<double>(i);
+}
+/// Read a cached index of a cell that was written by snapshot_index
+static std::size_t restore_index(double value) {
+    return (value < 0) ? std::numeric_limits<std::size_t>::max() : static_cast<std::size_t>(value);
+}
+
+void CoolProp::TabularBackend::calc_snapshot(std::vector<double>& buffer) {
+    if (is_mixture) {
+        snapshot_vector(buffer, AS->get_mole_fractions());
+    } else {
+        snapshot_vector(buffer, std::vector<CoolPropDbl>());
+    }
+    buffer.push_back(_T);
+    buffer.push_back(_p);
+    buffer.push_back(_rhomolar);
+    buffer.push_back(_Q);
+    snapshot_cached(buffer, _hmolar);
+    snapshot_cached(buffer, _smolar);
+    snapshot_cached(buffer, _umolar);
+    buffer.push_back(static_cast<double>(_phase));
+    buffer.push_back(static_cast<double>(selected_table));
+    buffer.push_back(using_single_phase_table ? 1 : 0);
+    buffer.push_back(snapshot_index(cached_single_phase_i));
+    buffer.push_back(snapshot_index(cached_single_phase_j));
+    buffer.push_back(snapshot_index(cached_saturation_iL));
+    buffer.push_back(snapshot_index(cached_saturation_iV));
+}
+void CoolProp::TabularBackend::calc_restore(const std::vector<double>& buffer, std::size_t& i) {
+    std::vector<CoolPropDbl> z;
+    restore_vector(buffer, i, z);
+    double T = restore_value(buffer, i), p = restore_value(buffer, i), rhomolar = restore_value(buffer, i), Q = restore_value(buffer, i);
+    CachedElement hmolar, smolar, umolar;
+    restore_cached(buffer, i, hmolar);
+    restore_cached(buffer, i, smolar);
+    restore_cached(buffer, i, umolar);
+    double values[7];
+    for (std::size_t k = 0; k < 7; ++k) {
+        values[k] = restore_value(buffer, i);
+    }
+    restore_end(buffer, i);
+    if (is_mixture && z != AS->get_mole_fractions()) {
+        throw ValueError("The snapshot is of another composition than the one of the tables of this state");
+    }
+    clear();
+    check_tables();
+    _T = T;
+    _p = p;
+    _rhomolar = rhomolar;
+    _Q = Q;
+    _hmolar = hmolar;
+    _smolar = smolar;
+    _umolar = umolar;
+    _phase = static_cast<phases>(static_cast<int>(values[0]));
+    selected_table = static_cast<selected_table_options>(static_cast<int>(values[1]));
+    using_single_phase_table = (values[2] != 0);
+    cached_single_phase_i = restore_index(values[3]);
+    cached_single_phase_j = restore_index(values[4]);
+    cached_saturation_iL = restore_index(values[5]);
+    cached_saturation_iV = restore_index(values[6]);
+}
 
 CoolPropDbl CoolProp::TabularBackend::calc_saturated_vapor_keyed_output(parameters key) {
     PhaseEnvelopeData& phase_envelope = dataset->phase_envelope;
@@ -851,6 +1440,11 @@ void CoolProp::TabularBackend::update(CoolProp::input_pairs input_pair, double v
     // Check the tables, build if necessary
     check_tables();
 
+    // Build the tiles that the state falls in, if the tables are built lazily
+    if (!dataset->tables_complete()) {
+        ensure_tiles(input_pair, val1, val2);
+    }
+
     // Flush the cached indices (set to large number)
     cached_single_phase_i = std::numeric_limits<std::size_t>::max();
     cached_single_phase_j = std::numeric_limits<std::size_t>::max();
@@ -1277,7 +1871,7 @@ void CoolProp::TabularDataSet::load_tables(const std::string& path_to_tables, sh
     }
 };
 
-void CoolProp::TabularDataSet::build_tables(shared_ptr<CoolProp::AbstractState>& AS) {
+void CoolProp::TabularDataSet::build_tables(shared_ptr<CoolProp::AbstractState>& AS, const std::string& path_to_tables) {
     // Pure or pseudo-pure fluid
     if (AS->get_mole_fractions().size() == 1) {
         pure_saturation.build(AS);
@@ -1291,11 +1885,68 @@ void CoolProp::TabularDataSet::build_tables(shared_ptr<CoolProp::AbstractState>&
         // Resize so that it will load properly
         pure_saturation.resize(pure_saturation.N);
     }
-    single_phase_logph.build(AS);
-    single_phase_logpT.build(AS);
+    tiles_path = path_to_tables;
+    bool lazy = get_config_bool(TABULAR_LAZY_TILES);
+    single_phase_logph.build(AS, tiles_path, "single_phase_logph", lazy);
+    single_phase_logpT.build(AS, tiles_path, "single_phase_logpT", lazy);
+    if (lazy) {
+        // Nothing is known about the cells yet; good neighbors are found as the tiles are built
+        single_phase_logph.make_good_neighbors();
+        single_phase_logpT.make_good_neighbors();
+    }
     tables_loaded = true;
 }
 
+bool CoolProp::TabularDataSet::ensure_tiles(shared_ptr<CoolProp::AbstractState>& AS, SinglePhaseGriddedTableData& table,
+                                            std::vector<std::vector<CellCoeffs>>& coeffs, double y) {
+    if (table.all_tiles_built()) {
+        return false;
+    }
+    std::size_t j_begin = 0, j_end = table.Ny;
+    if (ValidNumber(y)) {
+        // The isobars of the cell, and those of the cells on either side, which might be taken as its neighbors
+        std::size_t j = table.isobar_index(y);
+        j_begin = (j > 0) ? j - 1 : 0;
+        j_end = std::min(table.Ny, j + 3);
+    }
+    std::string name = (&table == &single_phase_logph) ? "single_phase_logph" : "single_phase_logpT";
+    if (table.build_tiles(AS, tiles_path, name, j_begin, j_end) == 0) {
+        return false;
+    }
+    table.make_good_neighbors();
+    if (!coeffs.empty()) {
+        // The cells at the edges of the new tiles change, so the coefficients are built again
+        coeffs.clear();
+        build_coeffs(table, coeffs);
+        if (get_config_bool(TABULAR_FLOAT32_COEFFICIENTS)) {
+            convert_cells_to_float32(table, coeffs);
+        }
+    }
+    if (single_phase_logph.all_tiles_built() && single_phase_logpT.all_tiles_built() && !tiles_path.empty()) {
+        // The tables are complete; write them so that they are loaded the next time, and drop the checkpoints of the tiles
+        single_phase_logph.pack();
+        single_phase_logpT.pack();
+        pure_saturation.pack();
+        phase_envelope.pack();
+        write_tables(tiles_path);
+        single_phase_logph.matrices.clear();
+        single_phase_logpT.matrices.clear();
+        pure_saturation.vectors.clear();
+        phase_envelope.vectors.clear();
+        phase_envelope.matrices.clear();
+        remove_tile_checkpoints();
+    }
+    return true;
+}
+
+void CoolProp::TabularDataSet::remove_tile_checkpoints() {
+    if (tiles_path.empty()) {
+        return;
+    }
+    single_phase_logph.remove_tile_checkpoints(tiles_path, "single_phase_logph");
+    single_phase_logpT.remove_tile_checkpoints(tiles_path, "single_phase_logpT");
+}
+
 /// Return the set of tabular datasets
 CoolProp::TabularDataSet* CoolProp::TabularDataLibrary::get_set_of_tables(shared_ptr<AbstractState>& AS, bool& loaded) {
     const std::string path = path_to_tables(AS);
@@ -1323,6 +1974,18 @@ CoolProp::TabularDataSet* CoolProp::TabularDataLibrary::get_set_of_tables(shared
     }
 }
 
+std::map<std::string, std::size_t> CoolProp::TabularDataLibrary::memory_footprints() const {
+    std::map<std::string, std::size_t> footprints;
+    for (std::map<std::string, TabularDataSet>::const_iterator it = data.begin(); it != data.end(); ++it) {
+        footprints[it->first] = it->second.memory_footprint();
+    }
+    return footprints;
+}
+
+std::map<std::string, std::size_t> CoolProp::get_tabular_memory_footprints() {
+    return library.memory_footprints();
+}
+
 void CoolProp::TabularDataSet::build_coeffs(SinglePhaseGriddedTableData& table, std::vector<std::vector<CellCoeffs>>& coeffs) {
     if (!coeffs.empty()) {
         return;
@@ -1334,8 +1997,19 @@ void CoolProp::TabularDataSet::build_coeffs(SinglePhaseGriddedTableData& table,
 
     clock_t t1 = clock();
 
-    // Resize the coefficient structures
+    // Resize the coefficient structures, with room in each cell for the properties that are not inputs of the table
+    std::size_t set_count = 0;
+    for (std::size_t k = 0; k < param_count; ++k) {
+        if (param_list[k] != table.xkey && param_list[k] != table.ykey) {
+            ++set_count;
+        }
+    }
     coeffs.resize(table.Nx - 1, std::vector<CellCoeffs>(table.Ny - 1));
+    for (std::size_t i = 0; i < coeffs.size(); ++i) {
+        for (std::size_t j = 0; j < coeffs[i].size(); ++j) {
+            coeffs[i][j].reserve(set_count);
+        }
+    }
 
     int valid_cell_count = 0;
     for (std::size_t k = 0; k < param_count; ++k) {
@@ -1467,6 +2141,26 @@ void CoolProp::TabularDataSet::build_coeffs(SinglePhaseGriddedTableData& table,
     }
 }
 
+double CoolProp::TabularDataSet::convert_coeffs_to_float32() {
+    return std::max(convert_cells_to_float32(single_phase_logph, coeffs_ph), convert_cells_to_float32(single_phase_logpT, coeffs_pT));
+}
+
+std::size_t CoolProp::TabularDataSet::memory_footprint() const {
+    std::size_t bytes = single_phase_logph.memory_footprint() + single_phase_logpT.memory_footprint();
+    const std::vector<std::vector<CellCoeffs>>* coeffs[2] = {&coeffs_ph, &coeffs_pT};
+    for (int k = 0; k < 2; ++k) {
+        bytes += coeffs[k]->capacity() * sizeof(std::vector<CellCoeffs>);
+        for (std::size_t i = 0; i < coeffs[k]->size(); ++i) {
+            const std::vector<CellCoeffs>& row = (*coeffs[k])[i];
+            bytes += (row.capacity() - row.size()) * sizeof(CellCoeffs);
+            for (std::size_t j = 0; j < row.size(); ++j) {
+                bytes += row[j].memory_footprint();
+            }
+        }
+    }
+    return bytes;
+}
+
 #    if defined(ENABLE_CATCH)
 #        include <catch2/catch_all.hpp>
 
@@ -1675,6 +2369,282 @@ TEST_CASE_METHOD(TabularFixture, "Tests for tabular backends with water", "[Tabu
         CHECK(std::abs((expected - actual_BICUBIC) / expected) < 1e-3);
     }
 }
+TEST_CASE("Tables built by continuation along the isobars agree with independent flashes", "[Tabular],[Tabular_build]") {
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "Water"));
+    shared_ptr<CoolProp::AbstractState> check(CoolProp::AbstractState::factory("HEOS", "Water"));
+    CoolProp::LogPHTable ph;
+    CoolProp::LogPTTable pT;
+    CoolProp::SinglePhaseGriddedTableData* tables[2] = {&ph, &pT};
+    for (int k = 0; k < 2; ++k) {
+        CoolProp::SinglePhaseGriddedTableData& table = *tables[k];
+        table.Nx = 40;
+        table.Ny = 30;
+        table.AS = HEOS;
+        table.set_limits();
+        table.build(HEOS);
+        std::size_t filled = 0, filled_independent = 0;
+        for (std::size_t i = 0; i < table.Nx; ++i) {
+            for (std::size_t j = 0; j < table.Ny; ++j) {
+                CoolPropDbl v1, v2;
+                CoolProp::input_pairs pair = CoolProp::generate_update_pair(table.xkey, table.xvec[i], table.ykey, table.yvec[j], v1, v2);
+                bool ok = true;
+                try {
+                    check->update(pair, v1, v2);
+                    ok = ValidNumber(check->rhomolar()) && !is_in_closed_range(0.0, 1.0, static_cast<double>(check->Q()));
+                } catch (...) {
+                    ok = false;
+                }
+                filled_independent += ok;
+                if (!ValidNumber(table.T[i][j])) {
+                    continue;
+                }
+                filled++;
+                if (ok) {
+                    CAPTURE(table.xvec[i]);
+                    CAPTURE(table.yvec[j]);
+                    CHECK(std::abs(table.T[i][j] / check->T() - 1) < 1e-8);
+                    CHECK(std::abs(table.rhomolar[i][j] / check->rhomolar() - 1) < 1e-8);
+                }
+            }
+        }
+        CHECK(filled >= filled_independent);
+    }
+}
+TEST_CASE("Compact storage of the tables for the bicubic backend", "[Tabular]") {
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "Water"));
+    CoolProp::TabularDataSet dataset;
+    CoolProp::LogPHTable& table = dataset.single_phase_logph;
+    table.Nx = 40;
+    table.Ny = 30;
+    table.AS = HEOS;
+    table.set_limits();
+    table.build(HEOS);
+    dataset.build_coeffs(table, dataset.coeffs_ph);
+    // A copy of the coefficients in double precision
+    std::vector<std::vector<CoolProp::CellCoeffs>> coeffs = dataset.coeffs_ph;
+    std::size_t bytes = dataset.memory_footprint();
+    std::vector<std::vector<double>> dTdx = table.dTdx, d2smolardy2 = table.d2smolardy2;
+
+    double error = dataset.convert_coeffs_to_float32();
+    CHECK(error > 0);
+    CHECK(error < 1e-6);
+    dataset.release_derivatives();
+    CHECK(table.derivatives_released);
+    CHECK(table.dTdx.empty());
+    // The derivatives are most of the tables, and the coefficients take half as much memory
+    CHECK(dataset.memory_footprint() < bytes / 2);
+
+    // The interpolated values are within the precision of the float32 coefficients
+    std::size_t checked = 0;
+    for (std::size_t i = 0; i < table.Nx - 1; i += 3) {
+        for (std::size_t j = 0; j < table.Ny - 1; j += 3) {
+            if (!coeffs[i][j].valid()) {
+                continue;
+            }
+            double a64[16], a32[16];
+            coeffs[i][j].get(CoolProp::iT, a64);
+            dataset.coeffs_ph[i][j].get(CoolProp::iT, a32);
+            double T64 = 0, T32 = 0;
+            for (int l = 0; l < 4; ++l) {
+                for (int m = 0; m < 4; ++m) {
+                    T64 += a64[m * 4 + l] * pow(0.3, l) * pow(0.6, m);
+                    T32 += a32[m * 4 + l] * pow(0.3, l) * pow(0.6, m);
+                }
+            }
+            CAPTURE(T64);
+            CHECK(std::abs(T32 / T64 - 1) < 1e-6);
+            checked++;
+        }
+    }
+    CHECK(checked > 50);
+
+    // The TTSE backend calculates the released derivatives again from the nodes, without the tables on disk
+    dataset.rebuild_derivatives(HEOS);
+    CHECK(!table.derivatives_released);
+    checked = 0;
+    for (std::size_t i = 0; i < table.Nx; i += 3) {
+        for (std::size_t j = 0; j < table.Ny; j += 3) {
+            if (!ValidNumber(dTdx[i][j])) {
+                continue;
+            }
+            CAPTURE(i);
+            CAPTURE(j);
+            CHECK(std::abs(table.dTdx[i][j] / dTdx[i][j] - 1) < 1e-8);
+            CHECK(std::abs(table.d2smolardy2[i][j] - d2smolardy2[i][j]) < 1e-8 * std::abs(d2smolardy2[i][j]) + 1e-14);
+            checked++;
+        }
+    }
+    CHECK(checked > 50);
+}
+TEST_CASE("Tabular backends wrapping the Peng-Robinson backend", "[Tabular]") {
+    shared_ptr<CoolProp::AbstractState> PR(CoolProp::AbstractState::factory("PR", "Propane"));
+    shared_ptr<CoolProp::AbstractState> BICUBIC(CoolProp::AbstractState::factory("BICUBIC&PR", "Propane"));
+    // The limits of the tables come from the critical point since the cubics have no limits of validity
+    CHECK(std::abs(BICUBIC->Tmin() / PR->T_critical() - 0.4) < 1e-12);
+    CHECK(BICUBIC->Tmax() > PR->T_critical());
+
+    // Liquid, vapor and supercritical states
+    double states[][2] = {{5e6, 250}, {1e5, 300}, {6e6, 450}};
+    for (std::size_t i = 0; i < sizeof(states) / sizeof(states[0]); ++i) {
+        double p = states[i][0], T = states[i][1];
+        CAPTURE(p);
+        CAPTURE(T);
+        PR->update(CoolProp::PT_INPUTS, p, T);
+        BICUBIC->update(CoolProp::PT_INPUTS, p, T);
+        CHECK(std::abs(BICUBIC->rhomolar() / PR->rhomolar() - 1) < 1e-3);
+        CHECK(std::abs(BICUBIC->hmolar() - PR->hmolar()) < 1e-3 * std::abs(PR->hmolar()) + 1);
+        // And back from (p, h)
+        BICUBIC->update(CoolProp::HmolarP_INPUTS, PR->hmolar(), p);
+        CHECK(std::abs(BICUBIC->T() - T) < 1e-2);
+    }
+    // Saturation from the saturation tables
+    PR->update(CoolProp::PQ_INPUTS, 101325, 0);
+    BICUBIC->update(CoolProp::PQ_INPUTS, 101325, 0);
+    CHECK(std::abs(BICUBIC->T() - PR->T()) < 1e-2);
+    CHECK(std::abs(BICUBIC->saturated_vapor_keyed_output(CoolProp::iDmolar) / PR->saturated_vapor_keyed_output(CoolProp::iDmolar) - 1) < 1e-3);
+}
+TEST_CASE("Limits of the tables of the cubic backends", "[Tabular]") {
+    // The cubics have no limits of validity, so the limits come from the critical point of a pure fluid or the
+    // pseudo-critical point of a mixture of fixed composition
+    const char* backends[][2] = {{"PR", "Propane"}, {"PR", "Methane&Ethane"}, {"SRK", "Methane&Ethane"}, {"VTPR", "n-Propane"},
+                                 {"VTPR", "Ethane&n-Propane"}};
+    for (std::size_t k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k) {
+        CAPTURE(backends[k][0]);
+        CAPTURE(backends[k][1]);
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory(backends[k][0], backends[k][1]));
+        CHECK(!AS->has_limits_of_validity());
+        CoolPropDbl Tmin, Tmax, pmax;
+        std::vector<CoolPropDbl> z(1, 1.0);
+        if (AS->get_mole_fractions().size() != 1) {
+            CHECK_THROWS_AS(CoolProp::get_table_limits(*AS, Tmin, Tmax, pmax), CoolProp::ValueError);
+            z.resize(2);
+            z[0] = 0.3;
+            z[1] = 0.7;
+            AS->set_mole_fractions(z);
+        }
+        CoolPropDbl Tc = 0, pc = 0;
+        for (std::size_t i = 0; i < z.size(); ++i) {
+            Tc += z[i] * AS->get_fluid_constant(i, CoolProp::iT_critical);
+            pc += z[i] * AS->get_fluid_constant(i, CoolProp::iP_critical);
+        }
+        CoolProp::get_table_limits(*AS, Tmin, Tmax, pmax);
+        CHECK(std::abs(Tmin / Tc - 0.4) < 1e-12);
+        CHECK(std::abs(Tmax / Tc - 2.0) < 1e-12);
+        CHECK(std::abs(pmax / pc - 10.0) < 1e-12);
+        // The limits must change with the composition of the mixture
+        if (z.size() > 1) {
+            z[0] = 0.7;
+            z[1] = 0.3;
+            AS->set_mole_fractions(z);
+            CoolPropDbl Tmin2, Tmax2, pmax2;
+            CoolProp::get_table_limits(*AS, Tmin2, Tmax2, pmax2);
+            CHECK(std::abs(Tmin2 - Tmin) > 1);
+        }
+    }
+}
+TEST_CASE("Tabular backends wrapping a cubic mixture of fixed composition", "[Tabular]") {
+    std::vector<CoolPropDbl> z(2, 0.5);
+    shared_ptr<CoolProp::AbstractState> PR(CoolProp::AbstractState::factory("PR", "Methane&Ethane"));
+    PR->set_mole_fractions(z);
+    const char* backends[] = {"BICUBIC&PR", "TTSE&PR"};
+    for (std::size_t k = 0; k < sizeof(backends) / sizeof(backends[0]); ++k) {
+        CAPTURE(backends[k]);
+        shared_ptr<CoolProp::AbstractState> TAB(CoolProp::AbstractState::factory(backends[k], "Methane&Ethane"));
+        TAB->set_mole_fractions(z);
+        // Compressed liquid, gas and supercritical states, away from the phase envelope
+        double states[][2] = {{6e6, 150}, {1e5, 300}, {8e6, 400}};
+        for (std::size_t i = 0; i < sizeof(states) / sizeof(states[0]); ++i) {
+            double p = states[i][0], T = states[i][1];
+            CAPTURE(p);
+            CAPTURE(T);
+            PR->update(CoolProp::PT_INPUTS, p, T);
+            TAB->update(CoolProp::PT_INPUTS, p, T);
+            CHECK(std::abs(TAB->rhomolar() / PR->rhomolar() - 1) < 1e-3);
+            CHECK(std::abs(TAB->hmolar() - PR->hmolar()) < 1e-3 * std::abs(PR->hmolar()) + 1);
+            // And back from (p, h)
+            TAB->update(CoolProp::HmolarP_INPUTS, PR->hmolar(), p);
+            CHECK(std::abs(TAB->T() - T) < 1e-2);
+        }
+    }
+}
+TEST_CASE("Tabular backends cannot wrap the PC-SAFT backend", "[Tabular]") {
+    // PC-SAFT has no ideal-gas part, so it cannot give the enthalpies the tables are built on
+    CHECK_THROWS_AS(CoolProp::AbstractState::factory("BICUBIC&PCSAFT", "Propane"), CoolProp::NotImplementedError);
+}
+
+TEST_CASE("Saturation table interpolation without bisection or fitting", "[Tabular]") {
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "Water"));
+    CoolProp::PureFluidSaturationTableData sat;
+    sat.N = 200;
+    sat.build(HEOS);
+    CHECK(sat.dlogp > 0);
+    CHECK(!sat.T_index[0].empty());
+    CHECK(!sat.T_index[1].empty());
+    for (double p = 700; p < 2.2e7; p *= 1.37) {
+        CAPTURE(p);
+        for (int Q = 0; Q < 2; ++Q) {
+            // The same nodes as a bisection
+            std::size_t ip = 0, iT = 0;
+            bisect_vector((Q == 0) ? sat.pL : sat.pV, p, ip);
+            CHECK(sat.node_index(CoolProp::iP, Q, p) == ip);
+            double T = sat.evaluate(CoolProp::iT, p, Q, ip, ip);
+            bisect_vector((Q == 0) ? sat.TL : sat.TV, T, iT);
+            CHECK(sat.node_index(CoolProp::iT, Q, T) == iT);
+            // The same values as the cubics fitted at each call
+            std::size_t i = std::max(ip, static_cast<std::size_t>(2));
+            const std::vector<double>& logp = (Q == 0) ? sat.logpL : sat.logpV;
+            const std::vector<double>& h = (Q == 0) ? sat.hmolarL : sat.hmolarV;
+            double h_fitted = CubicInterp(logp, h, i - 2, i - 1, i, i + 1, log(p));
+            CHECK(std::abs(sat.evaluate(CoolProp::iHmolar, p, Q, i, i) / h_fitted - 1) < 1e-10);
+        }
+    }
+}
+
+static std::size_t tile_callback_count = 0;
+static void count_tiles(const std::string& table, std::size_t tiles_done, std::size_t tiles_total) {
+    tile_callback_count++;
+}
+
+TEST_CASE("Checkpointed and lazy building of the single-phase tables", "[Tabular],[Tabular_build]") {
+    shared_ptr<CoolProp::AbstractState> HEOS(CoolProp::AbstractState::factory("HEOS", "Water"));
+    const std::string path = CoolProp::get_tables_directory() + "tile_checkpoint_test";
+    const std::string name = "single_phase_logpT";
+    CoolProp::LogPTTable table;
+    table.Nx = 40;
+    table.Ny = 30;
+    table.AS = HEOS;
+    table.set_limits();
+    CoolProp::set_table_build_progress_callback(count_tiles);
+    tile_callback_count = 0;
+    table.build(HEOS, path, name, false);
+    CHECK(table.all_tiles_built());
+    CHECK(table.tile_count() > 1);
+    CHECK(tile_callback_count == table.tile_count());
+    CHECK_NOTHROW(CoolProp::read_packed_table(path + "/" + name + "_tile0.bin.z"));
+
+    // Another table with the same limits is assembled from the checkpoints, so the AbstractState it is given is never called
+    shared_ptr<CoolProp::AbstractState> PR(CoolProp::AbstractState::factory("PR", "Water"));
+    CoolProp::LogPTTable resumed;
+    resumed.Nx = table.Nx;
+    resumed.Ny = table.Ny;
+    resumed.AS = HEOS;
+    resumed.set_limits();
+    resumed.build(PR, path, name, true);
+    CHECK(!resumed.all_tiles_built());
+    CHECK(!ValidNumber(resumed.T[0][0]));
+    CHECK(resumed.build_tiles(PR, path, name, 0, 1) == 1);
+    CHECK(resumed.tiles_built[0]);
+    CHECK(!resumed.tiles_built[1]);
+    CHECK(resumed.build_tiles(PR, path, name, 0, resumed.Ny) == resumed.tile_count() - 1);
+    CHECK(resumed.all_tiles_built());
+    CHECK(resumed.T == table.T);
+    CHECK(resumed.rhomolar == table.rhomolar);
+    CHECK(tile_callback_count == 2 * table.tile_count());
+
+    table.remove_tile_checkpoints(path, name);
+    CHECK_THROWS(CoolProp::read_packed_table(path + "/" + name + "_tile0.bin.z"));
+    CoolProp::set_table_build_progress_callback(NULL);
+}
 #    endif  // ENABLE_CATCH
 
 #endif  // !defined(NO_TABULAR_BACKENDS)
@@ -10,51 +10,65 @@
 #include <sstream>
 #include "Configuration.h"
 #include "Backends/Helmholtz/PhaseEnvelopeRoutines.h"
+#include <stdint.h>
 
 /** ***MAGIC WARNING***!! X Macros in use
  * See http://stackoverflow.com/a/148610
  * See http://stackoverflow.com/questions/147267/easy-way-to-use-variables-of-enum-types-as-string-in-c#202511
  */
-#define LIST_OF_MATRICES \
-    X(T)                 \
-    X(p)                 \
-    X(rhomolar)          \
-    X(hmolar)            \
-    X(smolar)            \
-    X(umolar)            \
-    X(dTdx)              \
-    X(dTdy)              \
-    X(dpdx)              \
-    X(dpdy)              \
-    X(drhomolardx)       \
-    X(drhomolardy)       \
-    X(dhmolardx)         \
-    X(dhmolardy)         \
-    X(dsmolardx)         \
-    X(dsmolardy)         \
-    X(dumolardx)         \
-    X(dumolardy)         \
-    X(d2Tdx2)            \
-    X(d2Tdxdy)           \
-    X(d2Tdy2)            \
-    X(d2pdx2)            \
-    X(d2pdxdy)           \
-    X(d2pdy2)            \
-    X(d2rhomolardx2)     \
-    X(d2rhomolardxdy)    \
-    X(d2rhomolardy2)     \
-    X(d2hmolardx2)       \
-    X(d2hmolardxdy)      \
-    X(d2hmolardy2)       \
-    X(d2smolardx2)       \
-    X(d2smolardxdy)      \
-    X(d2smolardy2)       \
-    X(d2umolardx2)       \
-    X(d2umolardxdy)      \
-    X(d2umolardy2)       \
-    X(visc)              \
+#define LIST_OF_VALUE_MATRICES \
+    X(T)                       \
+    X(p)                       \
+    X(rhomolar)                \
+    X(hmolar)                  \
+    X(smolar)                  \
+    X(umolar)                  \
+    X(visc)                    \
     X(cond)
 
+/** ***MAGIC WARNING***!! X Macros in use
+ * The derivatives of the properties with respect to the native inputs of the table; they are interpolated by TTSE, and
+ * the bicubic backend only needs them to build its coefficients
+ */
+#define LIST_OF_DERIVATIVE_MATRICES \
+    X(dTdx)                         \
+    X(dTdy)                         \
+    X(dpdx)                         \
+    X(dpdy)                         \
+    X(drhomolardx)                  \
+    X(drhomolardy)                  \
+    X(dhmolardx)                    \
+    X(dhmolardy)                    \
+    X(dsmolardx)                    \
+    X(dsmolardy)                    \
+    X(dumolardx)                    \
+    X(dumolardy)                    \
+    X(d2Tdx2)                       \
+    X(d2Tdxdy)                      \
+    X(d2Tdy2)                       \
+    X(d2pdx2)                       \
+    X(d2pdxdy)                      \
+    X(d2pdy2)                       \
+    X(d2rhomolardx2)                \
+    X(d2rhomolardxdy)               \
+    X(d2rhomolardy2)                \
+    X(d2hmolardx2)                  \
+    X(d2hmolardxdy)                 \
+    X(d2hmolardy2)                  \
+    X(d2smolardx2)                  \
+    X(d2smolardxdy)                 \
+    X(d2smolardy2)                  \
+    X(d2umolardx2)                  \
+    X(d2umolardxdy)                 \
+    X(d2umolardy2)
+
+/** ***MAGIC WARNING***!! X Macros in use
+ * All the matrices of the single-phase tables
+ */
+#define LIST_OF_MATRICES   \
+    LIST_OF_VALUE_MATRICES \
+    LIST_OF_DERIVATIVE_MATRICES
+
 /** ***MAGIC WARNING***!! X Macros in use
  * See http://stackoverflow.com/a/148610
  * See http://stackoverflow.com/questions/147267/easy-way-to-use-variables-of-enum-types-as-string-in-c#202511
@@ -91,6 +105,71 @@
 
 namespace CoolProp {
 
+/// Read a compressed table (.bin.z) and return its uncompressed msgpack contents; throws UnableToLoadError if there is a problem
+std::vector<char> read_packed_table(const std::string& path_to_table);
+/// Compress the msgpack contents of a table and write them to path_to_tables/name.bin.z (and uncompressed to name.bin if SAVE_RAW_TABLES)
+void write_packed_table(const msgpack::sbuffer& sbuf, const std::string& path_to_tables, const std::string& name);
+/**
+ * @brief Find the cubic interpolation stencil around x on a regularly spaced axis
+ * @param t The position on the axis in units of the spacing, (x-xmin)/dx
+ * @param N The number of nodes
+ * @param ibreak A node that the stencil must not straddle, or N if there is none
+ * @param i0 The first of the 4 nodes of the stencil
+ * @param w The Lagrange weights of the 4 nodes
+ * @return false if x is outside the axis
+ */
+bool cubic_stencil(double t, std::size_t N, std::size_t ibreak, std::size_t& i0, double w[4]);
+
+/// The directory in which the tables are cached, either ~/.CoolProp/Tables/ or the ALTERNATIVE_TABLES_DIRECTORY
+inline std::string get_tables_directory() {
+    std::string alt_table_directory = get_config_string(ALTERNATIVE_TABLES_DIRECTORY);
+    if (!alt_table_directory.empty()) {
+        return alt_table_directory;
+    }
+    return get_home_dir() + "/.CoolProp/Tables/";
+}
+
+/**
+ * @brief The minimum and maximum temperature and the maximum pressure of the tables of a backend
+ *
+ * These are the limits of the wrapped backend if it has limits of validity.  For the cubic backends (SRK, PR, VTPR) they are
+ * taken from the (pseudo-)critical point of the fluid.
+ */
+void get_table_limits(AbstractState& AS, CoolPropDbl& Tmin, CoolPropDbl& Tmax, CoolPropDbl& pmax);
+
+/// The memory used by the elements of a matrix, in bytes
+template <typename T>
+std::size_t matrix_footprint(const std::vector<std::vector<T>>& mat) {
+    std::size_t bytes = mat.capacity() * sizeof(std::vector<T>);
+    for (std::size_t i = 0; i < mat.size(); ++i) {
+        bytes += mat[i].capacity() * sizeof(T);
+    }
+    return bytes;
+}
+
+/// Called as the tiles of the single-phase tables are built, with the name of the table, the number of tiles that are done and the total number
+typedef void (*TableBuildProgressCallback)(const std::string& table, std::size_t tiles_done, std::size_t tiles_total);
+/// Set the function that is called as the tiles of the single-phase tables are built; NULL (the default) for none
+void set_table_build_progress_callback(TableBuildProgressCallback callback);
+
+/** \brief The isobars j_begin <= j < j_end of a single-phase table
+ *
+ * The single-phase tables are built in tiles of TABULAR_TILE_ISOBARS isobars, and each tile is written to disk as soon as it
+ * is done, so that an interrupted build resumes from the tiles that were finished.  The limits of the table are stored so that
+ * the tiles of a table with other limits are not used.
+ */
+class SinglePhaseTableTile
+{
+   public:
+    int revision;
+    std::size_t Nx, Ny, j_begin, j_end;
+    double xmin, xmax, ymin, ymax;
+    /// The slices [i][j-j_begin] of the matrices of the table
+    std::map<std::string, std::vector<std::vector<double>>> matrices;
+    SinglePhaseTableTile() : revision(0), Nx(0), Ny(0), j_begin(0), j_end(0), xmin(_HUGE), xmax(_HUGE), ymin(_HUGE), ymax(_HUGE){};
+    MSGPACK_DEFINE(revision, Nx, Ny, j_begin, j_end, xmin, xmax, ymin, ymax, matrices);
+};
+
 class PackablePhaseEnvelopeData : public PhaseEnvelopeData
 {
 
@@ -154,6 +233,9 @@ class PackablePhaseEnvelopeData : public PhaseEnvelopeData
 #define X(name) name = get_matrix_iterator(#name)->second;
         PHASE_ENVELOPE_MATRICES
 #undef X
+        // The maps would otherwise hold a second copy of the data
+        vectors.clear();
+        matrices.clear();
         // Find the index of the point with the highest temperature
         iTsat_max = std::distance(T.begin(), std::max_element(T.begin(), T.end()));
         // Find the index of the point with the highest pressure
@@ -217,9 +299,30 @@ inline void mass_to_molar(parameters& param, double& conversion_factor, double m
     }
 }
 
+/** \brief The cubics through each four consecutive nodes of y(x), which are fitted once rather than at every evaluation
+ *
+ * The cubic through the nodes i0 to i0+3 is stored as four coefficients of the powers of (x - x[i0+2])
+ */
+class SaturationCubics
+{
+   public:
+    std::vector<double> a;
+
+    /// Fit the cubics; those that pass through a node that is not a valid number evaluate to an invalid number
+    void build(const std::vector<double>& x, const std::vector<double>& y);
+    /// The value at val of the cubic through the nodes i0 to i0+3, equal to CubicInterp(x, y, i0, i0 + 1, i0 + 2, i0 + 3, val)
+    double evaluate(const std::vector<double>& x, std::size_t i0, double val) const {
+        const double* c = &(a[4 * i0]);
+        double t = val - x[i0 + 2];
+        return ((c[3] * t + c[2]) * t + c[1]) * t + c[0];
+    }
+};
+
 /** \brief This class holds the data for a two-phase table that is log spaced in p
  *
- * It contains very few members or methods, mostly it just holds the data
+ * It contains very few members or methods, mostly it just holds the data.  Once the table is built or loaded, the cubics
+ * that interpolate the saturated properties are fitted, and the nodes are indexed so that finding the nodes around a
+ * pressure or a temperature takes a fixed number of operations instead of a bisection.
  */
 class PureFluidSaturationTableData
 {
@@ -227,13 +330,76 @@ class PureFluidSaturationTableData
     std::size_t N;
     shared_ptr<CoolProp::AbstractState> AS;
 
+    /// The saturated properties that are interpolated with the cubics
+    enum saturation_property
+    {
+        isat_T,
+        isat_logp,
+        isat_hmolar,
+        isat_smolar,
+        isat_umolar,
+        isat_rhomolar,
+        isat_logrhomolar,
+        isat_cond,
+        isat_logvisc,
+        isat_cpmolar,
+        isat_cvmolar,
+        isat_speed_sound,
+        isat_count
+    };
+    /// cubics[Q][in_T][k] interpolates the property k of the saturated liquid (Q = 0) or vapor (Q = 1) in log(p) (in_T = 0) or in T (in_T = 1)
+    SaturationCubics cubics[2][2][isat_count];
+    /// If the nodes are uniformly spaced in log(p), log(p) at the first node and the spacing; otherwise dlogp is zero
+    double logp_first, dlogp;
+    /// For intervals of uniform width dT[Q] starting at T_first[Q], the last node of the curve Q at or below the start of each interval;
+    /// empty if T is not strictly increasing along the curve
+    std::vector<std::size_t> T_index[2];
+    double T_first[2], dT[2];
+
     PureFluidSaturationTableData() {
         N = 1000;
         revision = 1;
+        logp_first = 0;
+        dlogp = 0;
+        T_first[0] = T_first[1] = 0;
+        dT[0] = dT[1] = 0;
     }
 
     /// Build this table
     void build(shared_ptr<CoolProp::AbstractState>& AS);
+    /// Fit the cubics and index the nodes, once the vectors are filled
+    void prepare_interpolation();
+    /// The index i of the node of the liquid (Q = 0) or vapor (Q = 1) curve such that p or T (main) is between the nodes i and i+1
+    std::size_t node_index(parameters main, int Q, double mainval) const {
+        const std::vector<double>& T = (Q == 0) ? TL : TV;
+        std::size_t i = 0;
+        if (main == iP) {
+            if (dlogp > 0) {
+                double r = (log(mainval) - logp_first) / dlogp;
+                i = (r > 0) ? std::min(static_cast<std::size_t>(r), N - 2) : 0;
+            } else {
+                bisect_vector((Q == 0) ? pL : pV, mainval, i);
+            }
+        } else if (main == iT) {
+            if (!T_index[Q].empty()) {
+                double r = (mainval - T_first[Q]) / dT[Q];
+                i = T_index[Q][(r > 0) ? std::min(static_cast<std::size_t>(r), T_index[Q].size() - 1) : 0];
+                while (i + 2 < N && T[i + 1] <= mainval) {
+                    i++;
+                }
+            } else {
+                bisect_vector(T, mainval, i);
+            }
+        } else {
+            throw ValueError(format("For now, main input in is_inside must be T or p"));
+        }
+        return i;
+    }
+    /// The property k of the saturated liquid (Q = 0) or vapor (Q = 1) at log(p) or T (if in_T) from the cubic through the nodes i0 to i0+3
+    double interpolate(int Q, int in_T, saturation_property k, std::size_t i0, double val) const {
+        const std::vector<double>& x = in_T ? ((Q == 0) ? TL : TV) : ((Q == 0) ? logpL : logpV);
+        return cubics[Q][in_T][k].evaluate(x, i0, val);
+    }
 
 /* Use X macros to auto-generate the variables; each will look something like: std::vector<double> T; */
 #define X(name) std::vector<double> name;
@@ -261,30 +427,37 @@ class PureFluidSaturationTableData
     bool is_inside(parameters main, double mainval, parameters other, double val, std::size_t& iL, std::size_t& iV, CoolPropDbl& yL,
                    CoolPropDbl& yV) {
         std::vector<double>*yvecL = NULL, *yvecV = NULL;
+        saturation_property k;
         switch (other) {
             case iT:
                 yvecL = &TL;
                 yvecV = &TV;
+                k = isat_T;
                 break;
             case iHmolar:
                 yvecL = &hmolarL;
                 yvecV = &hmolarV;
+                k = isat_hmolar;
                 break;
             case iQ:
                 yvecL = &TL;
                 yvecV = &TV;
+                k = isat_T;
                 break;
             case iSmolar:
                 yvecL = &smolarL;
                 yvecV = &smolarV;
+                k = isat_smolar;
                 break;
             case iUmolar:
                 yvecL = &umolarL;
                 yvecV = &umolarV;
+                k = isat_umolar;
                 break;
             case iDmolar:
                 yvecL = &rhomolarL;
                 yvecV = &rhomolarV;
+                k = isat_rhomolar;
                 break;
             default:
                 throw ValueError("invalid input for other in is_inside");
@@ -312,15 +485,10 @@ class PureFluidSaturationTableData
         // Find the indices (iL,iL+1) & (iV,iV+1) that bound the given pressure
         // In general iV and iL will be the same, but if pseudo-pure, they might
         // be different
-        if (main == iP) {
-            bisect_vector(pV, mainval, iV);
-            bisect_vector(pL, mainval, iL);
-        } else if (main == iT) {
-            bisect_vector(TV, mainval, iV);
-            bisect_vector(TL, mainval, iL);
-        } else {
-            throw ValueError(format("For now, main input in is_inside must be T or p"));
-        }
+        iV = node_index(main, 1, mainval);
+        iL = node_index(main, 0, mainval);
+        const int in_T = (main == iT) ? 1 : 0;
+        const double x = in_T ? mainval : log(mainval);
 
         iVplus = std::min(iV + 1, N - 1);
         iLplus = std::min(iL + 1, N - 1);
@@ -333,14 +501,13 @@ class PureFluidSaturationTableData
                 iLplus = 3;
             }
             if (main == iP) {
-                double logp = log(mainval);
                 // Calculate temperature
-                yV = CubicInterp(logpV, TV, iVplus - 3, iVplus - 2, iVplus - 1, iVplus, logp);
-                yL = CubicInterp(logpL, TL, iLplus - 3, iLplus - 2, iLplus - 1, iLplus, logp);
+                yV = interpolate(1, in_T, isat_T, iVplus - 3, x);
+                yL = interpolate(0, in_T, isat_T, iLplus - 3, x);
             } else if (main == iT) {
                 // Calculate pressure
-                yV = exp(CubicInterp(TV, logpV, iVplus - 3, iVplus - 2, iVplus - 1, iVplus, mainval));
-                yL = exp(CubicInterp(TL, logpL, iLplus - 3, iLplus - 2, iLplus - 1, iLplus, mainval));
+                yV = exp(interpolate(1, in_T, isat_logp, iVplus - 3, x));
+                yL = exp(interpolate(0, in_T, isat_logp, iLplus - 3, x));
             }
             return true;
         }
@@ -357,14 +524,8 @@ class PureFluidSaturationTableData
         if (iLplus < 3) {
             iLplus = 3;
         }
-        if (main == iP) {
-            double logp = log(mainval);
-            yV = CubicInterp(logpV, *yvecV, iVplus - 3, iVplus - 2, iVplus - 1, iVplus, logp);
-            yL = CubicInterp(logpL, *yvecL, iLplus - 3, iLplus - 2, iLplus - 1, iLplus, logp);
-        } else if (main == iT) {
-            yV = CubicInterp(TV, *yvecV, iVplus - 3, iVplus - 2, iVplus - 1, iVplus, mainval);
-            yL = CubicInterp(TL, *yvecL, iLplus - 3, iLplus - 2, iLplus - 1, iLplus, mainval);
-        }
+        yV = interpolate(1, in_T, k, iVplus - 3, x);
+        yL = interpolate(0, in_T, k, iLplus - 3, x);
 
         if (!is_in_closed_range(yV, yL, static_cast<CoolPropDbl>(val))) {
             return false;
@@ -403,7 +564,9 @@ class PureFluidSaturationTableData
 #define X(name) name = get_vector_iterator(#name)->second;
         LIST_OF_SATURATION_VECTORS
 #undef X
+        vectors.clear();
         N = TL.size();
+        prepare_interpolation();
     };
     void deserialize(msgpack::object& deserialized) {
         PureFluidSaturationTableData temp;
@@ -431,33 +594,33 @@ class PureFluidSaturationTableData
         double logp = log(p_or_T);
         switch (output) {
             case iP: {
-                double _logpV = CubicInterp(this->TV, logpV, iV - 2, iV - 1, iV, iV + 1, p_or_T);
-                double _logpL = CubicInterp(this->TL, logpL, iL - 2, iL - 1, iL, iL + 1, p_or_T);
+                double _logpV = interpolate(1, 1, isat_logp, iV - 2, p_or_T);
+                double _logpL = interpolate(0, 1, isat_logp, iL - 2, p_or_T);
                 return Q * exp(_logpV) + (1 - Q) * exp(_logpL);
             }
             case iT: {
-                double TV = CubicInterp(logpV, this->TV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double TL = CubicInterp(logpL, this->TL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double TV = interpolate(1, 0, isat_T, iV - 2, logp);
+                double TL = interpolate(0, 0, isat_T, iL - 2, logp);
                 return Q * TV + (1 - Q) * TL;
             }
             case iSmolar: {
-                double sV = CubicInterp(logpV, smolarV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double sL = CubicInterp(logpL, smolarL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double sV = interpolate(1, 0, isat_smolar, iV - 2, logp);
+                double sL = interpolate(0, 0, isat_smolar, iL - 2, logp);
                 return Q * sV + (1 - Q) * sL;
             }
             case iHmolar: {
-                double hV = CubicInterp(logpV, hmolarV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double hL = CubicInterp(logpL, hmolarL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double hV = interpolate(1, 0, isat_hmolar, iV - 2, logp);
+                double hL = interpolate(0, 0, isat_hmolar, iL - 2, logp);
                 return Q * hV + (1 - Q) * hL;
             }
             case iUmolar: {
-                double uV = CubicInterp(logpV, umolarV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double uL = CubicInterp(logpL, umolarL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double uV = interpolate(1, 0, isat_umolar, iV - 2, logp);
+                double uL = interpolate(0, 0, isat_umolar, iL - 2, logp);
                 return Q * uV + (1 - Q) * uL;
             }
             case iDmolar: {
-                double rhoV = exp(CubicInterp(logpV, logrhomolarV, iV - 2, iV - 1, iV, iV + 1, logp));
-                double rhoL = exp(CubicInterp(logpL, logrhomolarL, iL - 2, iL - 1, iL, iL + 1, logp));
+                double rhoV = exp(interpolate(1, 0, isat_logrhomolar, iV - 2, logp));
+                double rhoL = exp(interpolate(0, 0, isat_logrhomolar, iL - 2, logp));
                 if (!ValidNumber(rhoV)) {
                     throw ValueError("rhoV is invalid");
                 }
@@ -467,8 +630,8 @@ class PureFluidSaturationTableData
                 return 1 / (Q / rhoV + (1 - Q) / rhoL);
             }
             case iconductivity: {
-                double kV = CubicInterp(logpV, condV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double kL = CubicInterp(logpL, condL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double kV = interpolate(1, 0, isat_cond, iV - 2, logp);
+                double kL = interpolate(0, 0, isat_cond, iL - 2, logp);
                 if (!ValidNumber(kV)) {
                     throw ValueError("kV is invalid");
                 }
@@ -478,8 +641,8 @@ class PureFluidSaturationTableData
                 return Q * kV + (1 - Q) * kL;
             }
             case iviscosity: {
-                double muV = exp(CubicInterp(logpV, logviscV, iV - 2, iV - 1, iV, iV + 1, logp));
-                double muL = exp(CubicInterp(logpL, logviscL, iL - 2, iL - 1, iL, iL + 1, logp));
+                double muV = exp(interpolate(1, 0, isat_logvisc, iV - 2, logp));
+                double muL = exp(interpolate(0, 0, isat_logvisc, iL - 2, logp));
                 if (!ValidNumber(muV)) {
                     throw ValueError("muV is invalid");
                 }
@@ -489,8 +652,8 @@ class PureFluidSaturationTableData
                 return 1 / (Q / muV + (1 - Q) / muL);
             }
             case iCpmolar: {
-                double cpV = CubicInterp(logpV, cpmolarV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double cpL = CubicInterp(logpL, cpmolarL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double cpV = interpolate(1, 0, isat_cpmolar, iV - 2, logp);
+                double cpL = interpolate(0, 0, isat_cpmolar, iL - 2, logp);
                 if (!ValidNumber(cpV)) {
                     throw ValueError("cpV is invalid");
                 }
@@ -500,8 +663,8 @@ class PureFluidSaturationTableData
                 return Q * cpV + (1 - Q) * cpL;
             }
             case iCvmolar: {
-                double cvV = CubicInterp(logpV, cvmolarV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double cvL = CubicInterp(logpL, cvmolarL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double cvV = interpolate(1, 0, isat_cvmolar, iV - 2, logp);
+                double cvL = interpolate(0, 0, isat_cvmolar, iL - 2, logp);
                 if (!ValidNumber(cvV)) {
                     throw ValueError("cvV is invalid");
                 }
@@ -511,8 +674,8 @@ class PureFluidSaturationTableData
                 return Q * cvV + (1 - Q) * cvL;
             }
             case ispeed_sound: {
-                double wV = CubicInterp(logpV, speed_soundV, iV - 2, iV - 1, iV, iV + 1, logp);
-                double wL = CubicInterp(logpL, speed_soundL, iL - 2, iL - 1, iL, iL + 1, logp);
+                double wV = interpolate(1, 0, isat_speed_sound, iV - 2, logp);
+                double wL = interpolate(0, 0, isat_speed_sound, iL - 2, logp);
                 if (!ValidNumber(wV)) {
                     throw ValueError("wV is invalid");
                 }
@@ -605,7 +768,8 @@ class SinglePhaseGriddedTableData
     CoolProp::parameters xkey, ykey;
     shared_ptr<CoolProp::AbstractState> AS;
     std::vector<double> xvec, yvec;
-    std::vector<std::vector<std::size_t>> nearest_neighbor_i, nearest_neighbor_j;
+    /// The indices of the nearest good node of each node; 16 bits are plenty since a table of 65536 nodes on a side could not be held in memory
+    std::vector<std::vector<uint16_t>> nearest_neighbor_i, nearest_neighbor_j;
     bool logx, logy;
     double xmin, ymin, xmax, ymax;
 
@@ -623,6 +787,8 @@ class SinglePhaseGriddedTableData
         xmax = _HUGE;
         ymin = _HUGE;
         ymax = _HUGE;
+        derivatives_released = false;
+        isobars_per_tile = 0;
     }
 
 /* Use X macros to auto-generate the variables; each will look something like: std::vector< std::vector<double> > T; */
@@ -631,10 +797,115 @@ class SinglePhaseGriddedTableData
 #undef X
     int revision;
     std::map<std::string, std::vector<std::vector<double>>> matrices;
+    /// True if the derivative matrices have been released with release_derivatives()
+    bool derivatives_released;
+    /// The number of isobars in each tile, and whether each of the tiles has been built
+    std::size_t isobars_per_tile;
+    std::vector<bool> tiles_built;
     /// Build this table
     void build(shared_ptr<CoolProp::AbstractState>& AS);
+    /**
+     * @brief Build this table tile by tile
+     * @param AS The state that the table is built with
+     * @param path_to_tables The directory where the tiles are checkpointed, which is also where they are resumed from; no checkpoints if empty
+     * @param name The name of the table, which is the start of the names of the files of the tiles
+     * @param lazy If true, only the axes are made, and the tiles are built by build_tiles() when they are needed
+     */
+    void build(shared_ptr<CoolProp::AbstractState>& AS, const std::string& path_to_tables, const std::string& name, bool lazy);
+    /// Build (or load the checkpoints of) the tiles that hold the isobars j_begin <= j < j_end and are not built yet;
+    /// returns the number of such tiles
+    std::size_t build_tiles(shared_ptr<CoolProp::AbstractState>& AS, const std::string& path_to_tables, const std::string& name, std::size_t j_begin,
+                            std::size_t j_end);
+    /// Calculate the nodes of the isobars j_begin <= j < j_end
+    void build_isobars(shared_ptr<CoolProp::AbstractState>& AS, std::size_t j_begin, std::size_t j_end);
+    /// Calculate the derivatives at the node (i,j) from the state AS, which must be the state of the node
+    void calculate_derivatives(shared_ptr<CoolProp::AbstractState>& AS, std::size_t i, std::size_t j);
+    /// Calculate the derivative matrices and the nearest good neighbors again from the values of the nodes, after release_derivatives()
+    void rebuild_derivatives(shared_ptr<CoolProp::AbstractState>& AS);
+    /// Remove the checkpoints of the tiles of the table, once the whole table has been written
+    void remove_tile_checkpoints(const std::string& path_to_tables, const std::string& name) const;
+    /// The number of tiles of the table
+    std::size_t tile_count() const {
+        return isobars_per_tile == 0 ? 0 : (Ny + isobars_per_tile - 1) / isobars_per_tile;
+    }
+    /// True if all the tiles of the table are built (which is always the case for a table that was loaded)
+    bool all_tiles_built() const {
+        return std::find(tiles_built.begin(), tiles_built.end(), false) == tiles_built.end();
+    }
+    /// The index of the isobar at or just below y, limited to the isobars of the table
+    std::size_t isobar_index(double y) const {
+        std::size_t j = 0;
+        if (y > yvec[0]) {
+            bisect_vector(yvec, y, j);
+        }
+        return std::min(j, Ny - 1);
+    }
 
     MSGPACK_DEFINE(revision, matrices, xmin, xmax, ymin, ymax);  // write the member variables that you want to pack
+    /// Copy the isobars of tile k into a tile
+    void pack_tile(std::size_t k, SinglePhaseTableTile& tile) const {
+        tile.revision = revision;
+        tile.Nx = Nx;
+        tile.Ny = Ny;
+        tile.j_begin = k * isobars_per_tile;
+        tile.j_end = std::min(Ny, tile.j_begin + isobars_per_tile);
+        tile.xmin = xmin;
+        tile.xmax = xmax;
+        tile.ymin = ymin;
+        tile.ymax = ymax;
+/* Use X macros to auto-generate the packing code; each will look something like: slice_isobars(T, j_begin, j_end, tile.matrices["T"]); */
+#define X(name) slice_isobars(name, tile.j_begin, tile.j_end, tile.matrices[#name]);
+        LIST_OF_MATRICES
+#undef X
+    }
+    /// Copy the isobars of a tile into the table; returns false if the tile does not belong to this table
+    bool unpack_tile(const SinglePhaseTableTile& tile) {
+        if (tile.revision < revision || tile.Nx != Nx || tile.Ny != Ny || tile.j_end > Ny || tile.j_begin % isobars_per_tile != 0
+            || tile.j_end != std::min(Ny, tile.j_begin + isobars_per_tile) || tile.xmin != xmin || tile.xmax != xmax || tile.ymin != ymin
+            || tile.ymax != ymax) {
+            return false;
+        }
+/* Use X macros to check that all the matrices are there and have the right size */
+#define X(name)                                                                   \
+    if (!slice_has_size(tile.matrices, #name, Nx, tile.j_end - tile.j_begin)) { \
+        return false;                                                             \
+    }
+        LIST_OF_MATRICES
+#undef X
+/* Use X macros to auto-generate the unpacking code; each will look something like: unslice_isobars(tile.matrices.find("T")->second, j_begin, T); */
+#define X(name) unslice_isobars(tile.matrices.find(#name)->second, tile.j_begin, name);
+        LIST_OF_MATRICES
+#undef X
+        return true;
+    }
+    /// Returns true if the slice of the matrix called name is in the map and has Nx rows of Ncols columns
+    static bool slice_has_size(const std::map<std::string, std::vector<std::vector<double>>>& slices, const std::string& name, std::size_t Nx,
+                               std::size_t Ncols) {
+        std::map<std::string, std::vector<std::vector<double>>>::const_iterator it = slices.find(name);
+        if (it == slices.end() || it->second.size() != Nx) {
+            return false;
+        }
+        for (std::size_t i = 0; i < Nx; ++i) {
+            if (it->second[i].size() != Ncols) {
+                return false;
+            }
+        }
+        return true;
+    }
+    /// Copy the columns j_begin <= j < j_end of a matrix
+    static void slice_isobars(const std::vector<std::vector<double>>& mat, std::size_t j_begin, std::size_t j_end,
+                              std::vector<std::vector<double>>& slice) {
+        slice.resize(mat.size());
+        for (std::size_t i = 0; i < mat.size(); ++i) {
+            slice[i].assign(mat[i].begin() + j_begin, mat[i].begin() + j_end);
+        }
+    }
+    /// Copy a slice of columns back into a matrix, starting at column j_begin
+    static void unslice_isobars(const std::vector<std::vector<double>>& slice, std::size_t j_begin, std::vector<std::vector<double>>& mat) {
+        for (std::size_t i = 0; i < slice.size(); ++i) {
+            std::copy(slice[i].begin(), slice[i].end(), mat[i].begin() + j_begin);
+        }
+    }
     /// Resize all the matrices
     void resize(std::size_t Nx, std::size_t Ny) {
 /* Use X macros to auto-generate the code; each will look something like: T.resize(Nx, std::vector<double>(Ny, _HUGE)); */
@@ -658,12 +929,15 @@ class SinglePhaseGriddedTableData
     };
     /// Make matrices of good neighbors if the current value for i,j corresponds to a bad node
     void make_good_neighbors(void) {
-        nearest_neighbor_i.resize(Nx, std::vector<std::size_t>(Ny, std::numeric_limits<std::size_t>::max()));
-        nearest_neighbor_j.resize(Nx, std::vector<std::size_t>(Ny, std::numeric_limits<std::size_t>::max()));
+        if (Nx > std::numeric_limits<uint16_t>::max() || Ny > std::numeric_limits<uint16_t>::max()) {
+            throw ValueError(format("The table [%dx%d] is too large for 16-bit neighbor indices", Nx, Ny));
+        }
+        nearest_neighbor_i.assign(Nx, std::vector<uint16_t>(Ny, std::numeric_limits<uint16_t>::max()));
+        nearest_neighbor_j.assign(Nx, std::vector<uint16_t>(Ny, std::numeric_limits<uint16_t>::max()));
         for (std::size_t i = 0; i < xvec.size(); ++i) {
             for (std::size_t j = 0; j < yvec.size(); ++j) {
-                nearest_neighbor_i[i][j] = i;
-                nearest_neighbor_j[i][j] = j;
+                nearest_neighbor_i[i][j] = static_cast<uint16_t>(i);
+                nearest_neighbor_j[i][j] = static_cast<uint16_t>(j);
                 if (!ValidNumber(T[i][j])) {
                     int xoffsets[] = {-1, 1, 0, 0, -1, 1, 1, -1};
                     int yoffsets[] = {0, 0, 1, -1, -1, -1, 1, 1};
@@ -673,8 +947,8 @@ class SinglePhaseGriddedTableData
                         std::size_t iplus = i + xoffsets[k];
                         std::size_t jplus = j + yoffsets[k];
                         if (0 < iplus && iplus < Nx - 1 && 0 < jplus && jplus < Ny - 1 && ValidNumber(T[iplus][jplus])) {
-                            nearest_neighbor_i[i][j] = iplus;
-                            nearest_neighbor_j[i][j] = jplus;
+                            nearest_neighbor_i[i][j] = static_cast<uint16_t>(iplus);
+                            nearest_neighbor_j[i][j] = static_cast<uint16_t>(jplus);
                             break;
                         }
                     }
@@ -698,15 +972,37 @@ class SinglePhaseGriddedTableData
     }
     /// Take all the matrices that are in the class and pack them into the matrices map for easy unpacking using msgpack
     void unpack() {
-/* Use X macros to auto-generate the unpacking code; each will look something like: T = *(matrices.find("T")).second */
-#define X(name) name = get_matrices_iterator(#name)->second;
+/* Use X macros to auto-generate the unpacking code; each will look something like: T.swap(matrices.find("T")->second) */
+#define X(name) name.swap(get_matrices_iterator(#name)->second);
         LIST_OF_MATRICES
 #undef X
+        // The map would otherwise hold a second copy of the tables
+        matrices.clear();
         Nx = T.size();
         Ny = T[0].size();
         make_axis_vectors();
         make_good_neighbors();
+        derivatives_released = false;
     };
+    /// Release the derivative matrices and the nearest good neighbors, which the bicubic backend does not use once its coefficients are built
+    void release_derivatives() {
+/* Use X macros to auto-generate the code; each will look something like: std::vector<std::vector<double> >().swap(dTdx); */
+#define X(name) std::vector<std::vector<double>>().swap(name);
+        LIST_OF_DERIVATIVE_MATRICES
+#undef X
+        std::vector<std::vector<uint16_t>>().swap(nearest_neighbor_i);
+        std::vector<std::vector<uint16_t>>().swap(nearest_neighbor_j);
+        derivatives_released = true;
+    }
+    /// The memory used by the matrices of the table, in bytes
+    std::size_t memory_footprint() const {
+        std::size_t bytes = 0;
+/* Use X macros to auto-generate the code; each will look something like: bytes += matrix_footprint(T); */
+#define X(name) bytes += matrix_footprint(name);
+        LIST_OF_MATRICES
+#undef X
+        return bytes + matrix_footprint(nearest_neighbor_i) + matrix_footprint(nearest_neighbor_j);
+    }
     /// Check that the native inputs (the inputs the table is based on) are in range
     bool native_inputs_are_in_range(double x, double y) {
         double e = 10 * DBL_EPSILON;
@@ -829,20 +1125,21 @@ class LogPHTable : public SinglePhaseGriddedTableData
         if (this->AS.get() == NULL) {
             throw ValueError("AS is not yet set");
         }
-        CoolPropDbl Tmin = std::max(AS->Ttriple(), AS->Tmin());
+        CoolPropDbl Tmin, Tmax, pmax;
+        get_table_limits(*AS, Tmin, Tmax, pmax);
         // Minimum enthalpy is the saturated liquid enthalpy
         AS->update(QT_INPUTS, 0, Tmin);
         xmin = AS->hmolar();
         ymin = AS->p();
 
         // Check both the enthalpies at the Tmax isotherm to see whether to use low or high pressure
-        AS->update(DmolarT_INPUTS, 1e-10, 1.499 * AS->Tmax());
+        AS->update(DmolarT_INPUTS, 1e-10, 1.499 * Tmax);
         CoolPropDbl xmax1 = AS->hmolar();
-        AS->update(PT_INPUTS, AS->pmax(), 1.499 * AS->Tmax());
+        AS->update(PT_INPUTS, pmax, 1.499 * Tmax);
         CoolPropDbl xmax2 = AS->hmolar();
         xmax = std::max(xmax1, xmax2);
 
-        ymax = AS->pmax();
+        ymax = pmax;
     }
     void deserialize(msgpack::object& deserialized) {
         LogPHTable temp;
@@ -881,13 +1178,14 @@ class LogPTTable : public SinglePhaseGriddedTableData
         if (this->AS.get() == NULL) {
             throw ValueError("AS is not yet set");
         }
-        CoolPropDbl Tmin = std::max(AS->Ttriple(), AS->Tmin());
+        CoolPropDbl Tmin, Tmax, pmax;
+        get_table_limits(*AS, Tmin, Tmax, pmax);
         AS->update(QT_INPUTS, 0, Tmin);
         xmin = Tmin;
         ymin = AS->p();
 
-        xmax = AS->Tmax() * 1.499;
-        ymax = AS->pmax();
+        xmax = Tmax * 1.499;
+        ymax = pmax;
     }
     void deserialize(msgpack::object& deserialized) {
         LogPTTable temp;
@@ -911,11 +1209,37 @@ class LogPTTable : public SinglePhaseGriddedTableData
 
 /// This structure holds the coefficients for one cell, the coefficients are stored in matrices
 /// and can be obtained by the get() function.
+///
+/// The 16 coefficients of each of the properties that are set are stored one after the other in a single array, in double
+/// precision or, after convert_to_float32(), in single precision
 class CellCoeffs
 {
    private:
-    std::size_t alt_i, alt_j;
+    uint16_t alt_i, alt_j;
     bool _valid, _has_valid_neighbor;
+    /// The position of the coefficients of T, p, rhomolar, hmolar, smolar and umolar in the array of coefficients, or -1 if not set
+    signed char offset[6];
+    std::vector<double> alpha;
+    std::vector<float> alpha32;
+    /// The index in offset of a property
+    static std::size_t slot(parameters params, const char* function) {
+        switch (params) {
+            case iT:
+                return 0;
+            case iP:
+                return 1;
+            case iDmolar:
+                return 2;
+            case iHmolar:
+                return 3;
+            case iSmolar:
+                return 4;
+            case iUmolar:
+                return 5;
+            default:
+                throw KeyError(format("Invalid key to %s() function of CellCoeffs", function));
+        }
+    }
 
    public:
     double dx_dxhat, dy_dyhat;
@@ -924,54 +1248,57 @@ class CellCoeffs
         _has_valid_neighbor = false;
         dx_dxhat = _HUGE;
         dy_dyhat = _HUGE;
-        alt_i = 9999999;
-        alt_j = 9999999;
+        alt_i = std::numeric_limits<uint16_t>::max();
+        alt_j = std::numeric_limits<uint16_t>::max();
+        std::fill(offset, offset + 6, -1);
     }
-    std::vector<double> T, rhomolar, hmolar, p, smolar, umolar;
-    /// Return a const reference to the desired matrix
-    const std::vector<double>& get(const parameters params) const {
-        switch (params) {
-            case iT:
-                return T;
-            case iP:
-                return p;
-            case iDmolar:
-                return rhomolar;
-            case iHmolar:
-                return hmolar;
-            case iSmolar:
-                return smolar;
-            case iUmolar:
-                return umolar;
-            default:
-                throw KeyError(format("Invalid key to get() function of CellCoeffs"));
+    /// Returns true if the coefficients of the property have been set
+    bool has(const parameters params) const {
+        return offset[slot(params, "has")] >= 0;
+    }
+    /// Copy the 16 coefficients of the desired property into a
+    void get(const parameters params, double a[16]) const {
+        int k = offset[slot(params, "get")];
+        if (k < 0) {
+            throw KeyError(format("Invalid key to get() function of CellCoeffs"));
+        }
+        if (alpha.empty()) {
+            std::copy(alpha32.begin() + 16 * k, alpha32.begin() + 16 * (k + 1), a);
+        } else {
+            std::copy(alpha.begin() + 16 * k, alpha.begin() + 16 * (k + 1), a);
         }
     };
-    /// Set one of the matrices in this class
+    /// Set the 16 coefficients of one of the properties
     void set(parameters params, const std::vector<double>& mat) {
-        switch (params) {
-            case iT:
-                T = mat;
-                break;
-            case iP:
-                p = mat;
-                break;
-            case iDmolar:
-                rhomolar = mat;
-                break;
-            case iHmolar:
-                hmolar = mat;
-                break;
-            case iSmolar:
-                smolar = mat;
-                break;
-            case iUmolar:
-                umolar = mat;
-                break;
-            default:
-                throw KeyError(format("Invalid key to set() function of CellCoeffs"));
+        std::size_t s = slot(params, "set");
+        if (mat.size() != 16) {
+            throw ValueError(format("There must be 16 coefficients in set() function of CellCoeffs; there are %d", mat.size()));
+        }
+        if (!alpha32.empty()) {
+            throw ValueError("The coefficients of the cell have already been converted to single precision");
+        }
+        if (offset[s] < 0) {
+            offset[s] = static_cast<signed char>(alpha.size() / 16);
+            alpha.insert(alpha.end(), mat.begin(), mat.end());
+        } else {
+            std::copy(mat.begin(), mat.end(), alpha.begin() + 16 * offset[s]);
         }
     };
+    /// Reserve the memory for the coefficients of count properties; exactly as much as is needed, since each cell holds only a few
+    void reserve(std::size_t count) {
+        alpha.reserve(16 * count);
+    }
+    /// Store the coefficients in single precision, which halves their memory
+    void convert_to_float32() {
+        if (!alpha.empty()) {
+            std::vector<float>(alpha.begin(), alpha.end()).swap(alpha32);
+            std::vector<double>().swap(alpha);
+        }
+    }
+    /// The memory used by the cell, in bytes
+    std::size_t memory_footprint() const {
+        return sizeof(CellCoeffs) + alpha.capacity() * sizeof(double) + alpha32.capacity() * sizeof(float);
+    }
     /// Returns true if the cell coefficients seem to have been calculated properly
     bool valid() const {
         return _valid;
@@ -986,8 +1313,8 @@ class CellCoeffs
     };
     /// Set the neighboring (alternate) cell to be used if the cell is invalid
     void set_alternate(std::size_t i, std::size_t j) {
-        alt_i = i;
-        alt_j = j;
+        alt_i = static_cast<uint16_t>(i);
+        alt_j = static_cast<uint16_t>(j);
         _has_valid_neighbor = true;
     }
     /// Get neighboring(alternate) cell to be used if this cell is invalid
@@ -1015,18 +1342,64 @@ class TabularDataSet
     PureFluidSaturationTableData pure_saturation;
     PackablePhaseEnvelopeData phase_envelope;
     std::vector<std::vector<CellCoeffs>> coeffs_ph, coeffs_pT;
+    /// True if a TTSE backend uses this set, and the derivative matrices must therefore be kept
+    bool derivatives_in_use;
+    /// The directory where the tiles of the single-phase tables are checkpointed; empty for none
+    std::string tiles_path;
 
     TabularDataSet() {
         tables_loaded = false;
+        derivatives_in_use = false;
     }
     /// Write the tables to files on the computer
     void write_tables(const std::string& path_to_tables);
     /// Load the tables from file
     void load_tables(const std::string& path_to_tables, shared_ptr<CoolProp::AbstractState>& AS);
-    /// Build the tables (single-phase PH, single-phase PT, phase envelope, etc.)
-    void build_tables(shared_ptr<CoolProp::AbstractState>& AS);
+    /// Build the tables (single-phase PH, single-phase PT, phase envelope, etc.), checkpointing the tiles of the single-phase tables
+    /// in path_to_tables if it is not empty; if TABULAR_LAZY_TILES is true, the tiles are left to ensure_tiles()
+    void build_tables(shared_ptr<CoolProp::AbstractState>& AS, const std::string& path_to_tables = "");
+    /// True if all the tiles of the single-phase tables have been built
+    bool tables_complete() const {
+        return single_phase_logph.all_tiles_built() && single_phase_logpT.all_tiles_built();
+    }
+    /**
+     * @brief Build the tiles of a single-phase table that are needed around the isobar at y, and update its bicubic coefficients
+     * @param AS The AbstractState that is used to build the tiles
+     * @param table The table, either single_phase_logph or single_phase_logpT
+     * @param coeffs The bicubic coefficients of the table, which are built again if they are not empty
+     * @param y The pressure; if it is not a valid number, all the tiles are built
+     * @return True if any tile was built
+     *
+     * Once the last tile is built, the tables are written to tiles_path and the checkpoints of the tiles are removed
+     */
+    bool ensure_tiles(shared_ptr<CoolProp::AbstractState>& AS, SinglePhaseGriddedTableData& table, std::vector<std::vector<CellCoeffs>>& coeffs,
+                      double y);
+    /// Remove the checkpoints of the tiles of the single-phase tables
+    void remove_tile_checkpoints();
     /// Build the \f$a_{i,j}\f$ coefficients for bicubic interpolation
     void build_coeffs(SinglePhaseGriddedTableData& table, std::vector<std::vector<CellCoeffs>>& coeffs);
+    /// Release the derivative matrices of the single-phase tables, which are only needed to build the bicubic coefficients
+    void release_derivatives() {
+        single_phase_logph.release_derivatives();
+        single_phase_logpT.release_derivatives();
+    }
+    /// Calculate the derivative matrices of the single-phase tables again in memory if they were released
+    void rebuild_derivatives(shared_ptr<CoolProp::AbstractState>& AS) {
+        if (single_phase_logph.derivatives_released) {
+            single_phase_logph.rebuild_derivatives(AS);
+        }
+        if (single_phase_logpT.derivatives_released) {
+            single_phase_logpT.rebuild_derivatives(AS);
+        }
+    }
+    /**
+     * @brief Store the bicubic coefficients in single precision
+     * @return The largest error that this introduces in a property at the corners of the cells, relative to the largest magnitude of that
+     * property in the table
+     */
+    double convert_coeffs_to_float32();
+    /// The memory used by the tables and the bicubic coefficients, in bytes
+    std::size_t memory_footprint() const;
 };
 
 class TabularDataLibrary
@@ -1043,17 +1416,17 @@ class TabularDataLibrary
         for (std::size_t i = 0; i < fluids.size(); ++i) {
             components.push_back(format("%s[%0.10Lf]", fluids[i].c_str(), fractions[i]));
         }
-        std::string table_directory = get_home_dir() + "/.CoolProp/Tables/";
-        std::string alt_table_directory = get_config_string(ALTERNATIVE_TABLES_DIRECTORY);
-        if (!alt_table_directory.empty()) {
-            table_directory = alt_table_directory;
-        }
-        return table_directory + AS->backend_name() + "(" + strjoin(components, "&") + ")";
+        return get_tables_directory() + AS->backend_name() + "(" + strjoin(components, "&") + ")";
     }
     /// Return a pointer to the set of tabular datasets
     TabularDataSet* get_set_of_tables(shared_ptr<AbstractState>& AS, bool& loaded);
+    /// The memory used by each of the sets of tables, in bytes, keyed by the path to the tables
+    std::map<std::string, std::size_t> memory_footprints() const;
 };
 
+/// The memory used by each of the sets of tables of the tabular backends, in bytes, keyed by the path to the tables
+std::map<std::string, std::size_t> get_tabular_memory_footprints();
+
 /**
  * @brief This class contains the general code for tabular backends (TTSE, bicubic, etc.)
  *
@@ -1099,6 +1472,10 @@ class TabularBackend : public AbstractState
         d2zdy2 = NULL;
         dataset = NULL;
         imposed_phase_index = iphase_not_imposed;
+        if (this->AS->backend_name() == get_backend_string(PCSAFT_BACKEND)) {
+            // The tables are built on the enthalpy, which PC-SAFT cannot calculate since it has no ideal-gas part
+            throw NotImplementedError("The tabular backends cannot wrap the PCSAFT backend");
+        }
     };
 
     // None of the tabular methods are available from the high-level interface
@@ -1202,6 +1579,23 @@ class TabularBackend : public AbstractState
         imposed_phase_index = iphase_not_imposed;
     };
 
+    /**\brief The memory used by this instance, without the tables, which are shared by all the instances for the same fluid
+        */
+    std::size_t calc_memory_footprint(void) {
+        return AbstractState::calc_memory_footprint() + sizeof(TabularBackend) - sizeof(AbstractState)
+               + mole_fractions.capacity() * sizeof(CoolPropDbl);
+    };
+    /**\brief The state that the tables are built with, and that is used outside the tables
+        */
+    void calc_child_states(std::vector<AbstractState*>& children) {
+        children.push_back(AS.get());
+    };
+    /**\brief The state variables, the selected table and the cached indices of the cells, so that the outputs are interpolated in
+        * the same cells as before; the composition of a mixture is only stored to check it against that of the tables
+        */
+    void calc_snapshot(std::vector<double>& buffer);
+    void calc_restore(const std::vector<double>& buffer, std::size_t& i);
+
     virtual double evaluate_single_phase_phmolar(parameters output, std::size_t i, std::size_t j) = 0;
     virtual double evaluate_single_phase_pT(parameters output, std::size_t i, std::size_t j) = 0;
     virtual double evaluate_single_phase_phmolar_transport(parameters output, std::size_t i, std::size_t j) = 0;
@@ -1230,19 +1624,35 @@ class TabularBackend : public AbstractState
         return this->AS->T_critical();
     };
     CoolPropDbl calc_Ttriple(void) {
-        return this->AS->Ttriple();
+        return this->AS->has_limits_of_validity() ? this->AS->Ttriple() : calc_Tmin();
     };
     CoolPropDbl calc_p_triple(void) {
-        return this->AS->p_triple();
+        // The saturation pressure at the minimum temperature of the tables
+        return this->AS->has_limits_of_validity() ? this->AS->p_triple() : dataset->single_phase_logpT.ymin;
     };
     CoolPropDbl calc_pmax(void) {
-        return this->AS->pmax();
+        if (this->AS->has_limits_of_validity()) {
+            return this->AS->pmax();
+        }
+        CoolPropDbl Tmin, Tmax, pmax;
+        get_table_limits(*this->AS, Tmin, Tmax, pmax);
+        return pmax;
     };
     CoolPropDbl calc_Tmax(void) {
-        return this->AS->Tmax();
+        if (this->AS->has_limits_of_validity()) {
+            return this->AS->Tmax();
+        }
+        CoolPropDbl Tmin, Tmax, pmax;
+        get_table_limits(*this->AS, Tmin, Tmax, pmax);
+        return Tmax;
     };
     CoolPropDbl calc_Tmin(void) {
-        return this->AS->Tmin();
+        if (this->AS->has_limits_of_validity()) {
+            return this->AS->Tmin();
+        }
+        CoolPropDbl Tmin, Tmax, pmax;
+        get_table_limits(*this->AS, Tmin, Tmax, pmax);
+        return Tmin;
     };
     CoolPropDbl calc_p_critical(void) {
         return this->AS->p_critical();
@@ -1284,6 +1694,12 @@ class TabularBackend : public AbstractState
     std::string path_to_tables(void);
     /// Load the tables from file; throws UnableToLoadException if there is a problem
     void load_tables();
+    /// Build the coefficients that the bicubic backend needs, and then drop what it does not need if TABULAR_COMPACT_STORAGE is set
+    void prepare_bicubic_storage();
+    /// Build the tiles of the single-phase tables that are needed for the inputs, if the tables are built lazily
+    void ensure_tiles(CoolProp::input_pairs input_pair, double val1, double val2);
+    /// Make sure that the derivative matrices that the TTSE backend needs are in memory, calculating them again if they were released
+    void prepare_TTSE_storage();
     void pack_matrices() {
         PackablePhaseEnvelopeData& phase_envelope = dataset->phase_envelope;
         PureFluidSaturationTableData& pure_saturation = dataset->pure_saturation;
@@ -1363,11 +1779,14 @@ class TabularBackend : public AbstractState
                     set_warning_string(format("Maximum allowed tabular directory size is %g GB, you have exceeded this limit", allowed_size_in_GB));
                 }
                 /// If you cannot load the tables, build them and then write them to file
-                dataset->build_tables(this->AS);
-                pack_matrices();
-                write_tables();
-                /// Load the tables back into memory as a consistency check
-                load_tables();
+                dataset->build_tables(this->AS, table_path);
+                if (dataset->tables_complete()) {
+                    pack_matrices();
+                    write_tables();
+                    dataset->remove_tile_checkpoints();
+                    /// Load the tables back into memory as a consistency check
+                    load_tables();
+                }
                 // Set the flag saying tables have been successfully loaded
                 tables_loaded = true;
             }
@@ -0,0 +1,249 @@
+#if !defined(NO_TABULAR_BACKENDS)
+
+#    include "TransportSurrogate.h"
+#    include "Backends/Helmholtz/HelmholtzEOSMixtureBackend.h"
+#    include "CPfilepaths.h"
+#    include <ctime>
+#    include <limits>
+#    include <mutex>
+#    include <stdint.h>
+
+namespace {
+
+/// The viscosity and the conductivity from the full transport models at (T, rhomolar), without phase determination; NaN if they fail
+void full_transport(CoolProp::HelmholtzEOSMixtureBackend& HEOS, double T, double rhomolar, double& viscosity, double& conductivity) {
+    viscosity = std::numeric_limits<double>::quiet_NaN();
+    conductivity = std::numeric_limits<double>::quiet_NaN();
+    try {
+        HEOS.update_DmolarT_direct(rhomolar, T);
+    } catch (std::exception&) {
+        return;
+    }
+    try {
+        viscosity = HEOS.viscosity();
+    } catch (std::exception&) {
+    }
+    try {
+        conductivity = HEOS.conductivity();
+    } catch (std::exception&) {
+    }
+}
+
+/// The transport tables of a fluid, which are loaded or built once, by the first thread that needs them
+struct TransportLibraryEntry
+{
+    std::once_flag once;
+    /// Empty if the tables could not be built; written under the mutex of the library
+    shared_ptr<CoolProp::TransportSurrogateData> tables;
+};
+
+/// The transport tables, by fluid name; the map and the tables of its entries are guarded by the mutex
+struct TransportLibrary
+{
+    std::map<std::string, shared_ptr<TransportLibraryEntry>> entries;
+    std::mutex mutex;
+};
+TransportLibrary& get_transport_library() {
+    static TransportLibrary library;
+    return library;
+}
+
+/// True in the thread that is building transport tables, so that the transport models that calculate the nodes use the full models
+thread_local bool building_transport_tables = false;
+
+/// The 32-bit FNV-1a hash of a string, as 8 hexadecimal digits
+std::string model_hash(const std::string& s) {
+    uint32_t hash = 2166136261u;
+    for (std::string::const_iterator it = s.begin(); it != s.end(); ++it) {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= 16777619u;
+    }
+    return format("%08x", static_cast<unsigned int>(hash));
+}
+
+/// The relative error of the interpolated logarithm of a value; _HUGE if either is not a valid number
+double relative_error(double log_interpolated, double value) {
+    double error = std::abs(exp(log_interpolated) / value - 1);
+    return ValidNumber(error) ? error : _HUGE;
+}
+
+}  // namespace
+
+void CoolProp::TransportSurrogateData::set_limits(HelmholtzEOSMixtureBackend& HEOS) {
+    Tmin = std::max(HEOS.Ttriple(), HEOS.Tmin());
+    Tmax = HEOS.Tmax();
+    rhomax = HEOS.get_components()[0].EOS().limits.rhomax;
+    // The ideal gas at 1 Pa and the maximum temperature
+    rhomin = 1 / (HEOS.gas_constant() * Tmax);
+    if (!ValidNumber(Tmin) || !ValidNumber(Tmax) || !(Tmax > Tmin) || !ValidNumber(rhomax) || !(rhomax > rhomin)) {
+        throw ValueError(format("The limits of the equation of state of %s are not valid for the transport tables", HEOS.name().c_str()));
+    }
+}
+
+void CoolProp::TransportSurrogateData::build(HelmholtzEOSMixtureBackend& HEOS) {
+    const bool debug = get_debug_level() > 5 || false;
+    clock_t t1 = clock();
+    std::vector<double> Tvec = linspace(Tmin, Tmax, NT), rhovec = logspace(rhomin, rhomax, Nrho);
+    log_viscosity.assign(NT * Nrho, std::numeric_limits<double>::quiet_NaN());
+    log_conductivity.assign(NT * Nrho, std::numeric_limits<double>::quiet_NaN());
+    double eta, lambda;
+    for (std::size_t i = 0; i < NT; ++i) {
+        for (std::size_t j = 0; j < Nrho; ++j) {
+            full_transport(HEOS, Tvec[i], rhovec[j], eta, lambda);
+            // The logarithm of zero, a negative value or NaN is not a valid number, so the cells around the node are never used
+            log_viscosity[i * Nrho + j] = log(eta);
+            log_conductivity[i * Nrho + j] = log(lambda);
+        }
+    }
+    // The errors of the interpolation at the centers of the cells, where they are the largest
+    viscosity_error.assign((NT - 1) * (Nrho - 1), _HUGE);
+    conductivity_error.assign((NT - 1) * (Nrho - 1), _HUGE);
+    for (std::size_t i = 0; i < NT - 1; ++i) {
+        for (std::size_t j = 0; j < Nrho - 1; ++j) {
+            double T = (Tvec[i] + Tvec[i + 1]) / 2, rhomolar = sqrt(rhovec[j] * rhovec[j + 1]);
+            full_transport(HEOS, T, rhomolar, eta, lambda);
+            viscosity_error[i * (Nrho - 1) + j] = relative_error(interpolate(log_viscosity, T, rhomolar), eta);
+            conductivity_error[i * (Nrho - 1) + j] = relative_error(interpolate(log_conductivity, T, rhomolar), lambda);
+        }
+    }
+    if (debug) {
+        std::cout << format("Built the transport tables of %s in %g sec.\n", HEOS.name().c_str(), static_cast<double>(clock() - t1) / CLOCKS_PER_SEC);
+    }
+}
+
+void CoolProp::TransportSurrogateData::load(const std::string& path_to_tables) {
+    std::string path_to_table = path_to_tables + "/transport.bin.z";
+    std::vector<char> charbuffer = read_packed_table(path_to_table);
+    try {
+        msgpack::unpacked msg;
+        msgpack::unpack(msg, &(charbuffer[0]), charbuffer.size());
+        msgpack::object deserialized = msg.get();
+        deserialize(deserialized);
+    } catch (std::exception& e) {
+        throw UnableToLoadError(format("Unable to msgpack deserialize %s; err: %s", path_to_table.c_str(), e.what()));
+    }
+}
+
+void CoolProp::TransportSurrogateData::write(const std::string& path_to_tables) {
+    make_dirs(path_to_tables);
+    pack();
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, *this);
+    vectors.clear();
+    write_packed_table(sbuf, path_to_tables, "transport");
+}
+
+double CoolProp::TransportSurrogateData::interpolate(const std::vector<double>& log_values, double T, double rhomolar) const {
+    std::size_t i0, j0;
+    double wT[4], wrho[4];
+    if (!cubic_stencil((T - Tmin) / (Tmax - Tmin) * static_cast<double>(NT - 1), NT, NT, i0, wT)
+        || !cubic_stencil(log(rhomolar / rhomin) / log(rhomax / rhomin) * static_cast<double>(Nrho - 1), Nrho, Nrho, j0, wrho)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    double y = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+        const double* node = &log_values[(i0 + i) * Nrho + j0];
+        y += wT[i] * (wrho[0] * node[0] + wrho[1] * node[1] + wrho[2] * node[2] + wrho[3] * node[3]);
+    }
+    // NaN at any of the nodes propagates into y
+    return y;
+}
+
+double CoolProp::TransportSurrogateData::evaluate(const std::vector<double>& log_values, const std::vector<double>& errors, double T,
+                                                  double rhomolar, double tolerance) const {
+    double t = (T - Tmin) / (Tmax - Tmin) * static_cast<double>(NT - 1);
+    double r = log(rhomolar / rhomin) / log(rhomax / rhomin) * static_cast<double>(Nrho - 1);
+    if (!(t >= 0 && t <= static_cast<double>(NT - 1) && r >= 0 && r <= static_cast<double>(Nrho - 1))) {
+        return std::numeric_limits<double>::quiet_NaN();  // Also if T or rhomolar is NaN
+    }
+    // The cell that contains the point
+    std::size_t i = std::min(static_cast<std::size_t>(t), NT - 2), j = std::min(static_cast<std::size_t>(r), Nrho - 2);
+    if (!(errors[i * (Nrho - 1) + j] <= tolerance)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return exp(interpolate(log_values, T, rhomolar));
+}
+
+/// Load the tables of the fluid of HEOS from the tables directory, or build them and write them there; empty if they cannot be built
+static shared_ptr<CoolProp::TransportSurrogateData> load_or_build(CoolProp::HelmholtzEOSMixtureBackend& HEOS) {
+    const std::string name = HEOS.name();
+    shared_ptr<CoolProp::TransportSurrogateData> tables;
+    building_transport_tables = true;
+    try {
+        CoolProp::HelmholtzEOSMixtureBackend full(HEOS.get_components(), false);
+        tables.reset(new CoolProp::TransportSurrogateData());
+        tables->set_limits(full);
+        // The tables on disk are only used if they were built from the same equation of state and transport models
+        std::string path_to_tables;
+        try {
+            tables->model_hash = model_hash(full.fluid_param_string("JSON"));
+            path_to_tables = CoolProp::get_tables_directory() + "Transport(" + name + ")";
+        } catch (std::exception& e) {
+            if (CoolProp::get_debug_level() > 0) {
+                std::cout << format("The transport tables of %s are not cached since its JSON is not available: %s\n", name.c_str(), e.what());
+            }
+        }
+        try {
+            if (path_to_tables.empty()) {
+                throw CoolProp::UnableToLoadError("The tables are not cached");
+            }
+            tables->load(path_to_tables);
+        } catch (std::exception& e) {
+            if (CoolProp::get_debug_level() > 0) {
+                std::cout << format("Loading the transport tables of %s failed with error: %s\n", name.c_str(), e.what());
+            }
+            tables->build(full);
+            if (!path_to_tables.empty()) {
+                try {
+                    tables->write(path_to_tables);
+                } catch (std::exception& e) {
+                    CoolProp::set_warning_string(format("Unable to write the transport tables of %s: %s", name.c_str(), e.what()));
+                }
+            }
+        }
+    } catch (std::exception& e) {
+        CoolProp::set_warning_string(format("Unable to build the transport tables of %s: %s", name.c_str(), e.what()));
+        tables.reset();
+    }
+    building_transport_tables = false;
+    return tables;
+}
+
+shared_ptr<CoolProp::TransportSurrogateData> CoolProp::TransportSurrogateData::get(HelmholtzEOSMixtureBackend& HEOS) {
+    if (building_transport_tables) {
+        // This is one of the instances that calculate the nodes of the tables
+        return shared_ptr<TransportSurrogateData>();
+    }
+    TransportLibrary& library = get_transport_library();
+    shared_ptr<TransportLibraryEntry> entry;
+    {
+        std::lock_guard<std::mutex> lock(library.mutex);
+        shared_ptr<TransportLibraryEntry>& e = library.entries[HEOS.name()];
+        if (!e) {
+            e.reset(new TransportLibraryEntry());
+        }
+        entry = e;
+    }
+    // The other threads that need the tables of this fluid wait here until they are loaded or built
+    std::call_once(entry->once, [&HEOS, &library, &entry]() {
+        shared_ptr<TransportSurrogateData> tables = load_or_build(HEOS);
+        std::lock_guard<std::mutex> lock(library.mutex);
+        entry->tables = tables;
+    });
+    return entry->tables;
+}
+
+std::map<std::string, std::size_t> CoolProp::TransportSurrogateData::library_memory_footprints() {
+    std::map<std::string, std::size_t> footprints;
+    TransportLibrary& library = get_transport_library();
+    std::lock_guard<std::mutex> lock(library.mutex);
+    for (std::map<std::string, shared_ptr<TransportLibraryEntry>>::const_iterator it = library.entries.begin(); it != library.entries.end();
+         ++it) {
+        if (it->second->tables) {
+            footprints[it->first] = it->second->tables->memory_footprint();
+        }
+    }
+    return footprints;
+}
+
+#endif  // !defined(NO_TABULAR_BACKENDS)
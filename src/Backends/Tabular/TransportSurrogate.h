@@ -0,0 +1,123 @@
+#ifndef TRANSPORT_SURROGATE_H
+#define TRANSPORT_SURROGATE_H
+
+#include "TabularBackends.h"
+
+namespace CoolProp {
+
+class HelmholtzEOSMixtureBackend;
+
+/** \brief This class holds tables of the viscosity and the thermal conductivity of a pure fluid, regularly spaced in T and log(rho)
+ *
+ * The logarithms of the viscosity and the conductivity are interpolated with bicubic Lagrange polynomials through the 4 x 4
+ * nodes around the point.  The tables cover the temperature range of the equation of state, and densities from that of the
+ * ideal gas at 1 Pa and the maximum temperature up to the maximum density of the equation of state.  The nodes are calculated
+ * at the (T, rho) of the node without phase determination, so that the values are those that the transport models give
+ * for a state at that (T, rho), also within the two-phase region.
+ *
+ * Once the nodes are calculated, the error of the tables in each cell is measured at the center of the cell.  The tables are
+ * only used in the cells where that error is within the tolerance; elsewhere (close to the critical point, where the
+ * critical enhancement of the conductivity is too sharp for the grid, or where a node could not be calculated) the full
+ * transport models are used.
+ */
+class TransportSurrogateData
+{
+   public:
+    std::size_t NT, Nrho;
+    double Tmin, Tmax, rhomin, rhomax;
+    int revision;
+    /// The hash of the JSON of the fluid (equation of state and transport models) that the tables were built from
+    std::string model_hash;
+    /// The logarithms of the values at the nodes, stored at [i*Nrho + j] for T_i and rho_j; NaN where they could not be calculated
+    std::vector<double> log_viscosity, log_conductivity;
+    /// The relative errors at the centers of the cells, stored at [i*(Nrho-1) + j] for the cell [T_i, T_i+1] x [rho_j, rho_j+1]
+    std::vector<double> viscosity_error, conductivity_error;
+    std::map<std::string, std::vector<double>> vectors;
+
+    TransportSurrogateData() {
+        NT = 200;
+        Nrho = 200;
+        Tmin = _HUGE;
+        Tmax = _HUGE;
+        rhomin = _HUGE;
+        rhomax = _HUGE;
+        revision = 1;
+    }
+
+    MSGPACK_DEFINE(revision, model_hash, vectors, NT, Nrho, Tmin, Tmax, rhomin, rhomax);  // write the member variables that you want to pack
+
+    /// Set the limits of the tables from the limits of the equation of state of the fluid
+    void set_limits(HelmholtzEOSMixtureBackend& HEOS);
+    /// Build the tables; the transport models of HEOS must not use these tables
+    void build(HelmholtzEOSMixtureBackend& HEOS);
+    /// Take all the vectors that are in the class and pack them into the vectors map for easy unpacking using msgpack
+    void pack() {
+        vectors.insert(std::pair<std::string, std::vector<double>>("log_viscosity", log_viscosity));
+        vectors.insert(std::pair<std::string, std::vector<double>>("log_conductivity", log_conductivity));
+        vectors.insert(std::pair<std::string, std::vector<double>>("viscosity_error", viscosity_error));
+        vectors.insert(std::pair<std::string, std::vector<double>>("conductivity_error", conductivity_error));
+    };
+    std::map<std::string, std::vector<double>>::iterator get_vector_iterator(const std::string& name) {
+        std::map<std::string, std::vector<double>>::iterator it = vectors.find(name);
+        if (it == vectors.end()) {
+            throw UnableToLoadError(format("could not find vector %s", name.c_str()));
+        }
+        return it;
+    }
+    /// Take all the vectors that are in the class and unpack them from the vectors map
+    void unpack() {
+        log_viscosity = get_vector_iterator("log_viscosity")->second;
+        log_conductivity = get_vector_iterator("log_conductivity")->second;
+        viscosity_error = get_vector_iterator("viscosity_error")->second;
+        conductivity_error = get_vector_iterator("conductivity_error")->second;
+        vectors.clear();
+    };
+    void deserialize(msgpack::object& deserialized) {
+        TransportSurrogateData temp;
+        deserialized.convert(temp);
+        temp.unpack();
+        if (NT != temp.NT || Nrho != temp.Nrho) {
+            throw ValueError(format("old [%dx%d] and new [%dx%d] dimensions don't agree", temp.NT, temp.Nrho, NT, Nrho));
+        } else if (revision > temp.revision) {
+            throw ValueError(format("loaded revision [%d] is older than current revision [%d]", temp.revision, revision));
+        } else if (model_hash != temp.model_hash) {
+            throw ValueError(format("The transport tables were built from another model [%s] than the current one [%s]", temp.model_hash.c_str(),
+                                    model_hash.c_str()));
+        } else if (Tmin != temp.Tmin || Tmax != temp.Tmax || rhomin != temp.rhomin || rhomax != temp.rhomax) {
+            throw ValueError("Current limits of the transport tables do not agree with the loaded limits");
+        } else if (temp.log_viscosity.size() != NT * Nrho || temp.log_conductivity.size() != NT * Nrho
+                   || temp.viscosity_error.size() != (NT - 1) * (Nrho - 1) || temp.conductivity_error.size() != (NT - 1) * (Nrho - 1)) {
+            throw ValueError("The loaded transport tables have the wrong number of nodes");
+        }
+        std::swap(*this, temp);
+    };
+    /// Load the tables from path_to_tables; throws UnableToLoadError if there is a problem
+    void load(const std::string& path_to_tables);
+    /// Write the tables to path_to_tables
+    void write(const std::string& path_to_tables);
+
+    /// Interpolate the logarithm of the values of one of the tables at (T, rhomolar), without checking the error of the cell; NaN outside the tables
+    double interpolate(const std::vector<double>& log_values, double T, double rhomolar) const;
+    /// Interpolate one of the tables at (T, rhomolar); NaN outside the tables or if the error of the cell is larger than tolerance
+    double evaluate(const std::vector<double>& log_values, const std::vector<double>& errors, double T, double rhomolar, double tolerance) const;
+    double viscosity(double T, double rhomolar, double tolerance) const {
+        return evaluate(log_viscosity, viscosity_error, T, rhomolar, tolerance);
+    }
+    double conductivity(double T, double rhomolar, double tolerance) const {
+        return evaluate(log_conductivity, conductivity_error, T, rhomolar, tolerance);
+    }
+    /// The memory used by the tables, in bytes
+    std::size_t memory_footprint() const {
+        return sizeof(double) * (log_viscosity.capacity() + log_conductivity.capacity() + viscosity_error.capacity() + conductivity_error.capacity());
+    }
+
+    /// Get the tables of the fluid of HEOS; they are loaded from the tables directory, or built and written there, the first time they are
+    /// needed.  The tables of a fluid are loaded or built once, by the first thread that needs them, while the other threads wait for them.
+    static shared_ptr<TransportSurrogateData> get(HelmholtzEOSMixtureBackend& HEOS);
+    /// The memory used by the tables of each fluid that are loaded, in bytes, keyed by the name of the fluid
+    static std::map<std::string, std::size_t> library_memory_footprints();
+};
+
+} /* namespace CoolProp */
+
+#endif
@@ -47,6 +47,9 @@
 #include "Backends/REFPROP/REFPROPMixtureBackend.h"
 #include "Backends/Cubics/CubicsLibrary.h"
 #include "Backends/PCSAFT/PCSAFTLibrary.h"
+#if !defined(NO_TABULAR_BACKENDS)
+#    include "Backends/Tabular/TransportSurrogate.h"
+#endif
 
 #if defined(ENABLE_CATCH)
 #    include <catch2/catch_all.hpp>
@@ -1017,16 +1020,18 @@ std::string get_global_param_string(const std::string& ParamName) {
         return CoolProp::CubicLibrary::get_cubic_fluids_list();
     } else if (ParamName == "pcsaft_fluids_schema") {
         return CoolProp::PCSAFTLibrary::get_pcsaft_fluids_schema();
+    } else if (ParamName == "memory_report") {
+        return get_memory_report().to_JSON();
     } else {
         throw ValueError(format("Input parameter [%s] is invalid", ParamName.c_str()));
     }
 };
 #if defined(ENABLE_CATCH)
 TEST_CASE("Check inputs to get_global_param_string", "[get_global_param_string]") {
-    const int num_good_inputs = 8;
+    const int num_good_inputs = 9;
     std::string good_inputs[num_good_inputs] = {
       "version",        "gitrevision",        "fluids_list", "incompressible_list_pure", "incompressible_list_solution", "mixture_binary_pairs_list",
-      "parameter_list", "predefined_mixtures"};
+      "parameter_list", "predefined_mixtures", "memory_report"};
     std::ostringstream ss3c;
     for (int i = 0; i < num_good_inputs; ++i) {
         ss3c << "Test for" << good_inputs[i];
@@ -1037,6 +1042,74 @@ TEST_CASE("Check inputs to get_global_param_string", "[get_global_param_string]"
     CHECK_THROWS(CoolProp::get_global_param_string(""));
 };
 #endif
+
+std::size_t MemoryReport::total_bytes() const {
+    std::size_t bytes = fluid_library_bytes + fluid_library_JSON_bytes;
+    for (std::map<std::string, std::size_t>::const_iterator it = table_sets.begin(); it != table_sets.end(); ++it) {
+        bytes += it->second;
+    }
+    for (std::map<std::string, std::size_t>::const_iterator it = transport_tables.begin(); it != transport_tables.end(); ++it) {
+        bytes += it->second;
+    }
+    for (std::map<std::string, std::size_t>::const_iterator it = live_state_bytes.begin(); it != live_state_bytes.end(); ++it) {
+        bytes += it->second;
+    }
+    bytes += handle_table_bytes;
+    if (live_states.empty()) {
+        bytes += handle_state_bytes;
+    }
+    return bytes;
+}
+/// Add the footprints as an object of (key, bytes) members under the name key
+static void set_footprints(const char* key, const std::map<std::string, std::size_t>& footprints, rapidjson::Value& value, rapidjson::Document& doc) {
+    rapidjson::Value _v(rapidjson::kObjectType);
+    for (std::map<std::string, std::size_t>::const_iterator it = footprints.begin(); it != footprints.end(); ++it) {
+        _v.AddMember(rapidjson::Value(it->first.c_str(), doc.GetAllocator()).Move(), static_cast<uint64_t>(it->second), doc.GetAllocator());
+    }
+    value.AddMember(rapidjson::Value(key, doc.GetAllocator()).Move(), _v, doc.GetAllocator());
+}
+std::string MemoryReport::to_JSON() const {
+    rapidjson::Document doc;
+    doc.SetObject();
+    doc.AddMember("total_bytes", static_cast<uint64_t>(total_bytes()), doc.GetAllocator());
+    rapidjson::Value fluids(rapidjson::kObjectType);
+    fluids.AddMember("fluids", static_cast<uint64_t>(fluid_library_fluids), doc.GetAllocator());
+    fluids.AddMember("bytes", static_cast<uint64_t>(fluid_library_bytes), doc.GetAllocator());
+    fluids.AddMember("JSON_bytes", static_cast<uint64_t>(fluid_library_JSON_bytes), doc.GetAllocator());
+    doc.AddMember("fluid_library", fluids, doc.GetAllocator());
+    set_footprints("table_sets", table_sets, doc, doc);
+    set_footprints("transport_tables", transport_tables, doc, doc);
+    set_footprints("live_states", live_states, doc, doc);
+    set_footprints("live_state_bytes", live_state_bytes, doc, doc);
+    rapidjson::Value _handles(rapidjson::kObjectType);
+    _handles.AddMember("handles", static_cast<uint64_t>(handles), doc.GetAllocator());
+    _handles.AddMember("table_bytes", static_cast<uint64_t>(handle_table_bytes), doc.GetAllocator());
+    _handles.AddMember("state_bytes", static_cast<uint64_t>(handle_state_bytes), doc.GetAllocator());
+    doc.AddMember("C_API_handles", _handles, doc.GetAllocator());
+    return cpjson::json2string(doc);
+}
+static HandleMemoryFootprintCallback handle_memory_footprint_callback = NULL;
+
+void set_handle_memory_footprint_callback(HandleMemoryFootprintCallback callback) {
+    handle_memory_footprint_callback = callback;
+}
+MemoryReport get_memory_report() {
+    MemoryReport report;
+    JSONFluidLibrary& library = get_library();
+    report.fluid_library_fluids = library.size();
+    report.fluid_library_bytes = library.memory_footprint();
+    report.fluid_library_JSON_bytes = library.JSON_memory_footprint();
+#if !defined(NO_TABULAR_BACKENDS)
+    report.table_sets = get_tabular_memory_footprints();
+    report.transport_tables = TransportSurrogateData::library_memory_footprints();
+#endif
+    AbstractState::live_states(report.live_states, report.live_state_bytes);
+    if (handle_memory_footprint_callback != NULL) {
+        handle_memory_footprint_callback(report.handles, report.handle_table_bytes, report.handle_state_bytes);
+    }
+    return report;
+}
+
 std::string get_fluid_param_string(const std::string& FluidName, const std::string& ParamName) {
     std::string backend, fluid;
     extract_backend(FluidName, backend, fluid);
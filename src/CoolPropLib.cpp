@@ -492,8 +492,30 @@ class AbstractStateLibrary
             throw CoolProp::HandleError("could not get handle");
         }
     }
+    /// The number of handles, the memory of the table of the handles, and the memory of their states and the states they own
+    void memory_footprint(std::size_t& handles, std::size_t& table_bytes, std::size_t& state_bytes) {
+        handles = ASlibrary.size();
+        table_bytes = sizeof(AbstractStateLibrary);
+        state_bytes = 0;
+        for (std::map<std::size_t, shared_ptr<CoolProp::AbstractState>>::const_iterator it = ASlibrary.begin(); it != ASlibrary.end(); ++it) {
+            table_bytes += sizeof(std::size_t) + sizeof(shared_ptr<CoolProp::AbstractState>);
+            state_bytes += it->second->memory_footprint();
+        }
+    }
 };
 static AbstractStateLibrary handle_manager;
+static void handle_memory_footprint(std::size_t& handles, std::size_t& table_bytes, std::size_t& state_bytes) {
+    handle_manager.memory_footprint(handles, table_bytes, state_bytes);
+}
+/// Registers the handles with get_memory_report when the library is loaded
+class HandleMemoryFootprintInitializer
+{
+   public:
+    HandleMemoryFootprintInitializer() {
+        CoolProp::set_handle_memory_footprint_callback(handle_memory_footprint);
+    };
+};
+static HandleMemoryFootprintInitializer handle_memory_footprint_initializer;
 
 EXPORT_CODE long CONVENTION AbstractState_factory(const char* backend, const char* fluids, long* errcode, char* message_buffer,
                                                   const long buffer_length) {
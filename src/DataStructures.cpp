@@ -721,7 +721,7 @@ struct backend_info
 const backend_family_info backend_family_list[] = {
   {HEOS_BACKEND_FAMILY, "HEOS"},   {REFPROP_BACKEND_FAMILY, "REFPROP"}, {INCOMP_BACKEND_FAMILY, "INCOMP"},   {IF97_BACKEND_FAMILY, "IF97"},
   {TREND_BACKEND_FAMILY, "TREND"}, {TTSE_BACKEND_FAMILY, "TTSE"},       {BICUBIC_BACKEND_FAMILY, "BICUBIC"}, {SRK_BACKEND_FAMILY, "SRK"},
-  {PR_BACKEND_FAMILY, "PR"},       {VTPR_BACKEND_FAMILY, "VTPR"},       {PCSAFT_BACKEND_FAMILY, "PCSAFT"}};
+  {PR_BACKEND_FAMILY, "PR"},       {VTPR_BACKEND_FAMILY, "VTPR"},       {PCSAFT_BACKEND_FAMILY, "PCSAFT"},   {GERG2008_BACKEND_FAMILY, "GERG2008"}};
 
 const backend_info backend_list[] = {{HEOS_BACKEND_PURE, "HelmholtzEOSBackend", HEOS_BACKEND_FAMILY},
                                      {HEOS_BACKEND_MIX, "HelmholtzEOSMixtureBackend", HEOS_BACKEND_FAMILY},
@@ -735,7 +735,8 @@ const backend_info backend_list[] = {{HEOS_BACKEND_PURE, "HelmholtzEOSBackend",
                                      {SRK_BACKEND, "SRKBackend", SRK_BACKEND_FAMILY},
                                      {PR_BACKEND, "PengRobinsonBackend", PR_BACKEND_FAMILY},
                                      {VTPR_BACKEND, "VTPRBackend", VTPR_BACKEND_FAMILY},
-                                     {PCSAFT_BACKEND, "PCSAFTBackend", PCSAFT_BACKEND_FAMILY}};
+                                     {PCSAFT_BACKEND, "PCSAFTBackend", PCSAFT_BACKEND_FAMILY},
+                                     {GERG2008_BACKEND, "GERG2008Backend", GERG2008_BACKEND_FAMILY}};
 
 class BackendInformation
 {
@@ -1,5 +1,6 @@
 #include <numeric>
 #include "Helmholtz.h"
+#include "VectorMath.h"
 
 #ifdef __ANDROID__
 #    undef _A
@@ -134,43 +135,42 @@ void ResidualHelmholtzGeneralizedExponential::allEigen(const CoolPropDbl &tau, c
     return;
 };
 */
-void ResidualHelmholtzGeneralizedExponential::all(const CoolPropDbl& tau, const CoolPropDbl& delta, HelmholtzDerivatives& derivs) throw() {
-    CoolPropDbl log_tau = log(tau), log_delta = log(delta), ndteu, one_over_delta = 1 / delta,
-                one_over_tau = 1 / tau;  // division is much slower than multiplication, so do one division here
+/// Calculate the derivative factors that depend on one variable x (tau or delta) of one term of the form x^e*exp(u(x));
+/// x^e*exp(u(x)) itself is evaluated for all the terms at once by the caller
+/// @param x The variable (tau or delta)
+/// @param e The exponent of x
+/// @param du_dx The first derivative of u with respect to x (and likewise for the higher derivatives)
+static void generalized_exponential_factors(CoolPropDbl x, CoolPropDbl e, CoolPropDbl du_dx, CoolPropDbl d2u_dx2, CoolPropDbl d3u_dx3,
+                                            CoolPropDbl d4u_dx4, ResidualHelmholtzGeneralizedExponentialFactors& factors) {
+    const CoolPropDbl dB_dx = x * d2u_dx2 + du_dx;
+    const CoolPropDbl d2B_dx2 = x * d3u_dx3 + 2 * d2u_dx2;
+    const CoolPropDbl d3B_dx3 = x * d4u_dx4 + 3 * d3u_dx3;
+
+    const CoolPropDbl B = (x * du_dx + e);
+    const CoolPropDbl B2 = x * dB_dx + (B - 1) * B;
+    const CoolPropDbl dB2_dx = x * d2B_dx2 + 2 * B * dB_dx;
+    const CoolPropDbl B3 = x * dB2_dx + (B - 2) * B2;
+    const CoolPropDbl dB3_dx = x * x * d3B_dx3 + 3 * x * B * d2B_dx2 + 3 * x * POW2(dB_dx) + 3 * B * (B - 1) * dB_dx;
+    const CoolPropDbl B4 = x * dB3_dx + (B - 3) * B3;
+
+    factors.B1 = B;
+    factors.B2 = B2;
+    factors.B3 = B3;
+    factors.B4 = B4;
+}
 
-    // Maybe split the construction of u and other parts into two separate loops?
-    // If both loops can get vectorized, could be worth it.
-    const std::size_t N = elements.size();
-    for (std::size_t i = 0; i < N; ++i) {
+void ResidualHelmholtzGeneralizedExponential::calc_tau_factors(const CoolPropDbl& tau) {
+    CoolPropDbl one_over_tau = 1 / tau;
+    for (std::size_t i = 0; i < elements.size(); ++i) {
         ResidualHelmholtzGeneralizedExponentialElement& el = elements[i];
-        CoolPropDbl ni = el.n, di = el.d, ti = el.t;
 
-        // Set the u part of exp(u) to zero
+        // The part of u that depends on tau
         CoolPropDbl u = 0;
-        CoolPropDbl du_ddelta = 0;
         CoolPropDbl du_dtau = 0;
-        CoolPropDbl d2u_ddelta2 = 0;
         CoolPropDbl d2u_dtau2 = 0;
-        CoolPropDbl d3u_ddelta3 = 0;
         CoolPropDbl d3u_dtau3 = 0;
-        CoolPropDbl d4u_ddelta4 = 0;
         CoolPropDbl d4u_dtau4 = 0;
 
-        if (delta_li_in_u) {
-            CoolPropDbl ci = el.c, l_double = el.l_double;
-            if (ValidNumber(l_double) && l_double > 0 && std::abs(ci) > DBL_EPSILON) {
-                const CoolPropDbl u_increment = (el.l_is_int) ? -ci * powInt(delta, el.l_int) : -ci * pow(delta, l_double);
-                const CoolPropDbl du_ddelta_increment = l_double * u_increment * one_over_delta;
-                const CoolPropDbl d2u_ddelta2_increment = (l_double - 1) * du_ddelta_increment * one_over_delta;
-                const CoolPropDbl d3u_ddelta3_increment = (l_double - 2) * d2u_ddelta2_increment * one_over_delta;
-                const CoolPropDbl d4u_ddelta4_increment = (l_double - 3) * d3u_ddelta3_increment * one_over_delta;
-                u += u_increment;
-                du_ddelta += du_ddelta_increment;
-                d2u_ddelta2 += d2u_ddelta2_increment;
-                d3u_ddelta3 += d3u_ddelta3_increment;
-                d4u_ddelta4 += d4u_ddelta4_increment;
-            }
-        }
         if (tau_mi_in_u) {
             CoolPropDbl omegai = el.omega, m_double = el.m_double;
             if (std::abs(m_double) > 0) {
@@ -186,21 +186,6 @@ void ResidualHelmholtzGeneralizedExponential::all(const CoolPropDbl& tau, const
                 d4u_dtau4 += d4u_dtau4_increment;
             }
         }
-        if (eta1_in_u) {
-            CoolPropDbl eta1 = el.eta1, epsilon1 = el.epsilon1;
-            if (ValidNumber(eta1)) {
-                u += -eta1 * (delta - epsilon1);
-                du_ddelta += -eta1;
-            }
-        }
-        if (eta2_in_u) {
-            CoolPropDbl eta2 = el.eta2, epsilon2 = el.epsilon2;
-            if (ValidNumber(eta2)) {
-                u += -eta2 * POW2(delta - epsilon2);
-                du_ddelta += -2 * eta2 * (delta - epsilon2);
-                d2u_ddelta2 += -2 * eta2;
-            }
-        }
         if (beta1_in_u) {
             CoolPropDbl beta1 = el.beta1, gamma1 = el.gamma1;
             if (ValidNumber(beta1)) {
@@ -216,52 +201,110 @@ void ResidualHelmholtzGeneralizedExponential::all(const CoolPropDbl& tau, const
                 d2u_dtau2 += -2 * beta2;
             }
         }
+        u_part[i] = u;
+        generalized_exponential_factors(tau, el.t, du_dtau, d2u_dtau2, d3u_dtau3, d4u_dtau4, tau_factors[i]);
+    }
+    // tau^t_i*exp(u_i) for all the terms with the vector kernels
+    CoolProp::VectorMath::exp_log(tau, t_exponents.data(), u_part.data(), exp_part.data(), elements.size());
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+        tau_factors[i].exp_part = exp_part[i];
+    }
+    cached_tau = tau;
+}
 
-        ndteu = ni * exp(ti * log_tau + di * log_delta + u);
+void ResidualHelmholtzGeneralizedExponential::calc_delta_factors(const CoolPropDbl& delta) {
+    CoolPropDbl one_over_delta = 1 / delta;
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+        ResidualHelmholtzGeneralizedExponentialElement& el = elements[i];
+
+        // The part of u that depends on delta
+        CoolPropDbl u = 0;
+        CoolPropDbl du_ddelta = 0;
+        CoolPropDbl d2u_ddelta2 = 0;
+        CoolPropDbl d3u_ddelta3 = 0;
+        CoolPropDbl d4u_ddelta4 = 0;
 
-        const CoolPropDbl dB_delta_ddelta = delta * d2u_ddelta2 + du_ddelta;
-        const CoolPropDbl d2B_delta_ddelta2 = delta * d3u_ddelta3 + 2 * d2u_ddelta2;
-        const CoolPropDbl d3B_delta_ddelta3 = delta * d4u_ddelta4 + 3 * d3u_ddelta3;
+        if (delta_li_in_u) {
+            CoolPropDbl ci = el.c, l_double = el.l_double;
+            if (ValidNumber(l_double) && l_double > 0 && std::abs(ci) > DBL_EPSILON) {
+                const CoolPropDbl u_increment = (el.l_is_int) ? -ci * powInt(delta, el.l_int) : -ci * pow(delta, l_double);
+                const CoolPropDbl du_ddelta_increment = l_double * u_increment * one_over_delta;
+                const CoolPropDbl d2u_ddelta2_increment = (l_double - 1) * du_ddelta_increment * one_over_delta;
+                const CoolPropDbl d3u_ddelta3_increment = (l_double - 2) * d2u_ddelta2_increment * one_over_delta;
+                const CoolPropDbl d4u_ddelta4_increment = (l_double - 3) * d3u_ddelta3_increment * one_over_delta;
+                u += u_increment;
+                du_ddelta += du_ddelta_increment;
+                d2u_ddelta2 += d2u_ddelta2_increment;
+                d3u_ddelta3 += d3u_ddelta3_increment;
+                d4u_ddelta4 += d4u_ddelta4_increment;
+            }
+        }
+        if (eta1_in_u) {
+            CoolPropDbl eta1 = el.eta1, epsilon1 = el.epsilon1;
+            if (ValidNumber(eta1)) {
+                u += -eta1 * (delta - epsilon1);
+                du_ddelta += -eta1;
+            }
+        }
+        if (eta2_in_u) {
+            CoolPropDbl eta2 = el.eta2, epsilon2 = el.epsilon2;
+            if (ValidNumber(eta2)) {
+                u += -eta2 * POW2(delta - epsilon2);
+                du_ddelta += -2 * eta2 * (delta - epsilon2);
+                d2u_ddelta2 += -2 * eta2;
+            }
+        }
+        u_part[i] = u;
+        generalized_exponential_factors(delta, el.d, du_ddelta, d2u_ddelta2, d3u_ddelta3, d4u_ddelta4, delta_factors[i]);
+    }
+    // delta^d_i*exp(u_i) for all the terms with the vector kernels
+    CoolProp::VectorMath::exp_log(delta, d_exponents.data(), u_part.data(), exp_part.data(), elements.size());
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+        delta_factors[i].exp_part = exp_part[i];
+    }
+    cached_delta = delta;
+}
 
-        const CoolPropDbl B_delta = (delta * du_ddelta + di);
-        const CoolPropDbl B_delta2 = delta * dB_delta_ddelta + (B_delta - 1) * B_delta;
-        const CoolPropDbl dB_delta2_ddelta = delta * d2B_delta_ddelta2 + 2 * B_delta * dB_delta_ddelta;
-        const CoolPropDbl B_delta3 = delta * dB_delta2_ddelta + (B_delta - 2) * B_delta2;
-        const CoolPropDbl dB_delta3_ddelta = delta * delta * d3B_delta_ddelta3 + 3 * delta * B_delta * d2B_delta_ddelta2
-                                             + 3 * delta * POW2(dB_delta_ddelta) + 3 * B_delta * (B_delta - 1) * dB_delta_ddelta;
-        const CoolPropDbl B_delta4 = delta * dB_delta3_ddelta + (B_delta - 3) * B_delta3;
+void ResidualHelmholtzGeneralizedExponential::all(const CoolPropDbl& tau, const CoolPropDbl& delta, HelmholtzDerivatives& derivs) {
+    CoolPropDbl ndteu, one_over_delta = 1 / delta,
+                       one_over_tau = 1 / tau;  // division is much slower than multiplication, so do one division here
 
-        const CoolPropDbl dB_tau_dtau = tau * d2u_dtau2 + du_dtau;
-        const CoolPropDbl d2B_tau_dtau2 = tau * d3u_dtau3 + 2 * d2u_dtau2;
-        const CoolPropDbl d3B_tau_dtau3 = tau * d4u_dtau4 + 3 * d3u_dtau3;
+    // Each term is the product of n_i, a part that only depends on tau, and a part that only depends on delta.  The
+    // parts are only re-evaluated if their variable has changed since the last call
+    const std::size_t N = elements.size();
+    if (tau_factors.size() != N || delta_factors.size() != N) {
+        clear_cached_factors();
+    }
+    if (tau != cached_tau) {
+        calc_tau_factors(tau);
+    }
+    if (delta != cached_delta) {
+        calc_delta_factors(delta);
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        const ResidualHelmholtzGeneralizedExponentialFactors &ft = tau_factors[i], &fd = delta_factors[i];
 
-        const CoolPropDbl B_tau = (tau * du_dtau + ti);
-        const CoolPropDbl B_tau2 = tau * dB_tau_dtau + (B_tau - 1) * B_tau;
-        const CoolPropDbl dB_tau2_dtau = tau * d2B_tau_dtau2 + 2 * B_tau * dB_tau_dtau;
-        const CoolPropDbl B_tau3 = tau * dB_tau2_dtau + (B_tau - 2) * B_tau2;
-        const CoolPropDbl dB_tau3_dtau =
-          tau * tau * d3B_tau_dtau3 + 3 * tau * B_tau * d2B_tau_dtau2 + 3 * tau * POW2(dB_tau_dtau) + 3 * B_tau * (B_tau - 1) * dB_tau_dtau;
-        const CoolPropDbl B_tau4 = tau * dB_tau3_dtau + (B_tau - 3) * B_tau3;
+        ndteu = elements[i].n * ft.exp_part * fd.exp_part;
 
         derivs.alphar += ndteu;
 
-        derivs.dalphar_ddelta += ndteu * B_delta;
-        derivs.dalphar_dtau += ndteu * B_tau;
+        derivs.dalphar_ddelta += ndteu * fd.B1;
+        derivs.dalphar_dtau += ndteu * ft.B1;
 
-        derivs.d2alphar_ddelta2 += ndteu * B_delta2;
-        derivs.d2alphar_ddelta_dtau += ndteu * B_delta * B_tau;
-        derivs.d2alphar_dtau2 += ndteu * B_tau2;
+        derivs.d2alphar_ddelta2 += ndteu * fd.B2;
+        derivs.d2alphar_ddelta_dtau += ndteu * fd.B1 * ft.B1;
+        derivs.d2alphar_dtau2 += ndteu * ft.B2;
 
-        derivs.d3alphar_ddelta3 += ndteu * B_delta3;
-        derivs.d3alphar_ddelta2_dtau += ndteu * B_delta2 * B_tau;
-        derivs.d3alphar_ddelta_dtau2 += ndteu * B_delta * B_tau2;
-        derivs.d3alphar_dtau3 += ndteu * B_tau3;
+        derivs.d3alphar_ddelta3 += ndteu * fd.B3;
+        derivs.d3alphar_ddelta2_dtau += ndteu * fd.B2 * ft.B1;
+        derivs.d3alphar_ddelta_dtau2 += ndteu * fd.B1 * ft.B2;
+        derivs.d3alphar_dtau3 += ndteu * ft.B3;
 
-        derivs.d4alphar_ddelta4 += ndteu * B_delta4;
-        derivs.d4alphar_ddelta3_dtau += ndteu * B_delta3 * B_tau;
-        derivs.d4alphar_ddelta2_dtau2 += ndteu * B_delta2 * B_tau2;
-        derivs.d4alphar_ddelta_dtau3 += ndteu * B_delta * B_tau3;
-        derivs.d4alphar_dtau4 += ndteu * B_tau4;
+        derivs.d4alphar_ddelta4 += ndteu * fd.B4;
+        derivs.d4alphar_ddelta3_dtau += ndteu * fd.B3 * ft.B1;
+        derivs.d4alphar_ddelta2_dtau2 += ndteu * fd.B2 * ft.B2;
+        derivs.d4alphar_ddelta_dtau3 += ndteu * fd.B1 * ft.B3;
+        derivs.d4alphar_dtau4 += ndteu * ft.B4;
     }
     derivs.dalphar_ddelta *= one_over_delta;
     derivs.dalphar_dtau *= one_over_tau;
@@ -1702,4 +1745,41 @@ TEST_CASE_METHOD(HelmholtzConsistencyFixture, "Helmholtz energy derivatives", "[
     }
 }
 
+
+TEST_CASE_METHOD(HelmholtzConsistencyFixture, "Cached tau and delta factors of the generalized exponential terms", "[helmholtz]") {
+    shared_ptr<CoolProp::ResidualHelmholtzGeneralizedExponential> terms[] = {Gaussian, Lemmon2005, Exponential, GERG2008, Power};
+    // Alternately hold tau and delta constant, as in the density and temperature solvers
+    CoolPropDbl taus[] = {1.3, 1.3, 1.3, 0.8, 0.8, 1.3}, deltas[] = {0.9, 1.1, 0.2, 0.2, 2.1, 2.1};
+    for (std::size_t i = 0; i < sizeof(terms) / sizeof(terms[0]); ++i) {
+        for (std::size_t j = 0; j < sizeof(taus) / sizeof(taus[0]); ++j) {
+            CoolProp::HelmholtzDerivatives cached, fresh;
+            terms[i]->all(taus[j], deltas[j], cached);
+            CoolProp::ResidualHelmholtzGeneralizedExponential copy = *terms[i];
+            copy.clear_cached_factors();
+            copy.all(taus[j], deltas[j], fresh);
+            CAPTURE(i);
+            CAPTURE(j);
+            CHECK(cached.alphar == fresh.alphar);
+            CHECK(cached.d2alphar_ddelta_dtau == fresh.d2alphar_ddelta_dtau);
+            CHECK(cached.d4alphar_ddelta2_dtau2 == fresh.d4alphar_ddelta2_dtau2);
+        }
+    }
+}
+
+TEST_CASE_METHOD(HelmholtzConsistencyFixture, "Cached tau terms of the ideal-gas container", "[helmholtz]") {
+    CoolProp::IdealHelmholtzContainer alpha0;
+    alpha0.Lead = *static_cast<CoolProp::IdealHelmholtzLead*>(Lead.get());
+    alpha0.LogTau = *static_cast<CoolProp::IdealHelmholtzLogTau*>(LogTau.get());
+    alpha0.PlanckEinstein = *static_cast<CoolProp::IdealHelmholtzPlanckEinsteinGeneralized*>(PlanckEinstein.get());
+    CoolProp::HelmholtzDerivatives first = alpha0.all(1.3, 0.9);
+    CoolProp::HelmholtzDerivatives other_delta = alpha0.all(1.3, 1.7);
+    CoolProp::HelmholtzDerivatives other_tau = alpha0.all(0.7, 1.7);
+    // The lead term is the only one that depends on delta
+    CHECK(std::abs(other_delta.alphar - first.alphar - log(1.7 / 0.9)) < 1e-12);
+    CHECK(other_delta.d2alphar_dtau2 == first.d2alphar_dtau2);
+    CHECK(other_tau.d2alphar_dtau2 != first.d2alphar_dtau2);
+    alpha0.clear_cached_tau_terms();
+    CHECK(alpha0.all(0.7, 1.7).dalphar_dtau == other_tau.dalphar_dtau);
+}
+
 #endif
@@ -25,6 +25,14 @@
 #include <iostream>
 #include <list>
 #include "externals/IF97/IF97.h"
+#if !defined(NO_TABULAR_BACKENDS)
+#    include <mutex>
+#    include "Backends/Tabular/HumidAirTables.h"
+#else
+namespace CoolProp {
+class HumidAirTableData;
+}
+#endif
 
 /// This is a stub overload to help with all the strcmp calls below and avoid needing to rewrite all of them
 std::size_t strcmp(const std::string& s, const std::string& e) {
@@ -99,7 +107,8 @@ void check_fluid_instantiation() {
 };
 
 static double epsilon = 0.621945, R_bar = 8.314472;
-static int FlagUseVirialCorrelations = 0, FlagUseIsothermCompressCorrelation = 0, FlagUseIdealGasEnthalpyCorrelations = 0;
+static int FlagUseVirialCorrelations = 0, FlagUseIsothermCompressCorrelation = 0, FlagUseIdealGasEnthalpyCorrelations = 0,
+           FlagUseTabularHumidAir = 0;
 double f_factor(double T, double p);
 
 // A central place to check bounds, should be used much more frequently
@@ -228,6 +237,18 @@ void UseIdealGasEnthalpyCorrelations(int flag) {
         printf("UseIdealGasEnthalpyCorrelations takes an integer, either 0 (no) or 1 (yes)\n");
     }
 }
+void UseTabularHumidAir(int flag) {
+#if defined(NO_TABULAR_BACKENDS)
+    if (flag == 1) {
+        throw CoolProp::NotImplementedError("The tabular backends are not included in this build, so humid air cannot be tabulated");
+    }
+#endif
+    if (flag == 0 || flag == 1) {
+        FlagUseTabularHumidAir = flag;
+    } else {
+        printf("UseTabularHumidAir takes an integer, either 0 (no) or 1 (yes)\n");
+    }
+}
 static double Brent_HAProps_W(givens OutputKey, double p, givens In1Name, double Input1, double TargetVal, double W_min, double W_max) {
     // Iterating for W,
     double W;
@@ -367,8 +388,84 @@ static double Brent_HAProps_T(givens OutputKey, double p, givens In1Name, double
     }
     return T;
 }
+/// The derivative of the logarithm of the IF97 saturation pressure of water (the saturation-pressure equation of region 4) with respect to T [1/K]
+static double dlnpsat97_dT(double T) {
+    const double n1 = 0.11670521452767e4, n2 = -0.72421316703206e6, n3 = -0.17073846940092e2, n4 = 0.12020824702470e5,
+                 n5 = -0.32325550322333e7, n6 = 0.14915108613530e2, n7 = -0.48232657361591e4, n8 = 0.40511340542057e6,
+                 n9 = -0.23855557567849, n10 = 0.65017534844798e3;
+    double theta = T + n9 / (T - n10), dtheta_dT = 1 - n9 / ((T - n10) * (T - n10));
+    double A = theta * theta + n1 * theta + n2, B = n3 * theta * theta + n4 * theta + n5, C = n6 * theta * theta + n7 * theta + n8;
+    double dA = 2 * theta + n1, dB = 2 * n3 * theta + n4, dC = 2 * n6 * theta + n7;
+    double D = sqrt(B * B - 4 * A * C), dD = (B * dB - 2 * (dA * C + A * dC)) / D;
+    // p = (2*C/(D-B))^4
+    return 4 * (dC / C - (dD - dB) / (D - B)) * dtheta_dT;
+}
+/// The derivative of the logarithm of the saturation pressure of water over liquid water (T >= 273.16 K) or over ice with respect to T [1/K]
+static double dlnp_ws_dT(double T) {
+    if (T >= 273.16) {
+        return dlnpsat97_dT(T);
+    } else {
+        return dpsub_dT_Ice(T) / psub_Ice(T);
+    }
+}
+/**
+ * @brief The residual of the temperature at which humid air at pressure p is saturated with water at partial pressure p_w
+ *
+ * The residual is ln(f*p_ws(T)) - ln(p_w), which is nearly linear in 1/T.  Its derivative neglects the variation of the
+ * enhancement factor f with T, which is a few parts in 10^4 of that of ln(p_ws), so Newton's method converges about as
+ * fast as with the exact derivative.
+ */
+class SaturationTemperatureResidual : public CoolProp::FuncWrapper1DWithDeriv
+{
+   private:
+    double p, ln_p_w;
+
+   public:
+    SaturationTemperatureResidual(double p, double p_w) : p(p), ln_p_w(log(p_w)) {}
+    double call(double T) {
+        double p_ws;
+        if (T >= 273.16) {
+            // Saturation pressure [Pa]
+            p_ws = IF97::psat97(T);
+        } else {
+            // Sublimation pressure [Pa]
+            p_ws = psub_Ice(T);
+        }
+        return log(f_factor(T, p) * p_ws) - ln_p_w;
+    }
+    double deriv(double T) {
+        return dlnp_ws_dT(T);
+    }
+};
+/// Magnus-type estimate of the temperature [K] at which water vapor at partial pressure p_w [Pa] is saturated, over liquid water or over ice
+static double SaturationTemperature_Magnus(double p_w) {
+    double gamma = log(p_w / 611.2);
+    if (gamma >= 0) {
+        return 273.15 + 243.12 * gamma / (17.62 - gamma);
+    } else {
+        return 273.15 + 272.62 * gamma / (22.46 - gamma);
+    }
+}
+/// Find the temperature at which humid air at pressure p is saturated with water at partial pressure p_w with Newton's method; _HUGE if it fails
+static double Newton_saturation_temperature(double p, double p_w) {
+    if (!(p_w > 0 && p_w < p)) {
+        return _HUGE;
+    }
+    SaturationTemperatureResidual resid(p, p_w);
+    try {
+        double T = CoolProp::Newton(resid, SaturationTemperature_Magnus(p_w), 1e-10, 30);
+        if (ValidNumber(T) && T > 100 && T < 640) {
+            return T;
+        }
+    } catch (...) {
+    }
+    return _HUGE;
+}
 static double Secant_Tdb_at_saturated_W(double psi_w, double p, double T_guess) {
-    double T;
+    double T = Newton_saturation_temperature(p, psi_w * p);
+    if (ValidNumber(T)) {
+        return T;
+    }
     class BrentSolverResids : public CoolProp::FuncWrapper1D
     {
        private:
@@ -1143,6 +1240,13 @@ double DewpointTemperature(double T, double p, double psi_w) {
 
     p_w = psi_w * p;
 
+    // Newton's method, starting from the Magnus estimate of the dewpoint, usually converges in two or three steps
+    Tdp = Newton_saturation_temperature(p, p_w);
+    if (ValidNumber(Tdp)) {
+        return Tdp;
+    }
+    // Otherwise fall back to the secant method
+
     // 611.65... is the triple point pressure of water in Pa
     if (p_w > 611.6547241637944) {
         T0 = IF97::Tsat97(p) - 1;
@@ -1195,13 +1299,15 @@ double DewpointTemperature(double T, double p, double psi_w) {
     return Tdp;
 }
 
-class WetBulbSolver : public CoolProp::FuncWrapper1D
+class WetBulbSolver : public CoolProp::FuncWrapper1DWithDeriv
 {
    private:
     double _p, _W, LHS;
+    // The wetbulb temperature, saturation vapor pressure and humidity ratio of the last call
+    double Twb_last, p_s_last, W_s_last;
 
    public:
-    WetBulbSolver(double T, double p, double psi_w) : _p(p), _W(epsilon * psi_w / (1 - psi_w)) {
+    WetBulbSolver(double T, double p, double psi_w) : _p(p), _W(epsilon * psi_w / (1 - psi_w)), Twb_last(_HUGE), p_s_last(_HUGE), W_s_last(_HUGE) {
         //These things are all not a function of Twb
         double v_bar_w = MolarVolume(T, p, psi_w), M_ha = MM_Water() * psi_w + (1 - psi_w) * 0.028966;
         LHS = MolarEnthalpy(T, p, psi_w, v_bar_w) * (1 + _W) / M_ha;
@@ -1244,10 +1350,52 @@ class WetBulbSolver : public CoolProp::FuncWrapper1D
         if (!ValidNumber(LHS - RHS)) {
             throw CoolProp::ValueError();
         }
+        Twb_last = Twb;
+        p_s_last = p_s_wb;
+        W_s_last = W_s_wb;
         return LHS - RHS;
     }
+    /**
+     * The derivative of the residual, from the ideal-gas heat capacities and the latent heat of water.  The enthalpy of
+     * the saturated air changes with Twb both through its heat capacity and through the humidity ratio at saturation,
+     * which carries the latent heat; the variation of the enhancement factor is neglected.  The derivative is within
+     * a few tenths of a percent, which costs Newton's method about one extra step.
+     */
+    double deriv(double Twb) {
+        if (Twb != Twb_last) {
+            call(Twb);
+        }
+        double epsilon = 0.621945, cp_da = 1006, cp_v = 1860, cp_w, L;
+        if (Twb > 273.16) {
+            // Liquid water, and the latent heat of vaporization [J/kg_water]
+            cp_w = 4186;
+            L = 2.501e6 - 2370 * (Twb - 273.15);
+        } else {
+            // Ice, and the latent heat of sublimation [J/kg_water]
+            cp_w = 2100;
+            L = 2.834e6;
+        }
+        double dp_s_dT = p_s_last * dlnp_ws_dT(Twb);
+        double dW_s_dT = epsilon * _p / ((_p - p_s_last) * (_p - p_s_last)) * dp_s_dT;
+        double dRHS_dT = cp_da + W_s_last * cp_v + (_W - W_s_last) * cp_w + dW_s_dT * L;
+        return -dRHS_dT;
+    }
 };
 
+/**
+ * @brief The estimate of Stull (2011) of the wetbulb temperature [K]
+ *
+ * It is fitted at 101325 Pa for dry bulb temperatures from -20 C to 50 C and relative humidities from 5% to 99%, where it
+ * is within about 1 K; elsewhere it is only a starting point for the iteration.
+ *
+ * R. Stull, "Wet-Bulb Temperature from Relative Humidity and Air Temperature", J. Appl. Meteor. Climatol. 50 (2011) 2267-2269
+ */
+static double WetbulbTemperature_Stull(double T, double RH) {
+    double T_C = T - 273.15, RH_pct = 100 * std::min(std::max(RH, 0.0), 1.0);
+    return 273.15 + T_C * atan(0.151977 * sqrt(RH_pct + 8.313659)) + atan(T_C + RH_pct) - atan(RH_pct - 1.676331)
+           + 0.00391838 * pow(RH_pct, 1.5) * atan(0.023101 * RH_pct) - 4.686035;
+}
+
 class WetBulbTminSolver : public CoolProp::FuncWrapper1D
 {
    public:
@@ -1296,6 +1444,18 @@ double WetbulbTemperature(double T, double p, double psi_w) {
     WetBulbSolver WBS(T, p, psi_w);
 
     double return_val;
+    if (T < Tsat) {
+        // Newton's method, starting from the estimate of Stull; the relative humidity for the estimate neglects the enhancement factor
+        double p_ws = (T >= 273.16) ? IF97::psat97(T) : psub_Ice(T);
+        try {
+            return_val = Newton(WBS, std::min(WetbulbTemperature_Stull(T, psi_w * p / p_ws), Tmax), 1e-6, 30);
+            if (ValidNumber(return_val) && return_val > 100 && return_val <= Tmax + 1) {
+                return return_val;
+            }
+        } catch (...) {
+        }
+    }
+    // Otherwise bracket the solution
     try {
         return_val = Brent(WBS, Tmax + 1, 100, DBL_EPSILON, 1e-12, 50);
 
@@ -1598,6 +1758,82 @@ class HAProps_T_Residual : public CoolProp::FuncWrapper1D
     }
 };
 
+/**
+ * @brief The residual of the enthalpy per kg of dry air as a function of the humidity ratio at constant T
+ *
+ * The enthalpy is nearly linear in W; the derivative is the ideal-gas enthalpy of water vapor relative to liquid water at
+ * the reference state, h_g = 2501 kJ/kg + 1.86 kJ/kg/K*(T - 273.15 K), which is within a fraction of a percent.
+ */
+class HAProps_W_Enthalpy_Residual : public CoolProp::FuncWrapper1DWithDeriv
+{
+   private:
+    const double p, T, target;
+
+   public:
+    HAProps_W_Enthalpy_Residual(const double p, const double T, const double target) : p(p), T(T), target(target) {}
+    double call(double W) {
+        return MassEnthalpy_per_kgda(T, p, MoleFractionWater(T, p, GIVEN_HUMRAT, W)) - target;
+    }
+    double deriv(double W) {
+        return 2.501e6 + 1860 * (T - 273.15);
+    }
+    /// The humidity ratio from the ideal-gas psychrometric relation h = cp_da*(T - 273.15 K) + W*h_g
+    double guess() {
+        return std::max((target - 1006 * (T - 273.15)) / deriv(0), 0.0);
+    }
+};
+
+/**
+ * @brief The residual of the enthalpy per kg of dry air as a function of the dry bulb temperature at constant water content
+ *
+ * The derivative is the ideal-gas heat capacity of the humid air, cp_da + W*cp_v, which is within a few percent up to
+ * several hundred degrees C.
+ */
+class HAProps_T_Enthalpy_Residual : public CoolProp::FuncWrapper1DWithDeriv
+{
+   private:
+    const double p, psi_w, W, target;
+
+   public:
+    HAProps_T_Enthalpy_Residual(const double p, const double psi_w, const double target)
+      : p(p), psi_w(psi_w), W(HumidityRatio(psi_w)), target(target) {}
+    double call(double T) {
+        return MassEnthalpy_per_kgda(T, p, psi_w) - target;
+    }
+    double deriv(double T) {
+        return 1006 + 1860 * W;
+    }
+    /// The dry bulb temperature from the ideal-gas psychrometric relation h = cp_da*(T - 273.15 K) + W*h_g
+    double guess() {
+        return 273.15 + (target - 2.501e6 * W) / deriv(0);
+    }
+};
+
+/// Find W given T and the enthalpy per kg of dry air with Newton's method; _HUGE if it fails
+static double Newton_HAProps_W_enthalpy(double p, double T, double h) {
+    HAProps_W_Enthalpy_Residual resid(p, T, h);
+    try {
+        double W = CoolProp::Newton(resid, resid.guess(), 1e-6, 30);
+        if (ValidNumber(W) && W >= 0) {
+            return W;
+        }
+    } catch (...) {
+    }
+    return _HUGE;
+}
+
+/// Find T given the water mole fraction and the enthalpy per kg of dry air with Newton's method; _HUGE if it fails or if T is not in [T_min, T_max]
+static double Newton_HAProps_T_enthalpy(double p, double psi_w, double h, double T_min, double T_max) {
+    HAProps_T_Enthalpy_Residual resid(p, psi_w, h);
+    try {
+        double T = CoolProp::Newton(resid, std::min(std::max(resid.guess(), T_min), T_max), 1e-6, 30);
+        if (ValidNumber(T) && T >= T_min && T <= T_max) {
+            return T;
+        }
+    } catch (...) {
+    }
+    return _HUGE;
+}
 
 /// Calculate T (dry bulb temp) and psi_w (water mole fraction) given the pair of inputs
 void _HAPropsSI_inputs(double p, const std::vector<givens>& input_keys, const std::vector<double>& input_vals, double& T, double& psi_w) {
@@ -1628,8 +1864,16 @@ void _HAPropsSI_inputs(double p, const std::vector<givens>& input_keys, const st
                 psi_w = MoleFractionWater(T, p, othergiven, input_vals[other]);
                 break;
             default: {
-                HAProps_W_Residual residual(p, input_vals[other], othergiven, T);
                 double W = _HUGE;
+                if (othergiven == GIVEN_ENTHALPY) {
+                    // The enthalpy is nearly linear in W; Newton's method converges in a few steps
+                    W = Newton_HAProps_W_enthalpy(p, T, input_vals[other]);
+                    if (ValidNumber(W)) {
+                        psi_w = MoleFractionWater(T, p, GIVEN_HUMRAT, W);
+                        break;
+                    }
+                }
+                HAProps_W_Residual residual(p, input_vals[other], othergiven, T);
                 try {
                     // Find the value for W using the Secant solver
                     W = CoolProp::Secant(&residual, 0.0001, 0.00001, 1e-14, 100);
@@ -1746,8 +1990,15 @@ void _HAPropsSI_inputs(double p, const std::vector<givens>& input_keys, const st
         }
 
         try {
-            // Use the Brent's method solver to find T_drybulb.  Slow but reliable
-            T = Brent_HAProps_T(SecondaryInputKey, p, MainInputKey, MainInputValue, SecondaryInputValue, T_min, T_max);
+            T = _HUGE;
+            if ((MainInputKey == GIVEN_HUMRAT || MainInputKey == GIVEN_TDP) && SecondaryInputKey == GIVEN_ENTHALPY) {
+                // The water content does not depend on T, and the enthalpy is nearly linear in T; Newton's method converges in a few steps
+                T = Newton_HAProps_T_enthalpy(p, MoleFractionWater(-1, p, MainInputKey, MainInputValue), SecondaryInputValue, T_min, T_max);
+            }
+            if (!ValidNumber(T)) {
+                // Use the Brent's method solver to find T_drybulb.  Slow but reliable
+                T = Brent_HAProps_T(SecondaryInputKey, p, MainInputKey, MainInputValue, SecondaryInputValue, T_min, T_max);
+            }
         } catch (std::exception& e) {
             if (CoolProp::get_debug_level() > 0) {
                 std::cout << "ERROR: " << e.what() << std::endl;
@@ -1888,8 +2139,184 @@ double _HAPropsSI_outputs(givens OutputType, double p, double T, double psi_w) {
             return _HUGE;
     }
 }
+static double _HAPropsSI(const std::string& OutputName, const std::string& Input1Name, double Input1, const std::string& Input2Name, double Input2,
+                         const std::string& Input3Name, double Input3, const CoolProp::HumidAirTableData* tables, bool check_limits);
+#if !defined(NO_TABULAR_BACKENDS)
+/// A property at a node of the humid air tables, from the full calculation; the nodes also cover supersaturated states and states
+/// beyond the limits of the inputs of HAPropsSI, so the limits are not checked
+static double tabulated_property(const std::string& OutputName, double p, double T, const std::string& InputName, double value) {
+    double val = _HAPropsSI(OutputName, "P", p, "T", T, InputName, value, NULL, false);
+    return ValidNumber(val) ? val : std::numeric_limits<double>::quiet_NaN();
+}
+static CoolProp::HumidAirTableData humid_air_table_data;
+static std::once_flag humid_air_tables_loaded;
+static void load_humid_air_tables() {
+    std::string path_to_tables = CoolProp::get_tables_directory() + "HumidAir";
+    try {
+        humid_air_table_data.load(path_to_tables);
+    } catch (std::exception& e) {
+        if (CoolProp::get_debug_level() > 0) {
+            std::cout << format("Loading the humid air tables failed with error: %s\n", e.what());
+        }
+        humid_air_table_data.build(tabulated_property);
+        try {
+            humid_air_table_data.write(path_to_tables);
+        } catch (std::exception& e) {
+            CoolProp::set_warning_string(format("Unable to write the humid air tables: %s", e.what()));
+        }
+    }
+}
+/// The humid air tables; they are loaded from the tables directory, or built and written there, the first time they are needed
+static const CoolProp::HumidAirTableData& humid_air_tables() {
+    std::call_once(humid_air_tables_loaded, load_humid_air_tables);
+    return humid_air_table_data;
+}
+/**
+ * @brief Calculate T (dry bulb temp) and psi_w (water mole fraction) given the pair of inputs, with the tables
+ *
+ * The pairs that are supported are T with one of W, R, D, H or B, and W or D with one of H or B; the saturation surface
+ * gives W for R and D, and H and B are inverted in the tables.  For the other pairs, or outside of the tables, false is
+ * returned and the full calculation should be used.
+ */
+static bool _HAPropsSI_inputs_tabular(const CoolProp::HumidAirTableData& tables, double p, const std::vector<givens>& input_keys,
+                                      const std::vector<double>& input_vals, double& T, double& psi_w) {
+    double T_tab = _HUGE, W = _HUGE;
+    long key = get_input_key(input_keys, GIVEN_T);
+    if (key >= 0) {
+        T_tab = input_vals[key];
+        double value = input_vals[1 - key];
+        switch (input_keys[1 - key]) {
+            case GIVEN_HUMRAT:
+                W = value;
+                break;
+            case GIVEN_RH:
+                W = HumidityRatio(value * tables.evaluate_surface(tables.psi_w_sat, p, T_tab));
+                break;
+            case GIVEN_TDP:
+                W = HumidityRatio(tables.evaluate_surface(tables.psi_w_sat, p, value));
+                break;
+            case GIVEN_ENTHALPY:
+                if (!tables.solve_for_W(tables.hda, p, T_tab, value, W)) {
+                    return false;
+                }
+                break;
+            case GIVEN_TWB:
+                if (!tables.solve_for_W(tables.Twb, p, T_tab, value, W)) {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+    } else {
+        if ((key = get_input_key(input_keys, GIVEN_HUMRAT)) >= 0) {
+            W = input_vals[key];
+        } else if ((key = get_input_key(input_keys, GIVEN_TDP)) >= 0) {
+            W = HumidityRatio(tables.evaluate_surface(tables.psi_w_sat, p, input_vals[key]));
+        } else {
+            return false;
+        }
+        double value = input_vals[1 - key];
+        switch (input_keys[1 - key]) {
+            case GIVEN_ENTHALPY:
+                if (!tables.solve_for_T(tables.hda, p, W, value, T_tab)) {
+                    return false;
+                }
+                break;
+            case GIVEN_TWB:
+                if (!tables.solve_for_T(tables.Twb, p, W, value, T_tab)) {
+                    return false;
+                }
+                break;
+            default:
+                return false;
+        }
+    }
+    if (!ValidNumber(W) || !tables.in_range(p, T_tab, W)) {
+        return false;
+    }
+    T = T_tab;
+    psi_w = MoleFractionWater(T, p, GIVEN_HUMRAT, W);
+    return true;
+}
+/// Calculate the output from the tables if it is tabulated; returns false if it is not, and the full calculation should be used
+static bool _HAPropsSI_outputs_tabular(const CoolProp::HumidAirTableData& tables, givens OutputType, double p, double T, double psi_w,
+                                       double& val) {
+    double W = HumidityRatio(psi_w);  //[kg_w/kg_da] // (1+W) is kg_ha/kg_da
+    if (!tables.in_range(p, T, W)) {
+        return false;
+    }
+    switch (OutputType) {
+        case GIVEN_ENTHALPY:
+            val = tables.evaluate(tables.hda, p, T, W);
+            break;
+        case GIVEN_ENTHALPY_HA:
+            val = tables.evaluate(tables.hda, p, T, W) / (1 + W);
+            break;
+        case GIVEN_ENTROPY:
+            val = tables.evaluate(tables.sda, p, T, W);
+            break;
+        case GIVEN_ENTROPY_HA:
+            val = tables.evaluate(tables.sda, p, T, W) / (1 + W);
+            break;
+        case GIVEN_VDA:
+            val = tables.evaluate(tables.vda, p, T, W);
+            break;
+        case GIVEN_VHA:
+            val = tables.evaluate(tables.vda, p, T, W) / (1 + W);
+            break;
+        case GIVEN_CP:
+            val = tables.evaluate(tables.cpda, p, T, W);
+            break;
+        case GIVEN_CPHA:
+            val = tables.evaluate(tables.cpda, p, T, W) / (1 + W);
+            break;
+        case GIVEN_TWB:
+            val = tables.evaluate(tables.Twb, p, T, W);
+            break;
+        case GIVEN_VISC:
+            val = tables.evaluate(tables.visc, p, T, W);
+            break;
+        case GIVEN_COND:
+            val = tables.evaluate(tables.cond, p, T, W);
+            break;
+        case GIVEN_COMPRESSIBILITY_FACTOR:
+            val = tables.evaluate(tables.Z, p, T, W);
+            break;
+        case GIVEN_RH:
+            val = psi_w / tables.evaluate_surface(tables.psi_w_sat, p, T);
+            break;
+        case GIVEN_TDP:
+            if (!tables.solve_surface_for_T(tables.psi_w_sat, p, psi_w, val)) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    return ValidNumber(val);
+}
+#else
+static bool _HAPropsSI_inputs_tabular(const CoolProp::HumidAirTableData&, double, const std::vector<givens>&, const std::vector<double>&, double&,
+                                      double&) {
+    return false;
+}
+static bool _HAPropsSI_outputs_tabular(const CoolProp::HumidAirTableData&, givens, double, double, double, double&) {
+    return false;
+}
+#endif
 double HAPropsSI(const std::string& OutputName, const std::string& Input1Name, double Input1, const std::string& Input2Name, double Input2,
                  const std::string& Input3Name, double Input3) {
+#if !defined(NO_TABULAR_BACKENDS)
+    if (FlagUseTabularHumidAir) {
+        return _HAPropsSI(OutputName, Input1Name, Input1, Input2Name, Input2, Input3Name, Input3, &humid_air_tables(), true);
+    }
+#endif
+    return _HAPropsSI(OutputName, Input1Name, Input1, Input2Name, Input2, Input3Name, Input3, NULL, true);
+}
+/// HAPropsSI with the given tables (NULL for the full calculation), and optionally without checking the limits of the inputs and outputs
+static double _HAPropsSI(const std::string& OutputName, const std::string& Input1Name, double Input1, const std::string& Input2Name, double Input2,
+                         const std::string& Input3Name, double Input3, const CoolProp::HumidAirTableData* tables, bool check_limits) {
     try {
         // Add a check to make sure that Air and Water fluid states have been properly instantiated
         check_fluid_instantiation();
@@ -1956,7 +2383,7 @@ double HAPropsSI(const std::string& OutputName, const std::string& Input1Name, d
         // Check the input values
         double min_val = _HUGE, max_val = -_HUGE;  // Initialize with invalid values
         for (std::size_t i = 0; i < input_keys.size(); i++) {
-            if (!check_bounds(input_keys[i], input_vals[i], min_val, max_val)) {
+            if (check_limits && !check_bounds(input_keys[i], input_vals[i], min_val, max_val)) {
                 throw CoolProp::ValueError(format("The input for key (%d) with value (%g) is outside the range of validity: (%g) to (%g)",
                                                   input_keys[i], input_vals[i], min_val, max_val));
                 //if (CoolProp::get_debug_level() > 0) {
@@ -1965,26 +2392,28 @@ double HAPropsSI(const std::string& OutputName, const std::string& Input1Name, d
             }
         }
         // Parse the inputs to get to set of p, T, psi_w
-        _HAPropsSI_inputs(p, input_keys, input_vals, T, psi_w);
+        if (!(tables && _HAPropsSI_inputs_tabular(*tables, p, input_keys, input_vals, T, psi_w))) {
+            _HAPropsSI_inputs(p, input_keys, input_vals, T, psi_w);
+        }
 
         if (CoolProp::get_debug_level() > 0) {
             std::cout << format("HAPropsSI input conversion yields T: %g, psi_w: %g\n", T, psi_w);
         }
 
         // Check the standardized input values
-        if (!check_bounds(GIVEN_P, p, min_val, max_val)) {
+        if (check_limits && !check_bounds(GIVEN_P, p, min_val, max_val)) {
             throw CoolProp::ValueError(format("The pressure value (%g) is outside the range of validity: (%g) to (%g)", p, min_val, max_val));
             //if (CoolProp::get_debug_level() > 0) {
             //    std::cout << format("The pressure value (%g) is outside the range of validity: (%g) to (%g)", p, min_val, max_val);
             //}
         }
-        if (!check_bounds(GIVEN_T, T, min_val, max_val)) {
+        if (check_limits && !check_bounds(GIVEN_T, T, min_val, max_val)) {
             throw CoolProp::ValueError(format("The temperature value (%g) is outside the range of validity: (%g) to (%g)", T, min_val, max_val));
             //if (CoolProp::get_debug_level() > 0) {
             //    std::cout << format("The temperature value (%g) is outside the range of validity: (%g) to (%g)", T, min_val, max_val);
             //}
         }
-        if (!check_bounds(GIVEN_PSIW, psi_w, min_val, max_val)) {
+        if (check_limits && !check_bounds(GIVEN_PSIW, psi_w, min_val, max_val)) {
             throw CoolProp::ValueError(
               format("The water mole fraction value (%g) is outside the range of validity: (%g) to (%g)", psi_w, min_val, max_val));
             //if (CoolProp::get_debug_level() > 0) {
@@ -1992,9 +2421,12 @@ double HAPropsSI(const std::string& OutputName, const std::string& Input1Name, d
             //}
         }
         // Calculate the output value desired
-        double val = _HAPropsSI_outputs(OutputType, p, T, psi_w);
+        double val = _HUGE;
+        if (!(tables && _HAPropsSI_outputs_tabular(*tables, OutputType, p, T, psi_w, val))) {
+            val = _HAPropsSI_outputs(OutputType, p, T, psi_w);
+        }
         // Check the output value
-        if (!check_bounds(OutputType, val, min_val, max_val)) {
+        if (check_limits && !check_bounds(OutputType, val, min_val, max_val)) {
             throw CoolProp::ValueError(
               format("The output for key (%d) with value (%g) is outside the range of validity: (%g) to (%g)", OutputType, val, min_val, max_val));
             //if (CoolProp::get_debug_level() > 0) {
@@ -2392,6 +2824,138 @@ TEST_CASE("Assorted tests", "[HAPropsSI]") {
     CHECK(ValidNumber(HumidAir::HAPropsSI("T", "B", 252.84, "W", 5.097e-4, "P", 101325)));
     CHECK(ValidNumber(HumidAir::HAPropsSI("T", "B", 290, "R", 1, "P", 101325)));
 }
+/// Counts the evaluations of a residual, for comparing the solvers
+class CountingResidual : public CoolProp::FuncWrapper1DWithDeriv
+{
+   public:
+    CoolProp::FuncWrapper1DWithDeriv& f;
+    int calls;
+    CountingResidual(CoolProp::FuncWrapper1DWithDeriv& f) : f(f), calls(0) {}
+    double call(double x) {
+        calls++;
+        return f.call(x);
+    }
+    double deriv(double x) {
+        return f.deriv(x);
+    }
+};
+TEST_CASE("Newton solvers of humid air need fewer evaluations than the bracketing solvers", "[HAPropsSI][Newton]") {
+    // The reference solutions use the solvers and starting points that were used before the Newton solvers
+    double states[][3] = {{300, 101325, 0.5}, {280, 101325, 0.9}, {260, 101325, 0.6}, {320, 200000, 0.3}, {295, 85000, 0.05}};
+    for (std::size_t i = 0; i < sizeof(states) / sizeof(states[0]); ++i) {
+        double T = states[i][0], p = states[i][1], psi_w = HumidAir::MoleFractionWater(T, p, HumidAir::GIVEN_RH, states[i][2]);
+        double W = HumidAir::HumidityRatio(psi_w), h = HumidAir::MassEnthalpy_per_kgda(T, p, psi_w);
+        CAPTURE(T);
+        CAPTURE(p);
+        CAPTURE(psi_w);
+
+        // Dewpoint
+        HumidAir::SaturationTemperatureResidual resid_dp(p, psi_w * p);
+        CountingResidual newton_dp(resid_dp), secant_dp(resid_dp);
+        double Tdp = CoolProp::Newton(newton_dp, HumidAir::SaturationTemperature_Magnus(psi_w * p), 1e-10, 30);
+        double Tdp_secant = CoolProp::Secant(secant_dp, (psi_w * p > 611.6547241637944) ? IF97::Tsat97(p) - 1 : 268, 0.1, 1e-10, 100);
+        CAPTURE(newton_dp.calls);
+        CAPTURE(secant_dp.calls);
+        CHECK(newton_dp.calls < secant_dp.calls);
+        CHECK(std::abs(Tdp - Tdp_secant) < 1e-6);
+        CHECK(std::abs(HumidAir::DewpointTemperature(T, p, psi_w) - Tdp) < 1e-6);
+        CHECK(std::abs(HumidAir::MoleFractionWater(-1, p, HumidAir::GIVEN_TDP, Tdp) / psi_w - 1) < 1e-9);
+
+        // Wetbulb
+        HumidAir::WetBulbSolver resid_wb(T, p, psi_w);
+        CountingResidual newton_wb(resid_wb), brent_wb(resid_wb);
+        double p_ws = (T >= 273.16) ? IF97::psat97(T) : psub_Ice(T);
+        double Twb = CoolProp::Newton(newton_wb, HumidAir::WetbulbTemperature_Stull(T, psi_w * p / p_ws), 1e-6, 30);
+        double Twb_brent = CoolProp::Brent(brent_wb, T + 1, 100, DBL_EPSILON, 1e-12, 50);
+        CAPTURE(newton_wb.calls);
+        CAPTURE(brent_wb.calls);
+        CHECK(newton_wb.calls < brent_wb.calls);
+        CHECK(std::abs(Twb - Twb_brent) < 1e-6);
+        CHECK(std::abs(HumidAir::WetbulbTemperature(T, p, psi_w) - Twb) < 1e-6);
+
+        // Humidity ratio from the enthalpy at constant T
+        HumidAir::HAProps_W_Enthalpy_Residual resid_W(p, T, h);
+        CountingResidual newton_W(resid_W), secant_W(resid_W);
+        double W_newton = CoolProp::Newton(newton_W, resid_W.guess(), 1e-6, 30);
+        double W_secant = CoolProp::Secant(secant_W, 0.0001, 0.00001, 1e-14, 100);
+        CAPTURE(newton_W.calls);
+        CAPTURE(secant_W.calls);
+        CHECK(newton_W.calls < secant_W.calls);
+        CHECK(std::abs(W_newton / W - 1) < 1e-8);
+        CHECK(std::abs(W_secant / W - 1) < 1e-8);
+        CHECK(std::abs(HumidAir::HAPropsSI("W", "T", T, "P", p, "H", h) / W - 1) < 1e-8);
+
+        // Dry bulb temperature from the enthalpy at constant W, bracketed by the dewpoint as in _HAPropsSI_inputs
+        HumidAir::HAProps_T_Enthalpy_Residual resid_T(p, psi_w, h);
+        CountingResidual newton_T(resid_T), brent_T(resid_T);
+        double T_newton = CoolProp::Newton(newton_T, resid_T.guess(), 1e-6, 30);
+        double T_brent = CoolProp::Brent(brent_T, Tdp, 450, 1e-15, 1e-10, 50);
+        CAPTURE(newton_T.calls);
+        CAPTURE(brent_T.calls);
+        CHECK(newton_T.calls < brent_T.calls);
+        CHECK(std::abs(T_newton - T) < 1e-6);
+        CHECK(std::abs(T_brent - T) < 1e-6);
+        CHECK(std::abs(HumidAir::HAPropsSI("T", "W", W, "P", p, "H", h) - T) < 1e-6);
+    }
+}
+#    if !defined(NO_TABULAR_BACKENDS)
+TEST_CASE("Tabular humid air agrees with the full calculation", "[HAPropsSI][Tabular]") {
+    // Smaller tables than the default ones, which just cover the calls; still 2 K steps in T, with a node at the triple point of water
+    static CoolProp::HumidAirTableData tables;
+    if (tables.hda.empty()) {
+        tables.Np = 4;
+        tables.pmin = 80000;
+        tables.pmax = 125000;
+        tables.NT = 46;
+        tables.Tmin = 253.16;
+        tables.Tmax = 343.16;
+        tables.NW = 25;
+        tables.Wmax = 0.06;
+        tables.build(HumidAir::tabulated_property);
+    }
+    // The expected values are calculated without the tables; the last call is outside of the tables, all the others must be taken from them
+    hel calls[] = {hel("T", 300, "R", 0.5, "P", 101325, "H", _HUGE),   hel("T", 300, "R", 0.5, "P", 101325, "W", _HUGE),
+                   hel("T", 300, "R", 0.5, "P", 101325, "B", _HUGE),   hel("H", 50000, "W", 0.01, "P", 101325, "T", _HUGE),
+                   hel("H", 50000, "W", 0.01, "P", 101325, "R", _HUGE), hel("T", 300, "B", 290, "P", 101325, "W", _HUGE),
+                   hel("T", 300, "B", 290, "P", 101325, "H", _HUGE),   hel("D", 285, "T", 300, "P", 101325, "W", _HUGE),
+                   hel("D", 285, "T", 300, "P", 101325, "V", _HUGE),   hel("T", 300, "W", 0.01, "P", 85000, "D", _HUGE),
+                   hel("T", 260, "W", 0.001, "P", 101325, "R", _HUGE), hel("T", 300, "W", 0.01, "P", 101325, "M", _HUGE),
+                   hel("B", 290, "W", 0.008, "P", 101325, "T", _HUGE), hel("T", 330, "W", 0.05, "P", 120000, "C", _HUGE),
+                   hel("T", 300, "R", 0.5, "P", 1e6, "H", _HUGE)};
+    for (std::size_t i = 0; i < sizeof(calls) / sizeof(calls[0]); ++i) {
+        hel& c = calls[i];
+        c.expected = HumidAir::HAPropsSI(c.out, c.in1, c.v1, c.in2, c.v2, c.in3, c.v3);
+        double actual = HumidAir::_HAPropsSI(c.out, c.in1, c.v1, c.in2, c.v2, c.in3, c.v3, &tables, true);
+        CAPTURE(c.in1);
+        CAPTURE(c.v1);
+        CAPTURE(c.in2);
+        CAPTURE(c.v2);
+        CAPTURE(c.in3);
+        CAPTURE(c.v3);
+        CAPTURE(c.out);
+        CAPTURE(actual);
+        CAPTURE(c.expected);
+        CHECK(std::abs(actual / c.expected - 1) < 1e-4);
+        // The pressure is the third input of all the calls
+        bool in_tables = (i + 1 < sizeof(calls) / sizeof(calls[0]));
+        std::vector<HumidAir::givens> input_keys(2);
+        std::vector<double> input_vals(2);
+        input_keys[0] = HumidAir::Name2Type(c.in1);
+        input_keys[1] = HumidAir::Name2Type(c.in2);
+        input_vals[0] = c.v1;
+        input_vals[1] = c.v2;
+        double T = _HUGE, psi_w = _HUGE;
+        CHECK(HumidAir::_HAPropsSI_inputs_tabular(tables, c.v3, input_keys, input_vals, T, psi_w) == in_tables);
+        // The humidity ratio and the temperature are not tabulated since they follow directly from T and psi_w
+        HumidAir::givens output_key = HumidAir::Name2Type(c.out);
+        if (in_tables && output_key != HumidAir::GIVEN_HUMRAT && output_key != HumidAir::GIVEN_T) {
+            double val = _HUGE;
+            CHECK(HumidAir::_HAPropsSI_outputs_tabular(tables, output_key, c.v3, T, psi_w, val));
+            CHECK(std::abs(val / c.expected - 1) < 1e-4);
+        }
+    }
+}
+#    endif
 // a predicate implemented as a function:
 bool is_not_a_pair(const std::set<std::size_t>& item) {
     return item.size() != 2;
@@ -48,6 +48,23 @@ double psub_Ice(double T) {
 #endif
 }
 
+double dpsub_dT_Ice(double T) {
+#ifndef __powerpc__
+    double a[] = {0, -0.212144006e2, 0.273203819e2, -0.610598130e1};
+    double b[] = {0, 0.333333333e-2, 0.120666667e1, 0.170333333e1};
+    double summer = 0, dsummer_dtheta = 0, theta;
+    theta = T / T_t;
+    for (int i = 1; i <= 3; i++) {
+        summer += a[i] * pow(theta, b[i]);
+        dsummer_dtheta += a[i] * b[i] * pow(theta, b[i] - 1);
+    }
+    // Derivative of p_t*exp(summer/theta), with dtheta/dT = 1/T_t
+    return p_t * exp(1 / theta * summer) * (dsummer_dtheta / theta - summer / (theta * theta)) / T_t;
+#else
+    return 1e99;
+#endif
+}
+
 double g_Ice(double T, double p) {
 #ifndef __powerpc__
     std::complex<double> r2, term1, term2;
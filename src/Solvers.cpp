@@ -3,6 +3,7 @@
 #include "math.h"
 #include "MatrixMath.h"
 #include <iostream>
+#include <algorithm>
 #include "CoolPropTools.h"
 #include <Eigen/Dense>
 
@@ -134,6 +135,71 @@ double Newton(FuncWrapper1DWithDeriv* f, double x0, double ftol, int maxiter) {
     return x;
 }
 /**
+In the bounded Newton function, a 1-D Newton-Raphson solver with exact derivatives is safeguarded by a bracket of the solution (like rtsafe
+of Numerical Recipes). If the Newton step would leave the bracket, or would not shrink it at least as fast as bisection, a bisection step is
+taken instead. The bracket is tightened after each evaluation, so the solver converges like Newton's method close to the solution but cannot diverge.
+
+@param f A pointer to an instance of the FuncWrapper1DWithDeriv class that implements the call() and deriv() functions
+@param a One bound of the solution
+@param b The other bound of the solution; f(a) and f(b) must have opposite signs
+@param x0 The initial guess for the solution; the middle of the bracket is used if it is outside of the bracket
+@param xtol Tolerance (absolute) on the solution
+@param maxiter Maximum number of iterations
+@returns The solution; a ValueError is thrown if a and b do not bracket the solution, and a SolutionError if maxiter is reached
+*/
+double BoundedNewton(FuncWrapper1DWithDeriv* f, double a, double b, double x0, double xtol, int maxiter) {
+    f->errstring.clear();
+    double fa = f->call(a), fb = f->call(b);
+    if (!ValidNumber(fa) || !ValidNumber(fb)) {
+        throw ValueError(format("BoundedNewton f(a) or f(b) is invalid for a = %g, b = %g", a, b));
+    }
+    if (fa == 0) {
+        return a;
+    }
+    if (fb == 0) {
+        return b;
+    }
+    if (fa * fb > 0) {
+        throw ValueError(format("Inputs in BoundedNewton [%g,%g] do not bracket the root.  Function values are [%g,%g]", a, b, fa, fb));
+    }
+    // Orient the bracket such that f(xlo) < 0 < f(xhi)
+    double xlo = (fa < 0) ? a : b, xhi = (fa < 0) ? b : a;
+    double x = (x0 >= std::min(a, b) && x0 <= std::max(a, b)) ? x0 : 0.5 * (a + b);
+    double dx = std::abs(b - a), dxold = dx;
+    double fval = f->call(x), dfdx = f->deriv(x);
+    for (int iter = 1; iter <= maxiter; ++iter) {
+        if (!ValidNumber(fval)) {
+            throw ValueError(format("Residual function in BoundedNewton returned invalid number for x = %g", x));
+        }
+        if (fval == 0) {
+            return x;
+        } else if (fval < 0) {
+            xlo = x;
+        } else {
+            xhi = x;
+        }
+        bool leaves_bracket = ((x - xhi) * dfdx - fval) * ((x - xlo) * dfdx - fval) > 0;
+        if (!ValidNumber(dfdx) || dfdx == 0 || leaves_bracket || std::abs(2 * fval) > std::abs(dxold * dfdx)) {
+            // Bisection
+            dxold = dx;
+            dx = 0.5 * (xhi - xlo);
+            x = xlo + dx;
+        } else {
+            // Newton step
+            dxold = dx;
+            dx = -fval / dfdx;
+            x += dx;
+        }
+        if (std::abs(dx) < xtol) {
+            return x;
+        }
+        fval = f->call(x);
+        dfdx = f->deriv(x);
+    }
+    f->errstring = "reached maximum number of iterations";
+    throw SolutionError(format("BoundedNewton reached maximum number of iterations"));
+}
+/**
 In the Halley's method solver, two derivatives of the input variable are needed, it yields the following method:
 
 \f[
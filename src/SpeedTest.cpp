@@ -1,11 +1,20 @@
 #include <memory>
 #include "SpeedTest.h"
 #include "AbstractState.h"
+#include "Configuration.h"
+#include "Backends/Helmholtz/HelmholtzEOSMixtureBackend.h"
+#if !defined(NO_TABULAR_BACKENDS)
+#    include "Backends/Tabular/TabularBackends.h"
+#endif
 #include "DataStructures.h"
 #include "crossplatform_shared_ptr.h"
 
 #include <time.h>
 
+#if defined(ENABLE_CATCH)
+#    include <catch2/catch_all.hpp>
+#endif
+
 // A hack to make powerpc happy since sysClkRateGet not found
 #if defined(__powerpc__)
 #    define CLOCKS_PER_SEC 1000
@@ -37,4 +46,114 @@ void compare_REFPROP_and_CoolProp(const std::string& fluid, CoolProp::input_pair
     std::cout << format("Elapsed time for REFPROP is %g us/call\n", elap);
 }
 
+std::vector<double> compare_tolerance_tiers(const std::string& fluid, int inputs, double val1, double val2, std::size_t N, double d1, double d2) {
+    const tolerance_tiers tiers[] = {iTOLERANCE_EXACT, iTOLERANCE_STANDARD, iTOLERANCE_FAST};
+    const char* names[] = {"exact", "standard", "fast"};
+    std::vector<double> max_errors(3);
+
+    shared_ptr<AbstractState> State(AbstractState::factory("HEOS", fluid));
+    std::vector<double> T_exact(N), rho_exact(N);
+    for (std::size_t i = 0; i < 3; ++i) {
+        State->set_tolerance_tier(tiers[i]);
+        std::vector<double> T(N), rho(N);
+        time_t t1 = clock();
+        for (std::size_t ii = 0; ii < N; ++ii) {
+            State->update(static_cast<input_pairs>(inputs), val1 + ii * d1, val2 + ii * d2);
+            T[ii] = State->T();
+            rho[ii] = State->rhomolar();
+        }
+        time_t t2 = clock();
+        if (i == 0) {
+            T_exact = T;
+            rho_exact = rho;
+        }
+        double max_err = 0;
+        for (std::size_t ii = 0; ii < N; ++ii) {
+            max_err = std::max(max_err, std::abs(T[ii] / T_exact[ii] - 1));
+            max_err = std::max(max_err, std::abs(rho[ii] / rho_exact[ii] - 1));
+        }
+        double elap = ((double)(t2 - t1)) / CLOCKS_PER_SEC / ((double)N) * 1e6;
+        std::cout << format("Tier %-8s: %g us/call; max. relative deviation from exact tier is %g\n", names[i], elap, max_err);
+        max_errors[i] = max_err;
+    }
+    return max_errors;
+}
+
+void compare_cubic_guesses(const std::string& fluids, const std::vector<double>& z, int inputs, double val1, double val2, std::size_t N, double d1,
+                           double d2) {
+    const char* names[] = {"Wilson", "Peng-Robinson"};
+    bool seeded = get_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES);
+
+    shared_ptr<AbstractState> State(AbstractState::factory("HEOS", fluids));
+    State->set_mole_fractions(z);
+    std::vector<double> T_ref(N), rho_ref(N);
+    for (std::size_t i = 0; i < 2; ++i) {
+        set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, i == 1);
+        // Build the Peng-Robinson model outside of the timed loop
+        State->update(static_cast<input_pairs>(inputs), val1, val2);
+        std::vector<double> T(N), rho(N);
+        HelmholtzEOSMixtureBackend::reset_residual_helmholtz_evaluations();
+        time_t t1 = clock();
+        for (std::size_t ii = 0; ii < N; ++ii) {
+            State->update(static_cast<input_pairs>(inputs), val1 + ii * d1, val2 + ii * d2);
+            T[ii] = State->T();
+            rho[ii] = State->rhomolar();
+        }
+        time_t t2 = clock();
+        double evaluations = static_cast<double>(HelmholtzEOSMixtureBackend::residual_helmholtz_evaluations()) / N;
+        if (i == 0) {
+            T_ref = T;
+            rho_ref = rho;
+        }
+        double max_err = 0;
+        for (std::size_t ii = 0; ii < N; ++ii) {
+            max_err = std::max(max_err, std::abs(T[ii] / T_ref[ii] - 1));
+            max_err = std::max(max_err, std::abs(rho[ii] / rho_ref[ii] - 1));
+        }
+        double elap = ((double)(t2 - t1)) / CLOCKS_PER_SEC / ((double)N) * 1e6;
+        std::cout << format("Guesses from %-13s: %g us/call, %g evaluations of the multiparameter model per call; max. relative deviation is %g\n",
+                            names[i], elap, evaluations, max_err);
+    }
+    set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, seeded);
+}
+
+#if !defined(NO_TABULAR_BACKENDS)
+void compare_table_build(const std::string& fluid, std::size_t Nx, std::size_t Ny) {
+    const char* names[] = {"flashes", "continuation"};
+    bool continuation = get_config_bool(TABULAR_ISOBAR_CONTINUATION);
+
+    shared_ptr<AbstractState> HEOS(AbstractState::factory("HEOS", fluid));
+    for (std::size_t i = 0; i < 2; ++i) {
+        set_config_bool(TABULAR_ISOBAR_CONTINUATION, i == 1);
+        LogPHTable ph;
+        LogPTTable pT;
+        SinglePhaseGriddedTableData* tables[2] = {&ph, &pT};
+        double elap = 0;
+        for (std::size_t k = 0; k < 2; ++k) {
+            tables[k]->Nx = Nx;
+            tables[k]->Ny = Ny;
+            tables[k]->AS = HEOS;
+            tables[k]->set_limits();
+            time_t t1 = clock();
+            tables[k]->build(HEOS);
+            time_t t2 = clock();
+            elap += ((double)(t2 - t1)) / CLOCKS_PER_SEC;
+        }
+        std::cout << format("Single-phase tables (%d x %d) built with %-12s: %g s\n", static_cast<int>(Nx), static_cast<int>(Ny), names[i], elap);
+    }
+    set_config_bool(TABULAR_ISOBAR_CONTINUATION, continuation);
+}
+#endif
+
+#if defined(ENABLE_CATCH)
+TEST_CASE("Speed test of the solver tolerance tiers", "[tolerance_tiers]") {
+    // Superheated water vapor at 1 MPa; the (h,p) flash uses both relative and absolute solver tolerances
+    std::vector<double> max_errors = compare_tolerance_tiers("Water", HmolarP_INPUTS, 52000, 1e6, 5, 500, 0);
+    REQUIRE(max_errors.size() == 3);
+    CHECK(max_errors[0] == 0);
+    CHECK(max_errors[1] < 1e-8);
+    CHECK(max_errors[2] < 1e-5);
+}
+#endif
+
 } /* namespace CoolProp */
@@ -4,6 +4,10 @@
 #include "DataStructures.h"
 #include "../Backends/Helmholtz/HelmholtzEOSMixtureBackend.h"
 #include "../Backends/Helmholtz/HelmholtzEOSBackend.h"
+#include "../Backends/IF97/IF97Backend.h"
+#if !defined(NO_TABULAR_BACKENDS)
+#    include "../Backends/Tabular/TransportSurrogate.h"
+#endif
 // ############################################
 //                      TESTS
 // ############################################
@@ -14,6 +18,10 @@
 #    include <catch2/catch_all.hpp>
 #    include "CoolPropTools.h"
 #    include "CoolProp.h"
+#    include <cstdio>
+#    include <cstdlib>
+#    include <cstring>
+#    include <ctime>
 
 using namespace CoolProp;
 
@@ -1961,6 +1969,617 @@ TEST_CASE("Check the phase flags", "[phase]") {
     }
 }
 
+TEST_CASE("Saturated states set without evaluating the EOS are consistent", "[saturated_states]") {
+    SECTION("HEOS, two-phase (p,h) flash") {
+        shared_ptr<CoolProp::AbstractState> QT(CoolProp::AbstractState::factory("HEOS", "Water"));
+        QT->update(QT_INPUTS, 0.3, 400);
+        shared_ptr<CoolProp::AbstractState> PH(CoolProp::AbstractState::factory("HEOS", "Water"));
+        PH->update(HmolarP_INPUTS, QT->hmolar(), QT->p());
+        CHECK(PH->phase() == iphase_twophase);
+        CHECK(std::abs(PH->Q() / 0.3 - 1) < 1e-6);
+        CHECK(std::abs(PH->smolar() / QT->smolar() - 1) < 1e-6);
+        parameters keys[] = {iP, iDmolar, iHmolar, iSmolar, iCpmolar, ispeed_sound};
+        for (std::size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+            CAPTURE(get_parameter_information(keys[i], "short"));
+            CHECK(std::abs(PH->saturated_liquid_keyed_output(keys[i]) / QT->saturated_liquid_keyed_output(keys[i]) - 1) < 1e-6);
+            CHECK(std::abs(PH->saturated_vapor_keyed_output(keys[i]) / QT->saturated_vapor_keyed_output(keys[i]) - 1) < 1e-6);
+        }
+    }
+    SECTION("Peng-Robinson, (Q,T) flash") {
+        shared_ptr<CoolProp::AbstractState> PR(CoolProp::AbstractState::factory("PR", "Propane"));
+        PR->update(QT_INPUTS, 0.5, 300);
+        shared_ptr<CoolProp::AbstractState> L(CoolProp::AbstractState::factory("PR", "Propane"));
+        L->specify_phase(iphase_liquid);
+        L->update(DmolarT_INPUTS, PR->saturated_liquid_keyed_output(iDmolar), 300);
+        shared_ptr<CoolProp::AbstractState> V(CoolProp::AbstractState::factory("PR", "Propane"));
+        V->specify_phase(iphase_gas);
+        V->update(DmolarT_INPUTS, PR->saturated_vapor_keyed_output(iDmolar), 300);
+        CHECK(std::abs(PR->saturated_liquid_keyed_output(iP) / L->p() - 1) < 1e-6);
+        CHECK(std::abs(PR->saturated_vapor_keyed_output(iP) / V->p() - 1) < 1e-6);
+        CHECK(std::abs(PR->saturated_liquid_keyed_output(iHmolar) / L->hmolar() - 1) < 1e-12);
+        CHECK(std::abs(PR->saturated_vapor_keyed_output(iCpmolar) / V->cpmolar() - 1) < 1e-12);
+        CHECK(std::abs(PR->hmolar() / (0.5 * L->hmolar() + 0.5 * V->hmolar()) - 1) < 1e-12);
+    }
+}
+
+TEST_CASE("Outputs for compressible flow solvers from density and internal energy", "[compressible_flow]") {
+    shared_ptr<CoolProp::AbstractState> REF(CoolProp::AbstractState::factory("HEOS", "Water"));
+    shared_ptr<CoolProp::AbstractState> CFD(CoolProp::AbstractState::factory("HEOS", "Water"));
+    // Liquid, vapor, supercritical and two-phase
+    double p[] = {1e5, 1e5, 3e7, -1}, T[] = {300, 500, 700, 400};
+    std::vector<double> rhomass, umass;
+    for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+        if (p[i] > 0) {
+            REF->update(PT_INPUTS, p[i], T[i]);
+        } else {
+            REF->update(QT_INPUTS, 0.4, T[i]);
+        }
+        rhomass.push_back(REF->rhomass());
+        umass.push_back(REF->umass());
+    }
+    for (std::size_t i = 0; i < rhomass.size(); ++i) {
+        CAPTURE(T[i]);
+        REF->update(DmassUmass_INPUTS, rhomass[i], umass[i]);
+        CoolProp::CompressibleFlowState state;
+        // Without a guess (a full flash), and then with the guess from a perturbed cell
+        for (int k = 0; k < 2; ++k) {
+            state.T = (k == 0) ? -1 : 1.05 * T[i];
+            CHECK_NOTHROW(CFD->compressible_flow_state(rhomass[i], umass[i], state));
+            CHECK(std::abs(state.T / REF->T() - 1) < 1e-9);
+            CHECK(std::abs(state.p / REF->p() - 1) < 1e-7);
+            CHECK(CFD->phase() == REF->phase());
+        }
+        if (REF->phase() != iphase_twophase) {
+            CHECK(std::abs(state.speed_sound / REF->speed_sound() - 1) < 1e-8);
+            CHECK(std::abs(state.dpdrho_e / REF->first_partial_deriv(iP, iDmass, iUmass) - 1) < 1e-8);
+            CHECK(std::abs(state.dpde_rho / REF->first_partial_deriv(iP, iUmass, iDmass) - 1) < 1e-8);
+        } else {
+            // Compare with centered differences of the full flash
+            double drho = 1e-5 * rhomass[i], de = 1e-5 * std::abs(umass[i]);
+            REF->update(DmassUmass_INPUTS, rhomass[i] + drho, umass[i]);
+            double pplus = REF->p();
+            REF->update(DmassUmass_INPUTS, rhomass[i] - drho, umass[i]);
+            CHECK(std::abs((pplus - REF->p()) / (2 * drho) / state.dpdrho_e - 1) < 1e-3);
+            REF->update(DmassUmass_INPUTS, rhomass[i], umass[i] + de);
+            pplus = REF->p();
+            REF->update(DmassUmass_INPUTS, rhomass[i], umass[i] - de);
+            CHECK(std::abs((pplus - REF->p()) / (2 * de) / state.dpde_rho - 1) < 1e-3);
+            CHECK(ValidNumber(state.speed_sound));
+        }
+    }
+    // All the cells at once, twice so that the second pass starts from the temperatures of the first
+    std::vector<CoolProp::CompressibleFlowState> states;
+    for (int pass = 0; pass < 2; ++pass) {
+        CFD->compressible_flow_states(rhomass, umass, states);
+        REQUIRE(states.size() == rhomass.size());
+        for (std::size_t i = 0; i < states.size(); ++i) {
+            REF->update(DmassUmass_INPUTS, rhomass[i], umass[i]);
+            CHECK(std::abs(states[i].T / REF->T() - 1) < 1e-9);
+        }
+    }
+}
+
+TEST_CASE("Transport properties from temperature and density, one point and in batches", "[transport_batch]") {
+    // A hardcoded model, a model built from its contributions, and a mixture of pure-component models
+    const char* fluids[] = {"Water", "Propane", "Methane&Ethane"};
+    // A gas and a dense single-phase (p, T) point for each of them
+    double p_gas[] = {1e5, 1e5, 1e5}, T_gas[] = {600, 400, 300}, p_dense[] = {1e7, 1e7, 1e7}, T_dense[] = {400, 300, 250};
+    for (std::size_t k = 0; k < sizeof(fluids) / sizeof(fluids[0]); ++k) {
+        CAPTURE(fluids[k]);
+        shared_ptr<CoolProp::AbstractState> REF(CoolProp::AbstractState::factory("HEOS", fluids[k]));
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", fluids[k]));
+        if (REF->get_mole_fractions().size() > 1) {
+            std::vector<double> z(2, 0.5);
+            REF->set_mole_fractions(z);
+            AS->set_mole_fractions(z);
+        }
+        // The gas and dense points, and a point that fails
+        std::vector<double> T, rhomolar;
+        REF->update(PT_INPUTS, p_gas[k], T_gas[k]);
+        T.push_back(REF->T());
+        rhomolar.push_back(REF->rhomolar());
+        REF->update(PT_INPUTS, p_dense[k], T_dense[k]);
+        T.push_back(REF->T());
+        rhomolar.push_back(REF->rhomolar());
+        T.push_back(-1);
+        rhomolar.push_back(1);
+
+        std::vector<double> viscosity, conductivity;
+        CHECK_NOTHROW(AS->transport_properties_batch(T, rhomolar, viscosity, conductivity));
+        REQUIRE(viscosity.size() == T.size());
+        REQUIRE(conductivity.size() == T.size());
+        for (std::size_t i = 0; i + 1 < T.size(); ++i) {
+            CAPTURE(T[i]);
+            REF->update(DmolarT_INPUTS, rhomolar[i], T[i]);
+            CHECK(std::abs(viscosity[i] / REF->viscosity() - 1) < 1e-12);
+            CHECK(std::abs(conductivity[i] / REF->conductivity() - 1) < 1e-12);
+            double eta = _HUGE, lambda = _HUGE;
+            AS->transport_properties(T[i], rhomolar[i], eta, lambda);
+            CHECK(eta == viscosity[i]);
+            CHECK(lambda == conductivity[i]);
+        }
+        CHECK(viscosity.back() == _HUGE);
+        CHECK(conductivity.back() == _HUGE);
+    }
+}
+
+#if !defined(NO_TABULAR_BACKENDS)
+/// A new directory for the tables of a test in the temporary directory of the system, with a trailing slash
+static std::string temporary_tables_directory(const std::string& name) {
+    const char* variables[] = {"TMPDIR", "TEMP", "TMP"};
+    std::string root = "/tmp";
+    for (std::size_t i = 0; i < sizeof(variables) / sizeof(variables[0]); ++i) {
+        const char* value = std::getenv(variables[i]);
+        if (value != NULL && std::strlen(value) > 0) {
+            root = value;
+            break;
+        }
+    }
+    return format("%s/CoolProp_%s_%ld/", root.c_str(), name.c_str(), static_cast<long>(time(NULL)));
+}
+TEST_CASE("Transport properties from the (T, log(rho)) tables agree with the full models", "[transport_surrogate]") {
+    // Liquid, vapor and supercritical points, and a point below the lowest density of the tables
+    double p[] = {1e5, 1e5, 3e7, -1}, T[] = {300, 500, 800, 500};
+    std::vector<double> Tvec, rhomolar, viscosity, conductivity;
+    shared_ptr<CoolProp::AbstractState> REF(CoolProp::AbstractState::factory("HEOS", "Water"));
+    for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+        if (p[i] > 0) {
+            REF->update(PT_INPUTS, p[i], T[i]);
+        } else {
+            REF->update(DmolarT_INPUTS, 1e-6, T[i]);
+        }
+        Tvec.push_back(REF->T());
+        rhomolar.push_back(REF->rhomolar());
+        viscosity.push_back(REF->viscosity());
+        conductivity.push_back(REF->conductivity());
+    }
+    // The tables are written to a temporary directory rather than to the tables directory of the user
+    const std::string tables_directory = CoolProp::get_config_string(ALTERNATIVE_TABLES_DIRECTORY);
+    const std::string directory = temporary_tables_directory("transport_surrogate");
+    const std::string path_to_tables = directory + "Transport(Water)";
+    CoolProp::set_config_string(ALTERNATIVE_TABLES_DIRECTORY, directory);
+    CoolProp::set_config_string(TRANSPORT_SURROGATE_FLUIDS, "Water");
+    shared_ptr<CoolProp::HelmholtzEOSMixtureBackend> HEOS(new CoolProp::HelmholtzEOSMixtureBackend(std::vector<std::string>(1, "Water")));
+    shared_ptr<CoolProp::TransportSurrogateData> tables = CoolProp::TransportSurrogateData::get(*HEOS);
+    CoolProp::set_config_string(ALTERNATIVE_TABLES_DIRECTORY, tables_directory);
+    REQUIRE(tables);
+    CHECK(tables->model_hash.size() == 8);
+    {
+        // The tables on disk are only loaded for the same model
+        CoolProp::TransportSurrogateData same, other;
+        same.set_limits(*HEOS);
+        same.model_hash = tables->model_hash;
+        CHECK_NOTHROW(same.load(path_to_tables));
+        other.set_limits(*HEOS);
+        other.model_hash = (tables->model_hash == "00000000") ? "00000001" : "00000000";
+        CHECK_THROWS(other.load(path_to_tables));
+    }
+    std::remove((path_to_tables + "/transport.bin.z").c_str());
+    std::remove((path_to_tables + "/transport.bin").c_str());
+    std::remove(path_to_tables.c_str());
+    std::remove(directory.c_str());
+    double tolerance = CoolProp::get_config_double(TRANSPORT_SURROGATE_TOLERANCE);
+    for (std::size_t i = 0; i < Tvec.size(); ++i) {
+        CAPTURE(Tvec[i]);
+        CAPTURE(rhomolar[i]);
+        HEOS->update(DmolarT_INPUTS, rhomolar[i], Tvec[i]);
+        if (p[i] > 0) {
+            // The single-phase points away from the critical point are in the tables
+            CHECK(ValidNumber(tables->viscosity(Tvec[i], rhomolar[i], tolerance)));
+            CHECK(ValidNumber(tables->conductivity(Tvec[i], rhomolar[i], tolerance)));
+            CHECK(std::abs(HEOS->viscosity() / viscosity[i] - 1) < 10 * tolerance);
+            CHECK(std::abs(HEOS->conductivity() / conductivity[i] - 1) < 10 * tolerance);
+        } else {
+            // Outside of the tables, the full models are used
+            CHECK(!ValidNumber(tables->viscosity(Tvec[i], rhomolar[i], tolerance)));
+            CHECK(HEOS->viscosity() == viscosity[i]);
+            CHECK(HEOS->conductivity() == conductivity[i]);
+        }
+    }
+    CoolProp::set_config_string(TRANSPORT_SURROGATE_FLUIDS, "");
+}
+#endif
+
+TEST_CASE("Memory footprints of the instances and the memory report", "[memory_report]") {
+    CoolProp::AbstractState::set_live_state_tracking(true);
+    std::map<std::string, std::size_t> counts0, bytes0, counts1, bytes1, counts2, bytes2;
+    CoolProp::AbstractState::live_states(counts0, bytes0);
+    shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", "Water"));
+    CoolProp::AbstractState::live_states(counts1, bytes1);
+    std::size_t n0 = 0, n1 = 0, n2 = 0;
+    for (std::map<std::string, std::size_t>::const_iterator it = counts0.begin(); it != counts0.end(); ++it) {
+        n0 += it->second;
+    }
+    for (std::map<std::string, std::size_t>::const_iterator it = counts1.begin(); it != counts1.end(); ++it) {
+        n1 += it->second;
+    }
+    SECTION("The instance and its saturated phases are live, and owned by the instance") {
+        CHECK(n1 >= n0 + 3);
+        CHECK(AS->memory_footprint() >= 3 * sizeof(CoolProp::HelmholtzEOSMixtureBackend));
+    }
+    SECTION("The report includes the fluid library and the live instances") {
+        CoolProp::MemoryReport report = CoolProp::get_memory_report();
+        CHECK(report.fluid_library_fluids > 100);
+        CHECK(report.fluid_library_bytes > report.fluid_library_fluids * sizeof(CoolProp::CoolPropFluid));
+        CHECK(report.live_states[AS->backend_name()] >= 1);
+        CHECK(report.total_bytes() >= report.fluid_library_bytes + report.live_state_bytes[AS->backend_name()]);
+        std::string JSON = CoolProp::get_global_param_string("memory_report");
+        CHECK(JSON.find("\"total_bytes\"") != std::string::npos);
+        CHECK(JSON.find("\"live_state_bytes\"") != std::string::npos);
+        CHECK(JSON.find("\"C_API_handles\"") != std::string::npos);
+    }
+    SECTION("The instances that are destroyed are no longer counted") {
+        AS.reset();
+        CoolProp::AbstractState::live_states(counts2, bytes2);
+        for (std::map<std::string, std::size_t>::const_iterator it = counts2.begin(); it != counts2.end(); ++it) {
+            n2 += it->second;
+        }
+        CHECK(n2 == n0);
+    }
+    SECTION("The phase envelope of a mixture is counted") {
+        shared_ptr<CoolProp::AbstractState> MIX(CoolProp::AbstractState::factory("HEOS", "Methane&Ethane"));
+        MIX->set_mole_fractions(std::vector<double>(2, 0.5));
+        std::size_t before = MIX->memory_footprint();
+        MIX->build_phase_envelope("");
+        CHECK(MIX->memory_footprint() > before);
+    }
+    SECTION("A copy is tracked on its own") {
+        CoolProp::IF97Backend IF97;
+        std::map<std::string, std::size_t> counts3, bytes3;
+        {
+            CoolProp::IF97Backend copy(IF97);
+            copy.memory_footprint();
+            CoolProp::AbstractState::live_states(counts3, bytes3);
+            CHECK(counts3[IF97.backend_name()] == 1);
+            IF97.memory_footprint();
+            CoolProp::AbstractState::live_states(counts3, bytes3);
+            CHECK(counts3[IF97.backend_name()] == 2);
+        }
+        CoolProp::AbstractState::live_states(counts3, bytes3);
+        CHECK(counts3[IF97.backend_name()] == 1);
+    }
+    SECTION("The instances that are constructed without tracking are not counted") {
+        CoolProp::AbstractState::set_live_state_tracking(false);
+        shared_ptr<CoolProp::AbstractState> untracked(CoolProp::AbstractState::factory("HEOS", "Water"));
+        CoolProp::AbstractState::live_states(counts2, bytes2);
+        for (std::map<std::string, std::size_t>::const_iterator it = counts2.begin(); it != counts2.end(); ++it) {
+            n2 += it->second;
+        }
+        CHECK(n2 == n1);
+        untracked.reset();
+    }
+    CoolProp::AbstractState::set_live_state_tracking(false);
+}
+
+TEST_CASE("JSON strings and descriptive data of the fluids of the library", "[fluid_library_JSON]") {
+    SECTION("The JSON string of a fluid from the embedded source is parsed out of it on demand") {
+        std::string JSON = CoolProp::get_fluid_param_string("Water", "JSON");
+        CHECK(JSON.find("7732-18-5") != std::string::npos);
+        CHECK(JSON.find(CoolProp::get_fluid_param_string("Water", "BibTeX-EOS")) != std::string::npos);
+        CHECK(CoolProp::get_fluid_param_string("R134a", "JSON").find("811-97-2") != std::string::npos);
+        CHECK(CoolProp::get_memory_report().fluid_library_JSON_bytes < 100000);
+    }
+    SECTION("The copies of a fluid share its descriptive data") {
+        std::vector<std::string> names(1, "Water");
+        CoolProp::HelmholtzEOSMixtureBackend HEOS1(names), HEOS2(names);
+        REQUIRE(HEOS1.get_components()[0].metadata);
+        CHECK(HEOS1.get_components()[0].metadata.get() == HEOS2.get_components()[0].metadata.get());
+        CHECK(HEOS1.fluid_param_string("formula") == HEOS1.get_components()[0].get_metadata().formula);
+        CHECK(!HEOS1.fluid_param_string("BibTeX-EOS").empty());
+        CHECK(!HEOS1.fluid_param_string("BibTeX-VISCOSITY").empty());
+        CHECK(!HEOS1.fluid_param_string("REFPROPName").empty());
+    }
+}
+
+TEST_CASE("Snapshots of states restored without any flash calculation", "[snapshot]") {
+    struct SnapshotCase
+    {
+        std::string backend, fluid;
+        input_pairs pair;
+        double value1, value2, other1, other2;
+    };
+    // Single-phase and two-phase states of pure fluids and mixtures, and the states that overwrite them before the restore
+    SnapshotCase cases[] = {{"HEOS", "Water", PT_INPUTS, 1e5, 300, 1e6, 500},          {"HEOS", "Water", QT_INPUTS, 0.3, 400, 0.6, 420},
+                            {"HEOS", "Methane&Ethane", PT_INPUTS, 1e6, 250, 2e6, 300}, {"HEOS", "Methane&Ethane", QT_INPUTS, 0, 200, 0, 210},
+                            {"IF97", "Water", HmassP_INPUTS, 1.5e6, 1e6, 2e6, 2e6},    {"IF97", "Water", PT_INPUTS, 1e6, 500, 1e5, 300},
+                            {"PR", "Propane", PT_INPUTS, 1e5, 300, 2e5, 350},          {"INCOMP", "MEG", PT_INPUTS, 1e5, 280, 2e5, 300},
+                            {"BICUBIC&HEOS", "Water", PT_INPUTS, 1e5, 300, 1e6, 500},  {"BICUBIC&HEOS", "Water", HmassP_INPUTS, 1.5e6, 1e5, 1e6, 2e5},
+                            {"TTSE&HEOS", "Water", PT_INPUTS, 1e5, 300, 1e6, 500},     {"TTSE&HEOS", "Water", HmassP_INPUTS, 1.5e6, 1e5, 1e6, 2e5}};
+    for (std::size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        const SnapshotCase& c = cases[i];
+        CAPTURE(c.backend);
+        CAPTURE(c.fluid);
+        CAPTURE(c.value1);
+        CAPTURE(c.value2);
+        shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory(c.backend, c.fluid));
+        shared_ptr<CoolProp::AbstractState> other(CoolProp::AbstractState::factory(c.backend, c.fluid));
+        if (c.backend == "INCOMP") {
+            AS->set_mass_fractions(std::vector<double>(1, 0.2));
+            other->set_mass_fractions(std::vector<double>(1, 0.2));
+        } else if (c.fluid.find('&') != std::string::npos) {
+            AS->set_mole_fractions(std::vector<double>(2, 0.5));
+            other->set_mole_fractions(std::vector<double>(2, 0.5));
+        }
+        AS->update(c.pair, c.value1, c.value2);
+        double T = AS->T(), p = AS->p(), rhomass = AS->rhomass(), hmass = AS->hmass();
+        std::vector<double> buffer = AS->snapshot();
+        AS->update(c.pair, c.other1, c.other2);
+        // In the same instance, and in another instance of the same backend
+        for (int k = 0; k < 2; ++k) {
+            shared_ptr<CoolProp::AbstractState>& restored = (k == 0) ? AS : other;
+            CAPTURE(k);
+            CHECK_NOTHROW(restored->restore(buffer));
+            CHECK(std::abs(restored->T() / T - 1) < 1e-12);
+            CHECK(std::abs(restored->p() / p - 1) < 1e-12);
+            CHECK(std::abs(restored->rhomass() / rhomass - 1) < 1e-12);
+            CHECK(std::abs(restored->hmass() - hmass) < 1e-12 * std::abs(hmass) + 1e-9);
+        }
+        if (c.pair == HmassP_INPUTS && c.backend != "IF97") {
+            CHECK(other->phase() == iphase_twophase);
+            CHECK(std::abs(other->Q() - AS->Q()) < 1e-12);
+        }
+        if (c.backend == "HEOS" && c.pair == QT_INPUTS) {
+            CHECK(other->phase() == iphase_twophase);
+            CHECK(std::abs(other->saturated_liquid_keyed_output(iDmolar) / AS->saturated_liquid_keyed_output(iDmolar) - 1) < 1e-12);
+            CHECK(std::abs(other->saturated_vapor_keyed_output(iDmolar) / AS->saturated_vapor_keyed_output(iDmolar) - 1) < 1e-12);
+        }
+    }
+    SECTION("Buffers that are not snapshots of the state are rejected") {
+        shared_ptr<CoolProp::AbstractState> Water(CoolProp::AbstractState::factory("HEOS", "Water"));
+        shared_ptr<CoolProp::AbstractState> IF97(CoolProp::AbstractState::factory("IF97", "Water"));
+        shared_ptr<CoolProp::AbstractState> MIX(CoolProp::AbstractState::factory("HEOS", "Methane&Ethane"));
+        MIX->set_mole_fractions(std::vector<double>(2, 0.5));
+        Water->update(PT_INPUTS, 1e5, 300);
+        MIX->update(PT_INPUTS, 1e6, 250);
+        std::vector<double> buffer = Water->snapshot();
+        CHECK_THROWS(IF97->restore(buffer));
+        CHECK_THROWS(MIX->restore(buffer));
+        CHECK_THROWS(Water->restore(MIX->snapshot()));
+        // Another fluid with the same number of components
+        shared_ptr<CoolProp::AbstractState> Ethanol(CoolProp::AbstractState::factory("HEOS", "Ethanol"));
+        Ethanol->update(PT_INPUTS, 1e5, 300);
+        CHECK_THROWS(Ethanol->restore(buffer));
+        buffer.pop_back();
+        CHECK_THROWS(Water->restore(buffer));
+        CHECK_THROWS(Water->restore(std::vector<double>()));
+    }
+    SECTION("A snapshot that cannot be restored leaves the state as it is") {
+        shared_ptr<CoolProp::AbstractState> MIX(CoolProp::AbstractState::factory("HEOS", "Methane&Ethane"));
+        MIX->set_mole_fractions(std::vector<double>(2, 0.5));
+        MIX->update(PT_INPUTS, 1e6, 250);
+        std::vector<double> buffer = MIX->snapshot();
+        std::vector<double> z(2);
+        z[0] = 0.3;
+        z[1] = 0.7;
+        MIX->set_mole_fractions(z);
+        MIX->update(PT_INPUTS, 2e6, 300);
+        double rhomolar = MIX->rhomolar();
+        // Truncated after the composition, with a header that is consistent with its length
+        buffer.pop_back();
+        buffer[3] = static_cast<double>(buffer.size());
+        CHECK_THROWS(MIX->restore(buffer));
+        CHECK(MIX->get_mole_fractions()[0] == 0.3);
+        CHECK(MIX->T() == 300);
+        CHECK(MIX->rhomolar() == rhomolar);
+    }
+}
+
+TEST_CASE("Global density solver with the stationary points of the isotherms kept", "[solver_rho_Tp_global]") {
+    std::vector<std::string> names(2);
+    names[0] = "Methane";
+    names[1] = "Ethane";
+    std::vector<CoolPropDbl> z(2);
+    z[0] = 0.4;
+    z[1] = 0.6;
+    shared_ptr<CoolProp::HelmholtzEOSMixtureBackend> HEOS(new CoolProp::HelmholtzEOSMixtureBackend(names));
+    HEOS->set_mole_fractions(z);
+    // An isotherm with two stationary points and one without any
+    double T[] = {200, 400}, p[] = {1e5, 1e6, 3e6, 1e7, 3e7};
+    for (int pass = 0; pass < 2; ++pass) {
+        if (pass == 1) {
+            // Changing the interaction parameters must not reuse the isotherms of the old mixture model
+            HEOS->set_binary_interaction_double(0, 1, "gammaT", 1.1 * HEOS->get_binary_interaction_double(0, 1, "gammaT"));
+        }
+        for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+            for (std::size_t j = 0; j < sizeof(p) / sizeof(p[0]); ++j) {
+                CAPTURE(pass);
+                CAPTURE(T[i]);
+                CAPTURE(p[j]);
+                double rho = -1;
+                CHECK_NOTHROW(rho = HEOS->solver_rho_Tp_global(T[i], p[j], 0.9 / HEOS->SRK_covolume()));
+                CHECK(std::abs(HEOS->calc_pressure_nocache(T[i], rho) / p[j] - 1) < 1e-8);
+                // The same as a new instance that has to find the stationary points
+                shared_ptr<CoolProp::HelmholtzEOSMixtureBackend> fresh(HEOS->get_copy());
+                fresh->set_mole_fractions(z);
+                double rho_fresh = fresh->solver_rho_Tp_global(T[i], p[j], 0.9 / fresh->SRK_covolume());
+                CHECK(std::abs(rho / rho_fresh - 1) < 1e-10);
+            }
+        }
+    }
+}
+
+TEST_CASE("Flashes of water seeded from the IF97 backward equations", "[IF97_guesses]") {
+    shared_ptr<CoolProp::AbstractState> REF(CoolProp::AbstractState::factory("HEOS", "Water"));
+    shared_ptr<CoolProp::AbstractState> Water(CoolProp::AbstractState::factory("HEOS", "Water"));
+    REF->update(PQ_INPUTS, 1e6, 0);
+    double Tsat = REF->T();
+    // Liquid, vapor, supercritical, close to saturation on both sides and two-phase (negative pressure)
+    double p[] = {1e5, 1e5, 5e6, 3e7, 3e7, 1e6, 1e6, -1}, T[] = {300, 450, 900, 500, 700, Tsat - 0.2, Tsat + 0.2, 400};
+    for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+        CAPTURE(T[i]);
+        CAPTURE(p[i]);
+        if (p[i] > 0) {
+            REF->update(PT_INPUTS, p[i], T[i]);
+        } else {
+            REF->update(QT_INPUTS, 0.3, T[i]);
+        }
+        double hmass = REF->hmass(), smass = REF->smass(), pp = REF->p(), rho = REF->rhomass();
+        phases phase = REF->phase();
+        CoolProp::set_config_bool(HEOS_WATER_IF97_GUESSES, true);
+        std::vector<std::pair<input_pairs, std::pair<double, double>>> inputs;
+        inputs.push_back(std::make_pair(HmassP_INPUTS, std::make_pair(hmass, pp)));
+        inputs.push_back(std::make_pair(PSmass_INPUTS, std::make_pair(pp, smass)));
+        if (phase != iphase_twophase) {
+            inputs.push_back(std::make_pair(HmassSmass_INPUTS, std::make_pair(hmass, smass)));
+            inputs.push_back(std::make_pair(PT_INPUTS, std::make_pair(pp, T[i])));
+        }
+        for (std::size_t j = 0; j < inputs.size(); ++j) {
+            CAPTURE(get_input_pair_short_desc(inputs[j].first));
+            CHECK_NOTHROW(Water->update(inputs[j].first, inputs[j].second.first, inputs[j].second.second));
+            CHECK(std::abs(Water->T() / REF->T() - 1) < 1e-9);
+            CHECK(std::abs(Water->rhomass() / rho - 1) < 1e-8);
+            CHECK(Water->phase() == phase);
+        }
+        CoolProp::set_config_bool(HEOS_WATER_IF97_GUESSES, false);
+    }
+    // The same (p,h), (p,s) and (h,s) flashes, without and with the guesses
+    std::vector<std::pair<input_pairs, std::pair<double, double>>> inputs;
+    for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+        if (p[i] > 0) {
+            REF->update(PT_INPUTS, p[i], T[i]);
+            inputs.push_back(std::make_pair(HmassSmass_INPUTS, std::make_pair(REF->hmass(), REF->smass())));
+        } else {
+            REF->update(QT_INPUTS, 0.3, T[i]);
+        }
+        inputs.push_back(std::make_pair(HmassP_INPUTS, std::make_pair(REF->hmass(), REF->p())));
+        inputs.push_back(std::make_pair(PSmass_INPUTS, std::make_pair(REF->p(), REF->smass())));
+    }
+    unsigned long long evaluations[2];
+    for (int seeded = 0; seeded < 2; ++seeded) {
+        CoolProp::set_config_bool(HEOS_WATER_IF97_GUESSES, seeded == 1);
+        CoolProp::HelmholtzEOSMixtureBackend::reset_residual_helmholtz_evaluations();
+        for (std::size_t j = 0; j < inputs.size(); ++j) {
+            Water->update(inputs[j].first, inputs[j].second.first, inputs[j].second.second);
+        }
+        evaluations[seeded] = CoolProp::HelmholtzEOSMixtureBackend::residual_helmholtz_evaluations();
+    }
+    CoolProp::set_config_bool(HEOS_WATER_IF97_GUESSES, false);
+    CAPTURE(evaluations[0]);
+    CAPTURE(evaluations[1]);
+    CHECK(evaluations[1] < evaluations[0]);
+}
+
+TEST_CASE("Mixture flashes seeded from the Peng-Robinson model", "[cubic_guesses]") {
+    std::vector<double> z(2, 0.5);
+    shared_ptr<CoolProp::AbstractState> REF(CoolProp::AbstractState::factory("HEOS", "Methane&Ethane"));
+    shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("HEOS", "Methane&Ethane"));
+    REF->set_mole_fractions(z);
+    AS->set_mole_fractions(z);
+    SECTION("Bubble and dew points") {
+        double T[] = {160, 200, 220}, Q[] = {0, 1};
+        for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+            for (std::size_t j = 0; j < 2; ++j) {
+                CAPTURE(T[i]);
+                CAPTURE(Q[j]);
+                REF->update(QT_INPUTS, Q[j], T[i]);
+                double p = REF->p(), rho = REF->rhomolar();
+                CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, true);
+                CHECK_NOTHROW(AS->update(QT_INPUTS, Q[j], T[i]));
+                CHECK(std::abs(AS->p() / p - 1) < 1e-8);
+                CHECK(std::abs(AS->rhomolar() / rho - 1) < 1e-8);
+                CHECK_NOTHROW(AS->update(PQ_INPUTS, p, Q[j]));
+                CHECK(std::abs(AS->T() / T[i] - 1) < 1e-8);
+                CHECK(std::abs(AS->rhomolar() / rho - 1) < 1e-8);
+                CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, false);
+            }
+        }
+    }
+    SECTION("Phase split at given temperature and pressure") {
+        REF->update(QT_INPUTS, 0, 200);
+        double pbubble = REF->p();
+        REF->update(QT_INPUTS, 1, 200);
+        double pdew = REF->p();
+        // Two-phase, then vapor
+        double p[] = {0.5 * (pbubble + pdew), 0.5 * pdew};
+        for (std::size_t i = 0; i < sizeof(p) / sizeof(p[0]); ++i) {
+            CAPTURE(p[i]);
+            REF->update(PT_INPUTS, p[i], 200);
+            CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, true);
+            CHECK_NOTHROW(AS->update(PT_INPUTS, p[i], 200));
+            CHECK(std::abs(AS->rhomolar() / REF->rhomolar() - 1) < 1e-7);
+            CHECK(std::abs(AS->Q() - REF->Q()) < 1e-7);
+            CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, false);
+        }
+    }
+    SECTION("Fewer evaluations of the multiparameter model") {
+        // Build the Peng-Robinson model and fit its interaction parameter first; fitting evaluates the multiparameter model of the binary
+        CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, true);
+        AS->update(QT_INPUTS, 0, 200);
+        unsigned long long evaluations[2];
+        for (int seeded = 0; seeded < 2; ++seeded) {
+            CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, seeded == 1);
+            CoolProp::HelmholtzEOSMixtureBackend::reset_residual_helmholtz_evaluations();
+            double T[] = {170, 190, 210};
+            for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+                AS->update(QT_INPUTS, 0, T[i]);
+                AS->update(QT_INPUTS, 1, T[i]);
+            }
+            evaluations[seeded] = CoolProp::HelmholtzEOSMixtureBackend::residual_helmholtz_evaluations();
+        }
+        CoolProp::set_config_bool(CUBIC_GUESSES_FOR_MIXTURE_FLASHES, false);
+        CAPTURE(evaluations[0]);
+        CAPTURE(evaluations[1]);
+        CHECK(evaluations[1] < evaluations[0]);
+    }
+}
+
+TEST_CASE("GERG-2008 natural gas backend", "[GERG2008]") {
+    std::string fluids = "Methane&Nitrogen&CarbonDioxide&Ethane&Propane&n-Butane&Water";
+    double z[] = {0.85, 0.04, 0.03, 0.05, 0.02, 0.009, 0.001};
+    std::vector<double> x(z, z + sizeof(z) / sizeof(z[0]));
+    shared_ptr<CoolProp::AbstractState> REF(CoolProp::AbstractState::factory("HEOS", fluids));
+    shared_ptr<CoolProp::AbstractState> AS(CoolProp::AbstractState::factory("GERG2008", fluids));
+    REF->set_mole_fractions(x);
+    AS->set_mole_fractions(x);
+    SECTION("Same results as HEOS") {
+        double T[] = {250, 300, 400}, rho[] = {10, 1000, 10000};
+        for (std::size_t i = 0; i < sizeof(T) / sizeof(T[0]); ++i) {
+            for (std::size_t j = 0; j < sizeof(rho) / sizeof(rho[0]); ++j) {
+                CAPTURE(T[i]);
+                CAPTURE(rho[j]);
+                REF->update(DmolarT_INPUTS, rho[j], T[i]);
+                AS->update(DmolarT_INPUTS, rho[j], T[i]);
+                CHECK(std::abs(AS->p() / REF->p() - 1) < 1e-12);
+                CHECK(std::abs(AS->hmolar() - REF->hmolar()) < 1e-9 * std::abs(REF->hmolar()) + 1e-9);
+                CHECK(std::abs(AS->cpmolar() / REF->cpmolar() - 1) < 1e-12);
+                CHECK(std::abs(AS->speed_sound() / REF->speed_sound() - 1) < 1e-12);
+                // Composition derivatives, which use the departure functions of the excess term
+                CHECK(std::abs(AS->fugacity_coefficient(0) / REF->fugacity_coefficient(0) - 1) < 1e-12);
+                CHECK(std::abs(AS->fugacity_coefficient(6) / REF->fugacity_coefficient(6) - 1) < 1e-12);
+            }
+        }
+    }
+    SECTION("Single-phase gas flashes") {
+        REF->specify_phase(CoolProp::iphase_gas);
+        AS->specify_phase(CoolProp::iphase_gas);
+        double p[] = {1e5, 5e6}, T[] = {270, 320};
+        for (std::size_t i = 0; i < sizeof(p) / sizeof(p[0]); ++i) {
+            for (std::size_t j = 0; j < sizeof(T) / sizeof(T[0]); ++j) {
+                CAPTURE(p[i]);
+                CAPTURE(T[j]);
+                REF->update(PT_INPUTS, p[i], T[j]);
+                CHECK_NOTHROW(AS->update(PT_INPUTS, p[i], T[j]));
+                CHECK(std::abs(AS->rhomolar() / REF->rhomolar() - 1) < 1e-10);
+                double h = REF->hmolar(), s = REF->smolar();
+                CHECK_NOTHROW(AS->update(HmolarP_INPUTS, h, p[i]));
+                CHECK(std::abs(AS->T() / T[j] - 1) < 1e-8);
+                CHECK_NOTHROW(AS->update(PSmolar_INPUTS, p[i], s));
+                CHECK(std::abs(AS->T() / T[j] - 1) < 1e-8);
+            }
+        }
+    }
+    SECTION("Changing F_ij") {
+        REF->set_binary_interaction_double(0, 3, "Fij", 0.5);
+        AS->set_binary_interaction_double(0, 3, "Fij", 0.5);
+        REF->update(DmolarT_INPUTS, 5000, 300);
+        AS->update(DmolarT_INPUTS, 5000, 300);
+        CHECK(std::abs(AS->p() / REF->p() - 1) < 1e-12);
+    }
+    SECTION("Only the components of GERG-2008") {
+        CHECK_THROWS(CoolProp::AbstractState::factory("GERG2008", "Methane&R134a"));
+    }
+}
+
 TEST_CASE("Check the changing of reducing function constants", "[reducing]") {
     double z0 = 0.2;
     std::vector<double> z(2);
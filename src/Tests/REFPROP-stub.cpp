@@ -0,0 +1,326 @@
+/*
+ * A loopback stand-in for the REFPROP shared library
+ *
+ * It exports the entry points that are used by the REFPROP backend for loading the fluids and for the most common
+ * flash calls, with the calling convention of the C-style references of the REFPROP headers.  The fluids are modeled as
+ * ideal gases with a handful of hard-coded constants, which is enough to exercise the logic that switches between the
+ * setups of several instances of the backend without the real REFPROP.
+ *
+ * Like REFPROP 9.1, the fluid files must be given with their ending (.FLD or .fld), so the first load of a fluid
+ * needs more than one call to SETUP while the file endings are tried.
+ *
+ * In addition to the REFPROP entry points, REFPROPSTUB_call_count(name) returns the number of calls to the given
+ * entry point, REFPROPSTUB_reset() resets the counters and REFPROPSTUB_GERG_flag() returns the flag of the last call
+ * to GERG04; these can be obtained with dlsym/GetProcAddress when benchmarking or testing the switching.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#    define REFPROPSTUB_EXPORT extern "C" __declspec(dllexport)
+#else
+#    define REFPROPSTUB_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace {
+
+const int ncmax = 20;
+const double R = 8.314462618;  // J/mol/K
+const double cp_R = 3.5;       // The same ideal-gas heat capacity for all the fluids
+
+struct StubFluid
+{
+    const char *name, *CAS;
+    double M, Tc, pc, Dc, Ttrp, Tnbp, acf;  // g/mol, K, kPa, mol/L, K, K, -
+};
+
+const StubFluid stub_fluids[] = {
+  {"NITROGEN", "7727-37-9", 28.01348, 126.192, 3395.8, 11.1839, 63.151, 77.355, 0.0372},
+  {"ARGON", "7440-37-1", 39.948, 150.687, 4863.0, 13.40743, 83.8058, 87.302, -0.00219},
+  {"OXYGEN", "7782-44-7", 31.9988, 154.581, 5043.0, 13.63, 54.361, 90.188, 0.0222},
+  {"METHANE", "74-82-8", 16.0428, 190.564, 4599.2, 10.139342719, 90.6941, 111.667, 0.01142},
+  {"CO2", "124-38-9", 44.0098, 304.1282, 7377.3, 10.6249063, 216.592, 194.686, 0.22394},
+  {"PROPANE", "74-98-6", 44.09562, 369.89, 4251.2, 5.0, 85.525, 231.036, 0.1521},
+  {"R134A", "811-97-2", 102.032, 374.21, 4059.28, 5.017053, 169.85, 247.076, 0.32684},
+  {"WATER", "7732-18-5", 18.015268, 647.096, 22064.0, 17.87371609, 273.16, 373.124, 0.3443},
+};
+
+struct StubKTV
+{
+    char hmodij[4];
+    double fij[6];
+};
+
+std::vector<const StubFluid*> loaded;
+std::map<std::pair<int, int>, StubKTV> ktv;
+int PR_flag = 0;
+int GERG_flag = 0;
+std::map<std::string, int> call_counts;
+
+void count(const char* name) {
+    call_counts[name]++;
+}
+
+/// Copy a string into a fixed-length FORTRAN string, padded with spaces
+void fill(char* dest, const std::string& src, int length) {
+    for (int i = 0; i < length; ++i) {
+        dest[i] = (i < static_cast<int>(src.size())) ? src[i] : ' ';
+    }
+}
+void set_error(char* herr, int length, const std::string& msg) {
+    std::memset(herr, 0, length);
+    std::strncpy(herr, msg.c_str(), length - 1);
+}
+
+/// Strip the path and the file ending from one entry of the component string; return false if there is no file ending
+bool fluid_name_from_file(std::string file, std::string& name) {
+    while (!file.empty() && (file[file.size() - 1] == ' ' || file[file.size() - 1] == '\0')) {
+        file.erase(file.size() - 1);
+    }
+    std::size_t sep = file.find_last_of("/\\");
+    if (sep != std::string::npos) {
+        file = file.substr(sep + 1);
+    }
+    std::size_t dot = file.rfind('.');
+    if (dot == std::string::npos) {
+        return false;
+    }
+    std::string ending = file.substr(dot);
+    if (ending != ".FLD" && ending != ".fld") {
+        return false;
+    }
+    name = file.substr(0, dot);
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    return true;
+}
+
+void default_ktv() {
+    ktv.clear();
+    for (int i = 1; i <= static_cast<int>(loaded.size()); ++i) {
+        for (int j = 1; j <= static_cast<int>(loaded.size()); ++j) {
+            StubKTV k;
+            std::strcpy(k.hmodij, "KW0");
+            double fij[6] = {1, 1, 1, 1, 0, 0};
+            std::memcpy(k.fij, fij, sizeof(fij));
+            ktv[std::make_pair(i, j)] = k;
+        }
+    }
+}
+
+double mix(const double* x, double StubFluid::*field) {
+    double val = 0;
+    for (std::size_t i = 0; i < loaded.size(); ++i) {
+        val += x[i] * (loaded[i]->*field);
+    }
+    return val;
+}
+
+/// The ideal-gas properties at the given temperature and density
+void ideal_gas(double T, double D, const double* x, double* p, double* e, double* h, double* s, double* cv, double* cp, double* w) {
+    double M = mix(x, &StubFluid::M) / 1000.0;
+    *p = D * R * T;
+    *cp = cp_R * R;
+    *cv = *cp - R;
+    *h = *cp * T;
+    *e = *h - R * T;
+    double s_mix = 0;
+    for (std::size_t i = 0; i < loaded.size(); ++i) {
+        if (x[i] > 0) {
+            s_mix -= R * x[i] * std::log(x[i]);
+        }
+    }
+    *s = *cp * std::log(T / 298.15) - R * std::log(*p / 101.325) + s_mix;
+    *w = std::sqrt(*cp / *cv * R * T / M);
+}
+
+}  // namespace
+
+REFPROPSTUB_EXPORT int REFPROPSTUB_call_count(const char* name) {
+    std::map<std::string, int>::const_iterator it = call_counts.find(name);
+    return (it == call_counts.end()) ? 0 : it->second;
+}
+REFPROPSTUB_EXPORT void REFPROPSTUB_reset() {
+    call_counts.clear();
+}
+REFPROPSTUB_EXPORT int REFPROPSTUB_GERG_flag() {
+    return GERG_flag;
+}
+
+REFPROPSTUB_EXPORT void SETUPdll(int* nc, char* hfld, char* hfmix, char* hrf, int* ierr, char* herr, int lhfld, int lhfmix, int lhrf, int lherr) {
+    count("SETUPdll");
+    *ierr = 0;
+    loaded.clear();
+    // Called with nc = -1 to get the version number
+    if (*nc < 0) {
+        *ierr = 91000;
+        set_error(herr, lherr, "");
+        return;
+    }
+    std::string files(hfld, hfld + lhfld);
+    std::size_t start = 0;
+    for (int i = 0; i < *nc; ++i) {
+        std::size_t end = files.find('|', start);
+        std::string name, file = files.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        const StubFluid* fluid = NULL;
+        if (fluid_name_from_file(file, name)) {
+            for (std::size_t k = 0; k < sizeof(stub_fluids) / sizeof(stub_fluids[0]); ++k) {
+                if (name == stub_fluids[k].name) {
+                    fluid = &stub_fluids[k];
+                }
+            }
+        }
+        if (fluid == NULL) {
+            loaded.clear();
+            *ierr = 101;
+            set_error(herr, lherr, "[SETUP error 101] error in opening file: " + file);
+            return;
+        }
+        loaded.push_back(fluid);
+        start = (end == std::string::npos) ? files.size() : end + 1;
+    }
+    default_ktv();
+    set_error(herr, lherr, "");
+}
+REFPROPSTUB_EXPORT void SETMIXdll(char* hmxnme, char* hfmix, char* hrf, int* ncc, char* hfiles, double* x, int* ierr, char* herr, int l1, int l2,
+                                  int l3, int l4, int lherr) {
+    count("SETMIXdll");
+    loaded.clear();
+    *ierr = 101;
+    set_error(herr, lherr, "[SETMIX error 101] predefined mixtures are not available in the REFPROP stub");
+}
+REFPROPSTUB_EXPORT void GERG04dll(int* nc, int* iflag, int* ierr, char* herr, int lherr) {
+    count("GERG04dll");
+    GERG_flag = *iflag;
+    *ierr = 0;
+}
+REFPROPSTUB_EXPORT void PREOSdll(int* iflag) {
+    count("PREOSdll");
+    if (*iflag >= 0) {
+        PR_flag = *iflag;
+    } else {
+        *iflag = PR_flag;
+    }
+}
+REFPROPSTUB_EXPORT void SETKTVdll(int* icomp, int* jcomp, char* hmodij, double* fij, char* hfmix, int* ierr, char* herr, int l1, int l2, int lherr) {
+    count("SETKTVdll");
+    std::map<std::pair<int, int>, StubKTV>::iterator it = ktv.find(std::make_pair(*icomp, *jcomp));
+    if (it == ktv.end() || *icomp == *jcomp) {
+        *ierr = 1;
+        set_error(herr, lherr, "[SETKTV error 1] invalid component numbers");
+        return;
+    }
+    *ierr = 0;
+    std::strncpy(it->second.hmodij, hmodij, 3);
+    it->second.hmodij[3] = '\0';
+    std::memcpy(it->second.fij, fij, sizeof(it->second.fij));
+    set_error(herr, lherr, "");
+}
+REFPROPSTUB_EXPORT void GETKTVdll(int* icomp, int* jcomp, char* hmodij, double* fij, char* hfmix, char* hfij, char* hbinp, char* hmxrul, int l1,
+                                  int l2, int l3, int l4, int l5) {
+    count("GETKTVdll");
+    std::map<std::pair<int, int>, StubKTV>::const_iterator it = ktv.find(std::make_pair(*icomp, *jcomp));
+    if (it == ktv.end()) {
+        std::strcpy(hmodij, "");
+        return;
+    }
+    std::strcpy(hmodij, it->second.hmodij);
+    std::memcpy(fij, it->second.fij, sizeof(it->second.fij));
+    fill(hfmix, "HMX.BNC", l2);
+}
+REFPROPSTUB_EXPORT void NAMEdll(int* icomp, char* hnam, char* hn80, char* hcasn, int l1, int l2, int l3) {
+    count("NAMEdll");
+    const StubFluid* fluid = (*icomp >= 1 && *icomp <= static_cast<int>(loaded.size())) ? loaded[*icomp - 1] : NULL;
+    fill(hnam, fluid ? fluid->name : "", l1);
+    fill(hn80, fluid ? fluid->name : "", l2);
+    fill(hcasn, fluid ? fluid->CAS : "", l3);
+}
+REFPROPSTUB_EXPORT void INFOdll(int* icomp, double* wmm, double* ttrp, double* tnbpt, double* tc, double* pc, double* Dc, double* Zc, double* acf,
+                                double* dip, double* Rgas) {
+    count("INFOdll");
+    const StubFluid& f = *loaded.at(*icomp - 1);
+    *wmm = f.M;
+    *ttrp = f.Ttrp;
+    *tnbpt = f.Tnbp;
+    *tc = f.Tc;
+    *pc = f.pc;
+    *Dc = f.Dc;
+    *Zc = f.pc / (f.Dc * R * f.Tc);
+    *acf = f.acf;
+    *dip = 0;
+    *Rgas = R;
+}
+REFPROPSTUB_EXPORT void WMOLdll(double* x, double* wm) {
+    count("WMOLdll");
+    *wm = mix(x, &StubFluid::M);
+}
+REFPROPSTUB_EXPORT void REDXdll(double* x, double* Tr, double* Dr) {
+    count("REDXdll");
+    *Tr = mix(x, &StubFluid::Tc);
+    *Dr = mix(x, &StubFluid::Dc);
+}
+REFPROPSTUB_EXPORT void CRITPdll(double* x, double* Tc, double* pc, double* Dc, int* ierr, char* herr, int lherr) {
+    count("CRITPdll");
+    *Tc = mix(x, &StubFluid::Tc);
+    *pc = mix(x, &StubFluid::pc);
+    *Dc = mix(x, &StubFluid::Dc);
+    *ierr = 0;
+    set_error(herr, lherr, "");
+}
+REFPROPSTUB_EXPORT void THERMdll(double* T, double* D, double* x, double* p, double* e, double* h, double* s, double* cv, double* cp, double* w,
+                                 double* hjt) {
+    count("THERMdll");
+    ideal_gas(*T, *D, x, p, e, h, s, cv, cp, w);
+    *hjt = 0;
+}
+REFPROPSTUB_EXPORT void TPRHOdll(double* T, double* p, double* x, int* kph, int* kguess, double* D, int* ierr, char* herr, int lherr) {
+    count("TPRHOdll");
+    *D = *p / (R * *T);
+    *ierr = 0;
+    set_error(herr, lherr, "");
+}
+REFPROPSTUB_EXPORT void TPFLSHdll(double* T, double* p, double* z, double* D, double* Dl, double* Dv, double* x, double* y, double* q, double* e,
+                                  double* h, double* s, double* cv, double* cp, double* w, int* ierr, char* herr, int lherr) {
+    count("TPFLSHdll");
+    if (loaded.empty()) {
+        *ierr = 1;
+        set_error(herr, lherr, "[TPFLSH error 1] no fluids have been loaded");
+        return;
+    }
+    double p_calc;
+    *D = *p / (R * *T);
+    ideal_gas(*T, *D, z, &p_calc, e, h, s, cv, cp, w);
+    *Dl = 0;
+    *Dv = 0;
+    for (int i = 0; i < ncmax; ++i) {
+        x[i] = z[i];
+        y[i] = z[i];
+    }
+    *q = 998;  // superheated vapor
+    *ierr = 0;
+    set_error(herr, lherr, "");
+}
+REFPROPSTUB_EXPORT void TDFLSHdll(double* T, double* D, double* z, double* p, double* Dl, double* Dv, double* x, double* y, double* q, double* e,
+                                  double* h, double* s, double* cv, double* cp, double* w, int* ierr, char* herr, int lherr) {
+    count("TDFLSHdll");
+    if (loaded.empty()) {
+        *ierr = 1;
+        set_error(herr, lherr, "[TDFLSH error 1] no fluids have been loaded");
+        return;
+    }
+    ideal_gas(*T, *D, z, p, e, h, s, cv, cp, w);
+    *Dl = 0;
+    *Dv = 0;
+    for (int i = 0; i < ncmax; ++i) {
+        x[i] = z[i];
+        y[i] = z[i];
+    }
+    *q = 998;  // superheated vapor
+    *ierr = 0;
+    set_error(herr, lherr, "");
+}
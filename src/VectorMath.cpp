@@ -0,0 +1,388 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "VectorMath.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#    define COOLPROP_VECTORMATH_NEON
+#    include <arm_neon.h>
+#endif
+#if defined(__x86_64__) || defined(_M_X64)
+#    define COOLPROP_VECTORMATH_X86
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#    endif
+#endif
+
+#include "VectorMathKernels.h"
+
+namespace {
+
+/// The same algorithms one double at a time, for the CPUs without any of the supported SIMD instruction sets
+struct ScalarOps
+{
+    typedef double V;
+    typedef bool M;
+    enum
+    {
+        width = 1
+    };
+    static inline V set1(double x) {
+        return x;
+    }
+    static inline V load(const double* x) {
+        return *x;
+    }
+    static inline void store(double* y, const V& v) {
+        *y = v;
+    }
+    static inline V add(const V& a, const V& b) {
+        return a + b;
+    }
+    static inline V sub(const V& a, const V& b) {
+        return a - b;
+    }
+    static inline V mul(const V& a, const V& b) {
+        return a * b;
+    }
+    static inline V div(const V& a, const V& b) {
+        return a / b;
+    }
+    static inline V madd(const V& a, const V& b, const V& c) {
+        return a * b + c;
+    }
+    static inline V fma(const V& a, const V& b, const V& c) {
+        return std::fma(a, b, c);
+    }
+    static inline V round(const V& a) {
+        return std::nearbyint(a);
+    }
+    static inline M lt(const V& a, const V& b) {
+        return a < b;
+    }
+    static inline M gt(const V& a, const V& b) {
+        return a > b;
+    }
+    static inline M eq(const V& a, const V& b) {
+        return a == b;
+    }
+    static inline V select(const M& m, const V& a, const V& b) {
+        return m ? a : b;
+    }
+    static inline V exponent_field(const V& a) {
+        unsigned long long bits;
+        std::memcpy(&bits, &a, sizeof(double));
+        return static_cast<double>((bits >> 52) & 0x7ff);
+    }
+    static inline V mantissa(const V& a) {
+        unsigned long long bits;
+        std::memcpy(&bits, &a, sizeof(double));
+        bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+        double m;
+        std::memcpy(&m, &bits, sizeof(double));
+        return m;
+    }
+    static inline V pow2i(const V& k) {
+        unsigned long long bits = static_cast<unsigned long long>(static_cast<long long>(k) + 1023) << 52;
+        double y;
+        std::memcpy(&y, &bits, sizeof(double));
+        return y;
+    }
+};
+
+const CoolProp::VectorMath::detail::Kernels scalar_kernels = {
+  "scalar", vector_math_kernels::exp_array<ScalarOps>, vector_math_kernels::log_array<ScalarOps>, vector_math_kernels::pow_array<ScalarOps>,
+  vector_math_kernels::exp_log_array<ScalarOps>};
+
+#if defined(COOLPROP_VECTORMATH_NEON)
+/// Advanced SIMD is part of the baseline of ARMv8-A, so these kernels need neither other target options nor a check of the CPU
+struct NEONOps
+{
+    typedef float64x2_t V;
+    typedef uint64x2_t M;
+    enum
+    {
+        width = 2
+    };
+    static inline V set1(double x) {
+        return vdupq_n_f64(x);
+    }
+    static inline V load(const double* x) {
+        return vld1q_f64(x);
+    }
+    static inline void store(double* y, const V& v) {
+        vst1q_f64(y, v);
+    }
+    static inline V add(const V& a, const V& b) {
+        return vaddq_f64(a, b);
+    }
+    static inline V sub(const V& a, const V& b) {
+        return vsubq_f64(a, b);
+    }
+    static inline V mul(const V& a, const V& b) {
+        return vmulq_f64(a, b);
+    }
+    static inline V div(const V& a, const V& b) {
+        return vdivq_f64(a, b);
+    }
+    static inline V madd(const V& a, const V& b, const V& c) {
+        return vfmaq_f64(c, a, b);
+    }
+    static inline V fma(const V& a, const V& b, const V& c) {
+        return vfmaq_f64(c, a, b);
+    }
+    static inline V round(const V& a) {
+        return vrndnq_f64(a);
+    }
+    static inline M lt(const V& a, const V& b) {
+        return vcltq_f64(a, b);
+    }
+    static inline M gt(const V& a, const V& b) {
+        return vcgtq_f64(a, b);
+    }
+    static inline M eq(const V& a, const V& b) {
+        return vceqq_f64(a, b);
+    }
+    static inline V select(const M& m, const V& a, const V& b) {
+        return vbslq_f64(m, a, b);
+    }
+    static inline V exponent_field(const V& a) {
+        return vcvtq_f64_u64(vandq_u64(vshrq_n_u64(vreinterpretq_u64_f64(a), 52), vdupq_n_u64(0x7ff)));
+    }
+    static inline V mantissa(const V& a) {
+        uint64x2_t bits = vandq_u64(vreinterpretq_u64_f64(a), vdupq_n_u64(0x000fffffffffffffULL));
+        return vreinterpretq_f64_u64(vorrq_u64(bits, vdupq_n_u64(0x3ff0000000000000ULL)));
+    }
+    static inline V pow2i(const V& k) {
+        int64x2_t e = vaddq_s64(vcvtq_s64_f64(k), vdupq_n_s64(1023));
+        return vreinterpretq_f64_s64(vshlq_n_s64(e, 52));
+    }
+};
+
+const CoolProp::VectorMath::detail::Kernels NEON_kernels = {
+  "NEON", vector_math_kernels::exp_array<NEONOps>, vector_math_kernels::log_array<NEONOps>, vector_math_kernels::pow_array<NEONOps>,
+  vector_math_kernels::exp_log_array<NEONOps>};
+#endif
+
+#if defined(COOLPROP_VECTORMATH_X86)
+/// Whether the CPU and the operating system support AVX2 and FMA (level 2) or AVX-512F (level 3)
+bool x86_supports(int level) {
+#    if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0, fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    bool avx2 = (info[1] & (1 << 5)) != 0, avx512f = (info[1] & (1 << 16)) != 0;
+    // The operating system must save the YMM (and for AVX-512 also the opmask and ZMM) registers
+    unsigned long long xcr0 = _xgetbv(0);
+    if (level == 2) {
+        return avx2 && fma && (xcr0 & 0x6) == 0x6;
+    } else {
+        return avx512f && (xcr0 & 0xe6) == 0xe6;
+    }
+#    else
+    __builtin_cpu_init();
+    if (level == 2) {
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    } else {
+        return __builtin_cpu_supports("avx512f");
+    }
+#    endif
+}
+#endif
+
+/// All the kernels that can be used on this CPU, fastest first
+std::vector<const CoolProp::VectorMath::detail::Kernels*> usable_kernels() {
+    std::vector<const CoolProp::VectorMath::detail::Kernels*> kernels;
+#if defined(COOLPROP_VECTORMATH_X86)
+    if (CoolProp::VectorMath::detail::AVX512_kernels() != NULL && x86_supports(3)) {
+        kernels.push_back(CoolProp::VectorMath::detail::AVX512_kernels());
+    }
+    if (CoolProp::VectorMath::detail::AVX2_kernels() != NULL && x86_supports(2)) {
+        kernels.push_back(CoolProp::VectorMath::detail::AVX2_kernels());
+    }
+#endif
+#if defined(COOLPROP_VECTORMATH_NEON)
+    kernels.push_back(&NEON_kernels);
+#endif
+    kernels.push_back(&scalar_kernels);
+    return kernels;
+}
+
+/// The kernels in use; the fastest ones are selected the first time any of the functions is called
+const CoolProp::VectorMath::detail::Kernels*& active_kernels() {
+    static const CoolProp::VectorMath::detail::Kernels* kernels = usable_kernels()[0];
+    return kernels;
+}
+
+} /* namespace */
+
+namespace CoolProp {
+namespace VectorMath {
+
+void exp(const double* x, double* y, std::size_t n) {
+    active_kernels()->exp(x, y, n);
+}
+void log(const double* x, double* y, std::size_t n) {
+    active_kernels()->log(x, y, n);
+}
+void pow(const double* x, const double* a, double* y, std::size_t n) {
+    active_kernels()->pow(x, a, y, n);
+}
+void exp_log(double x, const double* a, const double* b, double* y, std::size_t n) {
+    active_kernels()->exp_log(x, a, b, y, n);
+}
+std::string kernels_in_use() {
+    return active_kernels()->name;
+}
+std::vector<std::string> available_kernels() {
+    std::vector<const detail::Kernels*> kernels = usable_kernels();
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < kernels.size(); ++i) {
+        names.push_back(kernels[i]->name);
+    }
+    return names;
+}
+bool select_kernels(const std::string& name) {
+    std::vector<const detail::Kernels*> kernels = usable_kernels();
+    for (std::size_t i = 0; i < kernels.size(); ++i) {
+        if (name == kernels[i]->name) {
+            active_kernels() = kernels[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+} /* namespace VectorMath */
+} /* namespace CoolProp */
+
+#ifdef ENABLE_CATCH
+#    include <catch2/catch_all.hpp>
+
+namespace {
+
+/// The distance between two doubles in units in the last place
+double ulp_distance(double a, double b) {
+    if (a == b) {
+        return 0;
+    }
+    if (!std::isfinite(a) || !std::isfinite(b)) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return std::abs(a - b) / (std::nextafter(std::abs(b), std::numeric_limits<double>::infinity()) - std::abs(b));
+}
+
+/// Values that are log-uniformly (with random signs if negative is true) distributed between xmin and xmax
+std::vector<double> test_values(double xmin, double xmax, std::size_t n, bool negative) {
+    std::vector<double> x(n);
+    unsigned long long state = 88172645463325252ULL;
+    for (std::size_t i = 0; i < n; ++i) {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double u = static_cast<double>(state >> 11) / 9007199254740992.0;
+        x[i] = xmin * std::exp(u * std::log(xmax / xmin));
+        if (negative && (state & 1)) {
+            x[i] = -x[i];
+        }
+    }
+    return x;
+}
+
+}  // namespace
+
+TEST_CASE("Vector math kernels agree with the C math library", "[VectorMath]") {
+    std::vector<std::string> kernels = CoolProp::VectorMath::available_kernels();
+    std::string in_use = CoolProp::VectorMath::kernels_in_use();
+    CHECK(in_use == kernels[0]);
+    // The sizes are not multiples of the widths of the registers so that the partial registers at the end are tested too
+    const std::size_t N = 20001;
+    for (std::size_t k = 0; k < kernels.size(); ++k) {
+        CAPTURE(kernels[k]);
+        REQUIRE(CoolProp::VectorMath::select_kernels(kernels[k]));
+        DYNAMIC_SECTION("exp with the " << kernels[k] << " kernels") {
+            std::vector<double> x = test_values(1e-8, 745, N, true), y(N);
+            CoolProp::VectorMath::exp(&x[0], &y[0], N);
+            double worst = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                worst = std::max(worst, ulp_distance(y[i], std::exp(x[i])));
+            }
+            CAPTURE(worst);
+            CHECK(worst <= 1.5);
+        }
+        DYNAMIC_SECTION("log with the " << kernels[k] << " kernels") {
+            std::vector<double> x = test_values(1e-310, 1e300, N, false), y(N);
+            std::vector<double> near_one = test_values(1e-12, 0.5, N, true);
+            for (std::size_t i = 0; i < N; ++i) {
+                near_one[i] += 1;
+            }
+            x.insert(x.end(), near_one.begin(), near_one.end());
+            y.resize(x.size());
+            CoolProp::VectorMath::log(&x[0], &y[0], x.size());
+            double worst = 0;
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                worst = std::max(worst, ulp_distance(y[i], std::log(x[i])));
+            }
+            CAPTURE(worst);
+            CHECK(worst <= 1.5);
+        }
+        DYNAMIC_SECTION("pow and exp_log over the ranges of the EOS with the " << kernels[k] << " kernels") {
+            std::vector<double> x = test_values(1e-4, 100, N, false), a = test_values(1e-3, 30, N, true), b = test_values(1e-6, 50, N, true),
+                                y(N);
+            CoolProp::VectorMath::pow(&x[0], &a[0], &y[0], N);
+            double worst = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                worst = std::max(worst, ulp_distance(y[i], std::pow(x[i], a[i])));
+            }
+            CAPTURE(worst);
+            CHECK(worst <= 2);
+            for (std::size_t j = 0; j < 50; ++j) {
+                CoolProp::VectorMath::exp_log(x[j], &a[0], &b[0], &y[0], N);
+                worst = 0;
+                for (std::size_t i = 0; i < N; ++i) {
+                    // pow(x, a)*exp(b) itself has two roundings
+                    worst = std::max(worst, ulp_distance(y[i], std::pow(x[j], a[i]) * std::exp(b[i])));
+                }
+                CAPTURE(x[j]);
+                CAPTURE(worst);
+                CHECK(worst <= 3);
+            }
+        }
+        DYNAMIC_SECTION("special values with the " << kernels[k] << " kernels") {
+            const double inf = std::numeric_limits<double>::infinity(), nan = std::numeric_limits<double>::quiet_NaN();
+            double x[] = {0.0, -0.0, 1.0, inf, -inf, nan, 800, -800, 5e-324, -1.0}, y[10];
+            CoolProp::VectorMath::exp(x, y, 10);
+            CHECK(y[0] == 1.0);
+            CHECK(ulp_distance(y[2], std::exp(1.0)) <= 1);
+            CHECK(y[3] == inf);
+            CHECK(y[4] == 0.0);
+            CHECK(std::isnan(y[5]));
+            CHECK(y[6] == inf);
+            CHECK(y[7] == 0.0);
+            CoolProp::VectorMath::log(x, y, 10);
+            CHECK(y[0] == -inf);
+            CHECK(y[2] == 0.0);
+            CHECK(y[3] == inf);
+            CHECK(std::isnan(y[5]));
+            CHECK(ulp_distance(y[8], std::log(5e-324)) <= 1);
+            CHECK(std::isnan(y[9]));
+            double a[] = {0.0, 2.0, -2.0}, b[] = {0.0, 0.0, 0.0}, z[3];
+            CoolProp::VectorMath::exp_log(0.0, a, b, z, 3);
+            CHECK(z[0] == 1.0);
+            CHECK(z[1] == 0.0);
+            CHECK(z[2] == inf);
+        }
+    }
+    CoolProp::VectorMath::select_kernels(in_use);
+}
+
+#endif
@@ -0,0 +1,239 @@
+/*
+ * The algorithms of the vector math kernels (see VectorMath.h), written once for all the instruction sets in terms of a
+ * class S that provides the elementary operations on one SIMD register:
+ *
+ *   V, M                  the register type and the type of the result of a comparison
+ *   width                 the number of doubles in V
+ *   set1, load, store     broadcast a double, and unaligned load and store
+ *   add, sub, mul, div    the arithmetic operations
+ *   madd(a, b, c)         a*b+c, fused if that is cheap on this instruction set
+ *   fma(a, b, c)          a*b+c with a single rounding
+ *   round(a)              round to the nearest integer, ties to even
+ *   lt, gt, eq, select    comparisons, and select(m, a, b) = m ? a : b
+ *   exponent_field(a)     the biased exponent of a (a positive, normal) as a double
+ *   mantissa(a)           a with its exponent replaced by that of 1, in [1, 2)
+ *   pow2i(k)              2^k for integer k in [-1022, 1023]
+ *
+ * This header is included by VectorMath.cpp and by the translation units of the x86 instruction sets, which compile it with
+ * other target options.  Everything that generates code therefore has internal linkage, and the headers of the standard
+ * library must be included before the target options are changed.
+ *
+ * The error-free transformations rely on every sum and product being rounded separately, so GCC must not contract them
+ * into fused multiply-adds as it does by default (clang only contracts within a single expression, and MSVC not at all).
+ */
+#ifndef COOLPROP_VECTORMATHKERNELS_H
+#define COOLPROP_VECTORMATHKERNELS_H
+
+#include <cstddef>
+#include <limits>
+#include "VectorMath.h"
+
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC push_options
+#    pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace {
+namespace vector_math_kernels {
+
+/// s + e = a + b exactly (Knuth's TwoSum)
+template <class S>
+inline void two_sum(const typename S::V& a, const typename S::V& b, typename S::V& s, typename S::V& e) {
+    typedef typename S::V V;
+    s = S::add(a, b);
+    V bb = S::sub(s, a);
+    e = S::add(S::sub(a, S::sub(s, bb)), S::sub(b, bb));
+}
+
+/// exp(x), with a Cody-Waite argument reduction and the Taylor series of exp(r) for |r| <= ln(2)/2
+template <class S>
+inline typename S::V exp_kernel(const typename S::V& x) {
+    typedef typename S::V V;
+    const V xmin = S::set1(-746.0), xmax = S::set1(710.0);
+    // Clamp the argument so that the scaling below stays finite; NaN passes through because its comparisons are false
+    V xc = S::select(S::lt(x, xmin), xmin, S::select(S::gt(x, xmax), xmax, x));
+    V k = S::round(S::mul(xc, S::set1(1.44269504088896340736)));
+    // ln(2) is split in two parts; k*ln2_hi is exact, and so is the first subtraction
+    V r = S::madd(k, S::set1(-6.93147180369123816490e-01), xc);
+    r = S::madd(k, S::set1(-1.90821492927058770002e-10), r);
+    // The truncation error of the series is below 5e-18
+    V p = S::set1(1.0 / 6227020800.0);
+    p = S::madd(p, r, S::set1(1.0 / 479001600.0));
+    p = S::madd(p, r, S::set1(1.0 / 39916800.0));
+    p = S::madd(p, r, S::set1(1.0 / 3628800.0));
+    p = S::madd(p, r, S::set1(1.0 / 362880.0));
+    p = S::madd(p, r, S::set1(1.0 / 40320.0));
+    p = S::madd(p, r, S::set1(1.0 / 5040.0));
+    p = S::madd(p, r, S::set1(1.0 / 720.0));
+    p = S::madd(p, r, S::set1(1.0 / 120.0));
+    p = S::madd(p, r, S::set1(1.0 / 24.0));
+    p = S::madd(p, r, S::set1(1.0 / 6.0));
+    p = S::madd(p, r, S::set1(0.5));
+    p = S::madd(p, r, S::set1(1.0));
+    p = S::madd(p, r, S::set1(1.0));
+    // Multiply by 2^k in two steps so that both factors are normal numbers, also for subnormal results
+    V k1 = S::round(S::mul(k, S::set1(0.5)));
+    V k2 = S::sub(k, k1);
+    V y = S::mul(S::mul(p, S::pow2i(k1)), S::pow2i(k2));
+    y = S::select(S::gt(x, S::set1(7.09782712893383973096e+02)), S::set1(std::numeric_limits<double>::infinity()), y);
+    y = S::select(S::lt(x, S::set1(-7.45133219101941108420e+02)), S::set1(0.0), y);
+    return y;
+}
+
+/**
+ * log(x) = hi + lo in extended precision, with the decomposition and the polynomial of fdlibm's log:
+ * x = 2^k*(1+f) with sqrt(2)/2 <= 1+f < sqrt(2), and log(1+f) = f - f^2/2 + s*(f^2/2 + R(s^2)) with s = f/(2+f).
+ * The terms are summed with error-free transformations; the error of hi + lo is a small fraction of an ulp of log(x).
+ */
+template <class S>
+inline void log_dd_kernel(const typename S::V& x, typename S::V& hi, typename S::V& lo) {
+    typedef typename S::V V;
+    typedef typename S::M M;
+    const V one = S::set1(1.0), zero = S::set1(0.0), inf = S::set1(std::numeric_limits<double>::infinity());
+    const V ln2_hi = S::set1(6.93147180369123816490e-01), ln2_lo = S::set1(1.90821492927058770002e-10);
+
+    // Bring the subnormal numbers into the normal range
+    M tiny = S::lt(x, S::set1(std::numeric_limits<double>::min()));
+    V xs = S::select(tiny, S::mul(x, S::set1(18014398509481984.0)), x);  // 2^54
+    V k = S::sub(S::exponent_field(xs), S::select(tiny, S::set1(1023.0 + 54.0), S::set1(1023.0)));
+    V m = S::mantissa(xs);
+    M big = S::gt(m, S::set1(1.41421356237309504880));
+    m = S::select(big, S::mul(m, S::set1(0.5)), m);
+    k = S::select(big, S::add(k, one), k);
+
+    V f = S::sub(m, one);  // exact
+    V hf = S::mul(S::set1(0.5), f);
+    V hfsq = S::mul(hf, f);
+    V hfsq_lo = S::fma(hf, f, S::sub(zero, hfsq));
+    V s = S::div(f, S::add(S::set1(2.0), f));
+    V z = S::mul(s, s);
+    V w = S::mul(z, z);
+    V t1 = S::mul(
+      w, S::madd(w, S::madd(w, S::set1(1.531383769920937332e-01), S::set1(2.222219843214978396e-01)), S::set1(3.999999999940941908e-01)));
+    V t2 = S::mul(z, S::madd(w,
+                             S::madd(w, S::madd(w, S::set1(1.479819860511658591e-01), S::set1(1.818357216161805012e-01)),
+                                     S::set1(2.857142874366239149e-01)),
+                             S::set1(6.666666666666735130e-01)));
+    V c = S::mul(s, S::add(hfsq, S::add(t1, t2)));
+
+    // log(x) = k*ln2_hi + f - hfsq - hfsq_lo + c + k*ln2_lo; k*ln2_hi is exact
+    V s1, e1, s2, e2;
+    two_sum<S>(S::mul(k, ln2_hi), f, s1, e1);
+    two_sum<S>(s1, S::sub(zero, hfsq), s2, e2);
+    V l = S::add(S::add(e1, e2), S::add(S::sub(c, hfsq_lo), S::mul(k, ln2_lo)));
+    hi = S::add(s2, l);
+    lo = S::sub(l, S::sub(hi, s2));
+
+    // The special values
+    hi = S::select(S::eq(x, zero), S::sub(zero, inf), hi);
+    hi = S::select(S::lt(x, zero), S::set1(std::numeric_limits<double>::quiet_NaN()), hi);
+    hi = S::select(S::eq(x, inf), inf, hi);
+    hi = S::select(S::eq(x, x), hi, x);  // NaN
+    lo = S::select(S::eq(x, zero), zero, lo);
+    lo = S::select(S::eq(x, inf), zero, lo);
+    lo = S::select(S::eq(x, x), lo, zero);
+}
+
+/// exp(a*(lh + ll) + b), where lh + ll is a logarithm in extended precision
+template <class S>
+inline typename S::V exp_log_kernel(const typename S::V& a, const typename S::V& lh, const typename S::V& ll, const typename S::V& b) {
+    typedef typename S::V V;
+    typedef typename S::M M;
+    const V zero = S::set1(0.0);
+    // The exponent in extended precision, sh + pl
+    V ph = S::mul(a, lh);
+    V pl = S::add(S::fma(a, lh, S::sub(zero, ph)), S::mul(a, ll));
+    V sh, se;
+    two_sum<S>(ph, b, sh, se);
+    pl = S::add(pl, se);
+    // x^0 = 1, also for x = 0 and x = inf
+    M a_zero = S::eq(a, zero);
+    sh = S::select(a_zero, b, sh);
+    // exp(sh + pl) = exp(sh)*(1 + pl) because pl is much smaller than the ulp of sh
+    pl = S::select(S::eq(S::sub(sh, sh), zero), pl, zero);  // only for finite sh
+    pl = S::select(a_zero, zero, pl);
+    V y = exp_kernel<S>(sh);
+    V corrected = S::madd(y, pl, y);
+    return S::select(S::eq(y, S::set1(std::numeric_limits<double>::infinity())), y, corrected);
+}
+
+template <class S>
+inline typename S::V load_partial(const double* x, std::size_t m, double fill) {
+    double buf[S::width];
+    for (std::size_t j = 0; j < S::width; ++j) {
+        buf[j] = (j < m) ? x[j] : fill;
+    }
+    return S::load(buf);
+}
+
+template <class S>
+inline void store_partial(double* y, const typename S::V& v, std::size_t m) {
+    double buf[S::width];
+    S::store(buf, v);
+    for (std::size_t j = 0; j < m; ++j) {
+        y[j] = buf[j];
+    }
+}
+
+template <class S>
+void exp_array(const double* x, double* y, std::size_t n) {
+    std::size_t i = 0;
+    for (; i + S::width <= n; i += S::width) {
+        S::store(y + i, exp_kernel<S>(S::load(x + i)));
+    }
+    if (i < n) {
+        store_partial<S>(y + i, exp_kernel<S>(load_partial<S>(x + i, n - i, 0.0)), n - i);
+    }
+}
+
+template <class S>
+void log_array(const double* x, double* y, std::size_t n) {
+    typename S::V hi, lo;
+    std::size_t i = 0;
+    for (; i + S::width <= n; i += S::width) {
+        log_dd_kernel<S>(S::load(x + i), hi, lo);
+        S::store(y + i, hi);
+    }
+    if (i < n) {
+        log_dd_kernel<S>(load_partial<S>(x + i, n - i, 1.0), hi, lo);
+        store_partial<S>(y + i, hi, n - i);
+    }
+}
+
+template <class S>
+void pow_array(const double* x, const double* a, double* y, std::size_t n) {
+    typename S::V lh, ll;
+    const typename S::V zero = S::set1(0.0);
+    std::size_t i = 0;
+    for (; i + S::width <= n; i += S::width) {
+        log_dd_kernel<S>(S::load(x + i), lh, ll);
+        S::store(y + i, exp_log_kernel<S>(S::load(a + i), lh, ll, zero));
+    }
+    if (i < n) {
+        log_dd_kernel<S>(load_partial<S>(x + i, n - i, 1.0), lh, ll);
+        store_partial<S>(y + i, exp_log_kernel<S>(load_partial<S>(a + i, n - i, 0.0), lh, ll, zero), n - i);
+    }
+}
+
+template <class S>
+void exp_log_array(double x, const double* a, const double* b, double* y, std::size_t n) {
+    // The logarithm of x is the same for all the elements
+    typename S::V lh, ll;
+    log_dd_kernel<S>(S::set1(x), lh, ll);
+    std::size_t i = 0;
+    for (; i + S::width <= n; i += S::width) {
+        S::store(y + i, exp_log_kernel<S>(S::load(a + i), lh, ll, S::load(b + i)));
+    }
+    if (i < n) {
+        store_partial<S>(y + i, exp_log_kernel<S>(load_partial<S>(a + i, n - i, 0.0), lh, ll, load_partial<S>(b + i, n - i, 0.0)), n - i);
+    }
+}
+
+} /* namespace vector_math_kernels */
+} /* namespace */
+
+#if defined(__GNUC__) && !defined(__clang__)
+#    pragma GCC pop_options
+#endif
+
+#endif
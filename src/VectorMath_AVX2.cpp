@@ -0,0 +1,110 @@
+// The vector math kernels for AVX2 and FMA.  The rest of the library is compiled for the baseline instruction set, so the
+// target options are only changed for the code below; the kernels are only called if the CPU supports them (see VectorMath.cpp)
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include "VectorMath.h"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__clang__) || defined(__GNUC__) || defined(_MSC_VER))
+#    define COOLPROP_VECTORMATH_AVX2
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("avx2", "fma")
+#    endif
+#    include <immintrin.h>
+#endif
+
+#include "VectorMathKernels.h"
+
+#if defined(COOLPROP_VECTORMATH_AVX2)
+namespace {
+
+struct AVX2Ops
+{
+    typedef __m256d V;
+    typedef __m256d M;
+    enum
+    {
+        width = 4
+    };
+    static inline V set1(double x) {
+        return _mm256_set1_pd(x);
+    }
+    static inline V load(const double* x) {
+        return _mm256_loadu_pd(x);
+    }
+    static inline void store(double* y, const V& v) {
+        _mm256_storeu_pd(y, v);
+    }
+    static inline V add(const V& a, const V& b) {
+        return _mm256_add_pd(a, b);
+    }
+    static inline V sub(const V& a, const V& b) {
+        return _mm256_sub_pd(a, b);
+    }
+    static inline V mul(const V& a, const V& b) {
+        return _mm256_mul_pd(a, b);
+    }
+    static inline V div(const V& a, const V& b) {
+        return _mm256_div_pd(a, b);
+    }
+    static inline V madd(const V& a, const V& b, const V& c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+    static inline V fma(const V& a, const V& b, const V& c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+    static inline V round(const V& a) {
+        return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    static inline M lt(const V& a, const V& b) {
+        return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+    }
+    static inline M gt(const V& a, const V& b) {
+        return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+    }
+    static inline M eq(const V& a, const V& b) {
+        return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+    }
+    static inline V select(const M& m, const V& a, const V& b) {
+        return _mm256_blendv_pd(b, a, m);
+    }
+    static inline V exponent_field(const V& a) {
+        // Put the exponent bits in the mantissa of 2^52 and subtract 2^52
+        __m256i e = _mm256_and_si256(_mm256_srli_epi64(_mm256_castpd_si256(a), 52), _mm256_set1_epi64x(0x7ff));
+        e = _mm256_or_si256(e, _mm256_set1_epi64x(0x4330000000000000LL));
+        return _mm256_sub_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(4503599627370496.0));
+    }
+    static inline V mantissa(const V& a) {
+        __m256i bits = _mm256_and_si256(_mm256_castpd_si256(a), _mm256_set1_epi64x(0x000fffffffffffffLL));
+        return _mm256_castsi256_pd(_mm256_or_si256(bits, _mm256_set1_epi64x(0x3ff0000000000000LL)));
+    }
+    static inline V pow2i(const V& k) {
+        // k+1023 ends up in the low bits of the mantissa of 2^52 + k + 1023, and is then shifted into the exponent
+        V t = _mm256_add_pd(_mm256_add_pd(k, _mm256_set1_pd(1023.0)), _mm256_set1_pd(4503599627370496.0));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(t), 52));
+    }
+};
+
+const CoolProp::VectorMath::detail::Kernels AVX2_kernel_table = {
+  "AVX2", vector_math_kernels::exp_array<AVX2Ops>, vector_math_kernels::log_array<AVX2Ops>, vector_math_kernels::pow_array<AVX2Ops>,
+  vector_math_kernels::exp_log_array<AVX2Ops>};
+
+} /* namespace */
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+#endif
+
+const CoolProp::VectorMath::detail::Kernels* CoolProp::VectorMath::detail::AVX2_kernels() {
+#if defined(COOLPROP_VECTORMATH_AVX2)
+    return &AVX2_kernel_table;
+#else
+    return NULL;
+#endif
+}
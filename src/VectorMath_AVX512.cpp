@@ -0,0 +1,110 @@
+// The vector math kernels for AVX-512F.  The rest of the library is compiled for the baseline instruction set, so the
+// target options are only changed for the code below; the kernels are only called if the CPU supports them (see VectorMath.cpp)
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include "VectorMath.h"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__clang__) || defined(__GNUC__) || defined(_MSC_VER))
+#    define COOLPROP_VECTORMATH_AVX512
+#    if defined(__clang__)
+#        pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#    elif defined(__GNUC__)
+#        pragma GCC push_options
+#        pragma GCC target("avx512f")
+#    endif
+#    include <immintrin.h>
+#endif
+
+#include "VectorMathKernels.h"
+
+#if defined(COOLPROP_VECTORMATH_AVX512)
+namespace {
+
+struct AVX512Ops
+{
+    typedef __m512d V;
+    typedef __mmask8 M;
+    enum
+    {
+        width = 8
+    };
+    static inline V set1(double x) {
+        return _mm512_set1_pd(x);
+    }
+    static inline V load(const double* x) {
+        return _mm512_loadu_pd(x);
+    }
+    static inline void store(double* y, const V& v) {
+        _mm512_storeu_pd(y, v);
+    }
+    static inline V add(const V& a, const V& b) {
+        return _mm512_add_pd(a, b);
+    }
+    static inline V sub(const V& a, const V& b) {
+        return _mm512_sub_pd(a, b);
+    }
+    static inline V mul(const V& a, const V& b) {
+        return _mm512_mul_pd(a, b);
+    }
+    static inline V div(const V& a, const V& b) {
+        return _mm512_div_pd(a, b);
+    }
+    static inline V madd(const V& a, const V& b, const V& c) {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+    static inline V fma(const V& a, const V& b, const V& c) {
+        return _mm512_fmadd_pd(a, b, c);
+    }
+    static inline V round(const V& a) {
+        return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+    static inline M lt(const V& a, const V& b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ);
+    }
+    static inline M gt(const V& a, const V& b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);
+    }
+    static inline M eq(const V& a, const V& b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+    }
+    static inline V select(const M& m, const V& a, const V& b) {
+        return _mm512_mask_blend_pd(m, b, a);
+    }
+    static inline V exponent_field(const V& a) {
+        // Put the exponent bits in the mantissa of 2^52 and subtract 2^52
+        __m512i e = _mm512_and_si512(_mm512_srli_epi64(_mm512_castpd_si512(a), 52), _mm512_set1_epi64(0x7ff));
+        e = _mm512_or_si512(e, _mm512_set1_epi64(0x4330000000000000LL));
+        return _mm512_sub_pd(_mm512_castsi512_pd(e), _mm512_set1_pd(4503599627370496.0));
+    }
+    static inline V mantissa(const V& a) {
+        __m512i bits = _mm512_and_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(0x000fffffffffffffLL));
+        return _mm512_castsi512_pd(_mm512_or_si512(bits, _mm512_set1_epi64(0x3ff0000000000000LL)));
+    }
+    static inline V pow2i(const V& k) {
+        // k+1023 ends up in the low bits of the mantissa of 2^52 + k + 1023, and is then shifted into the exponent
+        V t = _mm512_add_pd(_mm512_add_pd(k, _mm512_set1_pd(1023.0)), _mm512_set1_pd(4503599627370496.0));
+        return _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(t), 52));
+    }
+};
+
+const CoolProp::VectorMath::detail::Kernels AVX512_kernel_table = {
+  "AVX-512", vector_math_kernels::exp_array<AVX512Ops>, vector_math_kernels::log_array<AVX512Ops>, vector_math_kernels::pow_array<AVX512Ops>,
+  vector_math_kernels::exp_log_array<AVX512Ops>};
+
+} /* namespace */
+
+#    if defined(__clang__)
+#        pragma clang attribute pop
+#    elif defined(__GNUC__)
+#        pragma GCC pop_options
+#    endif
+#endif
+
+const CoolProp::VectorMath::detail::Kernels* CoolProp::VectorMath::detail::AVX512_kernels() {
+#if defined(COOLPROP_VECTORMATH_AVX512)
+    return &AVX512_kernel_table;
+#else
+    return NULL;
+#endif
+}
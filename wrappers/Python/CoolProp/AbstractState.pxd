@@ -48,6 +48,11 @@ cdef class AbstractState:
     cdef cAbstractState.AbstractState *thisptr     # hold a C++ instance which we're wrapping
     cpdef update(self, constants_header.input_pairs iInput1, double Value1, double Value2)
     cpdef update_with_guesses(self, constants_header.input_pairs iInput1, double Value1, double Value2, PyGuessesStructure guesses)
+    cpdef dict compressible_flow_state(self, double rhomass, double umass, double T_guess = *)
+    cpdef tuple transport_properties_batch(self, vector[double] T, vector[double] rhomolar)
+    cpdef size_t memory_footprint(self) except *
+    cpdef list snapshot(self)
+    cpdef restore(self, vector[double] buffer)
     cpdef set_mole_fractions(self, vector[double] z)
     cpdef set_mass_fractions(self, vector[double] z)
     cpdef set_volu_fractions(self, vector[double] z)
@@ -69,6 +74,12 @@ cdef class AbstractState:
     cpdef constants_header.phases phase(self) except *
     cpdef specify_phase(self, constants_header.phases phase)
     cpdef unspecify_phase(self)
+    cpdef set_tolerance_tier(self, constants_header.tolerance_tiers tier)
+    cpdef constants_header.tolerance_tiers tolerance_tier(self) except *
+    cpdef enable_update_cache(self, size_t capacity = *)
+    cpdef disable_update_cache(self)
+    cpdef clear_update_cache(self)
+    cpdef double update_cache_hit_rate(self) except *
 
     ## Limits
     cpdef double Tmin(self) except *
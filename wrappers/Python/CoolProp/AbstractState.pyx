@@ -58,6 +58,24 @@ cdef class AbstractState:
     cpdef unspecify_phase(self):
         """ Unspecify the phase - wrapper of c++ function :cpapi:`CoolProp::AbstractState::unspecify_phase` """
         self.thisptr.unspecify_phase()
+    cpdef set_tolerance_tier(self, constants_header.tolerance_tiers tier):
+        """ Set the accuracy tier of the iterative solvers - wrapper of c++ function :cpapi:`CoolProp::AbstractState::set_tolerance_tier` """
+        self.thisptr.set_tolerance_tier(tier)
+    cpdef constants_header.tolerance_tiers tolerance_tier(self) except *:
+        """ Get the accuracy tier of the iterative solvers - wrapper of c++ function :cpapi:`CoolProp::AbstractState::tolerance_tier` """
+        return self.thisptr.tolerance_tier()
+    cpdef enable_update_cache(self, size_t capacity = 16):
+        """ Enable the cache of the results of update() - wrapper of c++ function :cpapi:`CoolProp::AbstractState::enable_update_cache` """
+        self.thisptr.enable_update_cache(capacity)
+    cpdef disable_update_cache(self):
+        """ Disable the cache of the results of update() - wrapper of c++ function :cpapi:`CoolProp::AbstractState::disable_update_cache` """
+        self.thisptr.disable_update_cache()
+    cpdef clear_update_cache(self):
+        """ Clear the cache of the results of update() - wrapper of c++ function :cpapi:`CoolProp::AbstractState::clear_update_cache` """
+        self.thisptr.clear_update_cache()
+    cpdef double update_cache_hit_rate(self) except *:
+        """ Get the hit rate of the update cache - wrapper of c++ function :cpapi:`CoolProp::AbstractState::update_cache_hit_rate` """
+        return self.thisptr.update_cache_hit_rate()
 
     cpdef change_EOS(self, size_t i, string EOS_name):
         """ Change the EOS for one component - wrapper of c++ function :cpapi:`CoolProp::AbstractState::change_EOS` """
@@ -113,6 +131,26 @@ cdef class AbstractState:
         _guesses.x = guesses.x
         _guesses.y = guesses.y
         self.thisptr.update_with_guesses(ipair, Value1, Value2, _guesses)
+    cpdef dict compressible_flow_state(self, double rhomass, double umass, double T_guess = -1):
+        """ Update from density and internal energy and get the outputs for compressible flow solvers - wrapper of c++ function :cpapi:`CoolProp::AbstractState::compressible_flow_state` """
+        cdef cAbstractState.CompressibleFlowState state
+        state.T = T_guess
+        self.thisptr.compressible_flow_state(rhomass, umass, state)
+        return dict(p = state.p, T = state.T, speed_sound = state.speed_sound, dpdrho_e = state.dpdrho_e, dpde_rho = state.dpde_rho)
+    cpdef tuple transport_properties_batch(self, vector[double] T, vector[double] rhomolar):
+        """ Get the viscosity and the thermal conductivity at arrays of (T, rhomolar) points - wrapper of c++ function :cpapi:`CoolProp::AbstractState::transport_properties_batch` """
+        cdef vector[double] viscosity, conductivity
+        self.thisptr.transport_properties_batch(T, rhomolar, viscosity, conductivity)
+        return viscosity, conductivity
+    cpdef size_t memory_footprint(self) except *:
+        """ Get the memory used by this instance and the states that it owns, in bytes - wrapper of c++ function :cpapi:`CoolProp::AbstractState::memory_footprint` """
+        return self.thisptr.memory_footprint()
+    cpdef list snapshot(self):
+        """ Take a snapshot of the current state, as a list of floats - wrapper of c++ function :cpapi:`CoolProp::AbstractState::snapshot` """
+        return self.thisptr.snapshot()
+    cpdef restore(self, vector[double] buffer):
+        """ Restore a state from a snapshot, without any flash calculation - wrapper of c++ function :cpapi:`CoolProp::AbstractState::restore` """
+        self.thisptr.restore(buffer)
 
     cpdef set_mole_fractions(self, vector[double] z):
         """ Set the mole fractions - wrapper of c++ function :cpapi:`CoolProp::AbstractState::set_mole_fractions` """
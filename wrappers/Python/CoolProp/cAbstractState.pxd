@@ -29,6 +29,9 @@ cdef extern from "AbstractState.h" namespace "CoolProp":
     cdef cppclass SpinodalData:
         vector[double] tau, delta, M1
 
+    cdef cppclass CompressibleFlowState:
+        double p, T, speed_sound, dpdrho_e, dpde_rho
+
     cdef cppclass AbstractState:
 
         ## Nullary Constructor
@@ -49,6 +52,13 @@ cdef extern from "AbstractState.h" namespace "CoolProp":
         constants_header.phases phase() except +ValueError
         void specify_phase(constants_header.phases phase) except +ValueError
         void unspecify_phase() except +ValueError
+        void set_tolerance_tier(constants_header.tolerance_tiers tier) except +ValueError
+        constants_header.tolerance_tiers tolerance_tier() except +ValueError
+
+        void enable_update_cache(size_t capacity) except +ValueError
+        void disable_update_cache() except +ValueError
+        void clear_update_cache() except +ValueError
+        double update_cache_hit_rate() except +ValueError
 
         void change_EOS(const size_t, const string &) except +ValueError
 
@@ -104,6 +114,11 @@ cdef extern from "AbstractState.h" namespace "CoolProp":
         void update(constants_header.input_pairs iInput1, double Value1, double Value2) except +ValueError
         ## Uses the indices in CoolProp for the input parameters
         void update_with_guesses(constants_header.input_pairs iInput1, double Value1, double Value2, GuessesStructure) except +ValueError
+        void compressible_flow_state(double rhomass, double umass, CompressibleFlowState&) except +ValueError
+        void transport_properties_batch(const vector[double]& T, const vector[double]& rhomolar, vector[double]& viscosity, vector[double]& conductivity) except +ValueError
+        size_t memory_footprint() except +ValueError
+        vector[double] snapshot() except +ValueError
+        void restore(const vector[double]& buffer) except +ValueError
 
         ## Bulk properties accessors - temperature, pressure and density are directly calculated every time
         ## All other parameters are calculated on an as-needed basis